@@ -1,17 +1,26 @@
 using System;
 using System.Diagnostics;
 using System.IO;
+using System.Runtime.InteropServices;
 
 public static class Install {
-	private static void Main() {
+	private static void Main(string[] arguments) {
 		Console.Title = "UnrealCLR Installation Tool";
+
+		string sourcePath = Directory.GetCurrentDirectory() + "/..";
+
+		if (arguments.Length > 0 && arguments[0] == "--package") {
+			Package(sourcePath, arguments);
+
+			return;
+		}
+
 		Console.SetIn(new StreamReader(Console.OpenStandardInput(8192), Console.InputEncoding, false, bufferSize: 1024));
 
 		Console.WriteLine("Welcome to UnrealCLR installation tool!");
 		Console.Write(Environment.NewLine + "Please, set a path to an Unreal Engine project: ");
 
-		string projectPath = @"" + Console.ReadLine().Replace("\"", String.Empty).Replace("\'", String.Empty).TrimEnd(Path.DirectorySeparatorChar);
-		string sourcePath = Directory.GetCurrentDirectory() + "/..";
+		string projectPath = GetPath(Console.ReadLine());
 
 		if (Directory.GetFiles(projectPath, "*.uproject", SearchOption.TopDirectoryOnly).Length != 0) {
 			Console.WriteLine("Project file found in \"" + projectPath + "\" folder!");
@@ -22,6 +31,25 @@ public static class Install {
 			if (Console.ReadKey(false).Key == ConsoleKey.Y)
 				compileTests = true;
 
+			Console.Write(Environment.NewLine + "Do you want to precompile the assemblies to native code with ReadyToRun to avoid JIT compilation at startup? [y/n] ");
+
+			bool readyToRun = false;
+			string userProjectsPath = null;
+
+			if (Console.ReadKey(false).Key == ConsoleKey.Y) {
+				readyToRun = true;
+
+				Console.Write(Environment.NewLine + "Do you want to precompile user projects as well? [y/n] ");
+
+				if (Console.ReadKey(false).Key == ConsoleKey.Y) {
+					Console.Write(Environment.NewLine + "Please, set a path to a folder with source code of user projects: ");
+
+					userProjectsPath = GetPath(Console.ReadLine());
+				}
+			}
+
+			string publishOptions = readyToRun ? GetReadyToRunOptions() : String.Empty;
+
 			Console.Write(Environment.NewLine + "Installation will delete all previous files of the plugin, do you want to continue? [y/n] ");
 
 			if (Console.ReadKey(false).Key == ConsoleKey.Y) {
@@ -44,17 +72,7 @@ public static class Install {
 
 				Console.WriteLine("Launching compilation of the managed runtime...");
 
-				var runtimeCompilation = Process.Start(new ProcessStartInfo {
-					FileName = "dotnet",
-					Arguments =  "publish " + sourcePath + "/Source/Managed/Runtime --configuration Release --framework netcoreapp3.1 --output \"" + projectPath + "/Plugins/UnrealCLR/Managed\"",
-					CreateNoWindow = false,
-					UseShellExecute = true
-				});
-
-				runtimeCompilation.WaitForExit();
-
-				if (runtimeCompilation.ExitCode != 0)
-					Error("Compilation of the runtime was finished with an error!");
+				Publish(sourcePath + "/Source/Managed/Runtime", publishOptions, projectPath + "/Plugins/UnrealCLR/Managed", "the runtime");
 
 				if (compileTests) {
 					string contentPath = sourcePath + "/Content";
@@ -71,33 +89,20 @@ public static class Install {
 
 					Console.WriteLine("Launching compilation of the framework...");
 
-					var frameworkCompilation = Process.Start(new ProcessStartInfo {
-						FileName = "dotnet",
-						Arguments =  "publish " + sourcePath + "/Source/Managed/Framework --configuration Release --framework netcoreapp3.1",
-						CreateNoWindow = false,
-						UseShellExecute = true
-					});
-
-					frameworkCompilation.WaitForExit();
-
-					if (frameworkCompilation.ExitCode != 0)
-						Error("Compilation of the framework was finished with an error!");
+					Publish(sourcePath + "/Source/Managed/Framework", publishOptions, null, "the framework");
 
 					Console.WriteLine("Launching compilation of the tests...");
 
-					var testsCompilation = Process.Start(new ProcessStartInfo {
-						FileName = "dotnet",
-						Arguments =  "publish " + sourcePath + "/Source/Managed/Tests --configuration Release --framework netcoreapp3.1 --output \"" + projectPath + "/Managed/Tests\"",
-						CreateNoWindow = false,
-						UseShellExecute = true
-					});
+					Publish(sourcePath + "/Source/Managed/Tests", publishOptions, projectPath + "/Managed/Tests", "the tests");
 
-					testsCompilation.WaitForExit();
+					Console.WriteLine("Launching compilation of the benchmarks...");
 
-					if (testsCompilation.ExitCode != 0)
-						Error("Compilation of the tests was finished with an error!");
+					Publish(sourcePath + "/Source/Managed/Benchmarks", publishOptions, projectPath + "/Managed/Benchmarks", "the benchmarks");
 				}
 
+				if (userProjectsPath != null)
+					PublishUserProjects(userProjectsPath, projectPath, publishOptions);
+
 				Console.WriteLine("Done!");
 			} else {
 				Console.WriteLine(Environment.NewLine + "Installation canceled");
@@ -107,6 +112,72 @@ public static class Install {
 		}
 	}
 
+	// Precompiles the runtime and user projects of an installed project before it's packaged, the build of the plugin stages them as runtime dependencies
+	private static void Package(string sourcePath, string[] arguments) {
+		if (arguments.Length < 2)
+			Error("Usage: dotnet run -- --package <project folder> [<user projects folder>]");
+
+		string projectPath = GetPath(arguments[1]);
+
+		if (!Directory.Exists(projectPath + "/Plugins/UnrealCLR"))
+			Error("Plugin installation not found in \"" + projectPath + "\" folder!");
+
+		string publishOptions = GetReadyToRunOptions();
+
+		Console.WriteLine("Launching precompilation of the managed runtime for " + GetRuntimeIdentifier() + "...");
+
+		Publish(sourcePath + "/Source/Managed/Runtime", publishOptions, projectPath + "/Plugins/UnrealCLR/Managed", "the runtime");
+
+		if (arguments.Length > 2)
+			PublishUserProjects(GetPath(arguments[2]), projectPath, publishOptions);
+
+		Console.WriteLine("Done! The project can be packaged now");
+	}
+
+	// User assemblies are published to the folder of the project where the plugin loads them from, sources are kept outside of it
+	private static void PublishUserProjects(string userProjectsPath, string projectPath, string publishOptions) {
+		string[] userProjects = Directory.Exists(userProjectsPath) ? Directory.GetFiles(userProjectsPath, "*.csproj", SearchOption.AllDirectories) : Array.Empty<string>();
+
+		if (userProjects.Length == 0)
+			Console.WriteLine("No user projects found in \"" + userProjectsPath + "\" folder, skipping precompilation of user assemblies...");
+
+		foreach (string userProject in userProjects) {
+			string name = Path.GetFileNameWithoutExtension(userProject);
+
+			Console.WriteLine("Launching precompilation of \"" + name + "\"...");
+
+			Publish(userProject, publishOptions, projectPath + "/Managed/" + name, "\"" + userProject + "\"");
+		}
+	}
+
+	private static void Publish(string project, string options, string output, string name) {
+		var compilation = Process.Start(new ProcessStartInfo {
+			FileName = "dotnet",
+			Arguments =  "publish \"" + project + "\" --configuration Release --framework netcoreapp3.1" + options + (output != null ? " --output \"" + output + "\"" : String.Empty),
+			CreateNoWindow = false,
+			UseShellExecute = true
+		});
+
+		compilation.WaitForExit();
+
+		if (compilation.ExitCode != 0)
+			Error("Compilation of " + name + " was finished with an error!");
+	}
+
+	private static string GetPath(string path) => @"" + path.Replace("\"", String.Empty).Replace("\'", String.Empty).TrimEnd(Path.DirectorySeparatorChar);
+
+	private static string GetReadyToRunOptions() => " --runtime " + GetRuntimeIdentifier() + " --self-contained false -p:PublishReadyToRun=True";
+
+	private static string GetRuntimeIdentifier() {
+		if (RuntimeInformation.IsOSPlatform(OSPlatform.Windows))
+			return "win-x64";
+
+		if (RuntimeInformation.IsOSPlatform(OSPlatform.OSX))
+			return "osx-x64";
+
+		return "linux-x64";
+	}
+
 	private static void Error(string message) {
 		Console.ForegroundColor = ConsoleColor.Red;
 		Console.WriteLine(message);
@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2020 Stanislav Denisov (nxrighthere@gmail.com)
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU Lesser General Public License
+ * (LGPL) version 3 with a static linking exception which accompanies this
+ * distribution.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include <dlfcn.h>
+#include <unistd.h>
+
+#include "../Native/Source/UnrealCLR/Public/UnrealCLRConversion.h"
+#include "../Native/Source/UnrealCLR/Public/UnrealCLRHost.h"
+
+#include "Simulation.h"
+
+static_assert(sizeof(char_t) == sizeof(char), "The harness supports only platforms with narrow host strings");
+
+namespace Harness {
+	static void* ManagedFunctions[3];
+	static void* NativeFunctions[4];
+
+	static UnrealCLR::ExecuteAssemblyFunctionDelegate ExecuteAssemblyFunction;
+	static UnrealCLR::LoadAssemblyFunctionDelegate LoadAssemblyFunction;
+	static UnrealCLR::UnloadAssembliesDelegate UnloadAssemblies;
+	static UnrealCLR::LoadAssemblyFunctionsDelegate LoadAssemblyFunctions;
+
+	static int32_t Errors;
+
+	static void HostError(const char_t* Message) {
+		Errors++;
+
+		std::fprintf(stderr, "Host error: %s\n", Message);
+	}
+
+	static void Invoke(void(*ManagedFunction)()) {
+		ManagedFunction();
+	}
+
+	static void Exception(const char* Message) {
+		Errors++;
+
+		std::fprintf(stderr, "Exception: %s\n", Message);
+	}
+
+	static void Log(UnrealCLR::LogLevel Level, const char* Message) {
+		if (Level == UnrealCLR::LogLevel::Error)
+			Errors++;
+
+		std::fprintf(Level == UnrealCLR::LogLevel::Display ? stdout : stderr, "%s: %s\n", Level == UnrealCLR::LogLevel::Display ? "Display" : Level == UnrealCLR::LogLevel::Warning ? "Warning" : "Error", Message);
+	}
+
+	static double Now() {
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	static int Fail(const char* Message) {
+		std::fprintf(stderr, "%s\n", Message);
+
+		return EXIT_FAILURE;
+	}
+
+	// Plays the system against the simulated world as the plugin does in a play session, one tick per frame
+	static int RunSystem(const char* AssemblyPath, const char* TypeName, int32_t Frames) {
+		void* beginPlay = LoadAssemblyFunction(AssemblyPath, TypeName, "OnBeginPlay", true);
+		void* tick = LoadAssemblyFunction(AssemblyPath, TypeName, "OnTick", true);
+		void* endPlay = LoadAssemblyFunction(AssemblyPath, TypeName, "OnEndPlay", true);
+
+		if (!beginPlay && !tick && !endPlay)
+			return Fail("Unable to resolve system functions!");
+
+		const double start = Now();
+
+		Simulation::BeginFrame();
+
+		if (beginPlay)
+			ExecuteAssemblyFunction(beginPlay);
+
+		int32_t frame = 0;
+
+		for (; frame < Frames && !Simulation::IsExitRequested(); frame++) {
+			Simulation::BeginFrame();
+
+			if (tick)
+				ExecuteAssemblyFunction(tick);
+		}
+
+		const int32_t actors = Simulation::GetActorCount();
+
+		if (endPlay)
+			ExecuteAssemblyFunction(endPlay);
+
+		Simulation::EndPlay();
+		UnloadAssemblies();
+
+		std::printf("System %s: %d frames in %.2f ms, %d actors at the end of play\n", TypeName, frame, Now() - start, actors);
+
+		return Errors + Simulation::GetErrors() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	typedef void (*ConversionFunction)(const float*, float*, int32_t);
+
+	struct ConversionKernel {
+		const char* Name;
+		ConversionFunction Function;
+		ConversionFunction Reference;
+		int32_t SourceFloats;
+		int32_t DestinationFloats;
+	};
+
+	static std::vector<const float*> ConversionSources;
+
+	static void GatherTransforms(const float*, float* Destination, int32_t Count) {
+		UnrealCLRConversion::TransformsFromEngine(ConversionSources.data(), Destination, Count);
+	}
+
+	static void GatherTransformsScalar(const float*, float* Destination, int32_t Count) {
+		UnrealCLRConversion::Scalar::TransformsFromEngine(ConversionSources.data(), Destination, Count);
+	}
+
+	// Verifies the batch conversion kernels against the reference implementations and measures both, no runtime is involved
+	static int RunConversions(int32_t Count, int32_t Iterations) {
+		const ConversionKernel kernels[] = {
+			{ "TransformsToEngine", UnrealCLRConversion::TransformsToEngine, UnrealCLRConversion::Scalar::TransformsToEngine, UnrealCLRConversion::TransformFloats, UnrealCLRConversion::EngineTransformFloats },
+			{ "TransformsFromEngine", UnrealCLRConversion::TransformsFromEngine, UnrealCLRConversion::Scalar::TransformsFromEngine, UnrealCLRConversion::EngineTransformFloats, UnrealCLRConversion::TransformFloats },
+			{ "TransformsFromEngine (gather)", GatherTransforms, GatherTransformsScalar, UnrealCLRConversion::EngineTransformFloats, UnrealCLRConversion::TransformFloats }
+		};
+
+		const char* instructionSets[] = { "Scalar", "SSE" };
+		const char* instructionSet = instructionSets[static_cast<int32_t>(UnrealCLRConversion::GetInstructionSet())];
+		std::mt19937 random(Count);
+		std::uniform_real_distribution<float> distribution(-1000.0f, 1000.0f);
+		std::vector<float> source(static_cast<size_t>(Count) * UnrealCLRConversion::EngineTransformFloats);
+		std::vector<float> result(source.size());
+		std::vector<float> expected(source.size());
+
+		for (float& value : source) {
+			value = distribution(random);
+		}
+
+		for (int32_t i = 0; i < Count; i++) {
+			ConversionSources.push_back(&source[static_cast<size_t>(i) * UnrealCLRConversion::EngineTransformFloats]);
+		}
+
+		std::shuffle(ConversionSources.begin(), ConversionSources.end(), random);
+		std::printf("Conversions of %d elements, %d iterations, %s kernels\n", Count, Iterations, instructionSet);
+
+		for (const ConversionKernel& kernel : kernels) {
+			const size_t size = static_cast<size_t>(Count) * kernel.DestinationFloats * sizeof(float);
+
+			// Every length up to a few registers covers the remainder paths
+			for (int32_t count = 0; count <= std::min(Count, 17); count++) {
+				std::fill(result.begin(), result.end(), 0.0f);
+				std::fill(expected.begin(), expected.end(), 0.0f);
+				kernel.Function(source.data(), result.data(), count);
+				kernel.Reference(source.data(), expected.data(), count);
+
+				if (std::memcmp(result.data(), expected.data(), size) != 0) {
+					Errors++;
+
+					std::fprintf(stderr, "Error: %s result of %d elements does not match the reference implementation\n", kernel.Name, count);
+				}
+			}
+
+			kernel.Function(source.data(), result.data(), Count);
+			kernel.Reference(source.data(), expected.data(), Count);
+
+			if (std::memcmp(result.data(), expected.data(), size) != 0) {
+				Errors++;
+
+				std::fprintf(stderr, "Error: %s result of %d elements does not match the reference implementation\n", kernel.Name, Count);
+			}
+
+			double start = Now();
+
+			for (int32_t i = 0; i < Iterations; i++) {
+				kernel.Reference(source.data(), expected.data(), Count);
+			}
+
+			const double reference = (Now() - start) * 1000000.0 / (static_cast<double>(Iterations) * Count);
+
+			start = Now();
+
+			for (int32_t i = 0; i < Iterations; i++) {
+				kernel.Function(source.data(), result.data(), Count);
+			}
+
+			const double batch = (Now() - start) * 1000000.0 / (static_cast<double>(Iterations) * Count);
+
+			std::printf("%s: %.2f ns per element scalar, %.2f ns per element %s, %.2fx\n", kernel.Name, reference, batch, instructionSet, reference / batch);
+		}
+
+		return Errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+}
+
+int main(int argc, char** argv) {
+	if (argc > 1 && std::strcmp(argv[1], "--conversions") == 0)
+		return Harness::RunConversions(argc > 2 ? std::max(std::atoi(argv[2]), 1) : 4096, argc > 3 ? std::max(std::atoi(argv[3]), 1) : 2000);
+
+	if (argc < 4) {
+		std::fprintf(stderr, "Usage: %s <hostfxr library> <runtime directory> <probe assembly> [iterations] [cycles]\n", argv[0]);
+		std::fprintf(stderr, "       %s <hostfxr library> <runtime directory> <assembly> --system <type name> [--frames <count>]\n", argv[0]);
+		std::fprintf(stderr, "       %s --conversions [count] [iterations]\n", argv[0]);
+
+		return EXIT_FAILURE;
+	}
+
+	const std::string hostfxrPath = argv[1];
+	const std::string assembliesPath = std::string(argv[2]) + "/";
+	const std::string runtimeConfigPath = assembliesPath + UNREALCLR_RUNTIME_CONFIG;
+	const std::string runtimeAssemblyPath = assembliesPath + UNREALCLR_RUNTIME_ASSEMBLY;
+	const std::string probeAssemblyPath = argv[3];
+	const bool systemMode = argc > 5 && std::strcmp(argv[4], "--system") == 0;
+	const char* systemTypeName = systemMode ? argv[5] : nullptr;
+	const int32_t frames = systemMode && argc > 7 && std::strcmp(argv[6], "--frames") == 0 ? std::max(std::atoi(argv[7]), 1) : 1000;
+	const int32_t iterations = !systemMode && argc > 4 ? std::max(std::atoi(argv[4]), 1) : 100000;
+	const int32_t cycles = !systemMode && argc > 5 ? std::max(std::atoi(argv[5]), 1) : 10;
+	const char* probeTypeName = "UnrealEngine.Harness.Probe";
+	char projectDirectory[4096] = ".";
+
+	if (!getcwd(projectDirectory, sizeof(projectDirectory)))
+		std::strcpy(projectDirectory, ".");
+
+	double time = Harness::Now();
+
+	auto measure = [&time]() {
+		const double now = Harness::Now();
+		const double elapsed = now - time;
+
+		time = now;
+
+		return elapsed;
+	};
+
+	// Cold initialization, the bootstrap is shared with the plugin
+
+	void* hostfxrLibrary = dlopen(hostfxrPath.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+	if (!hostfxrLibrary)
+		return Harness::Fail("Host library loading failed!");
+
+	auto getExport = [](void* Library, const char* Name) {
+		return dlsym(Library, Name);
+	};
+
+	UnrealCLR::InitializeDelegate Initialize = nullptr;
+	UnrealCLR::HostTimings hostTimings = { };
+
+	if (const char* error = UnrealCLR::LoadRuntime(hostfxrLibrary, getExport, Harness::Now, time, Harness::HostError, runtimeConfigPath.c_str(), runtimeAssemblyPath.c_str(), &Initialize, &hostTimings))
+		return Harness::Fail(error);
+
+	measure();
+
+	// Engine functions are replaced by the simulated world, the working directory serves as the project directory
+
+	Simulation::Initialize(projectDirectory, 1.0f / 60.0f);
+
+	Harness::ManagedFunctions[0] = (void*)&Harness::Invoke;
+	Harness::ManagedFunctions[1] = (void*)&Harness::Exception;
+	Harness::ManagedFunctions[2] = (void*)&Harness::Log;
+
+	void** functions = Simulation::GetFunctions();
+	const double tableBinding = measure();
+
+	if (!UnrealCLR::InitializeRuntime(Initialize, Harness::ManagedFunctions, Harness::NativeFunctions, functions))
+		return Harness::Fail("Host runtime assembly initialization failed!");
+
+	const double runtimeAssemblyInitialization = measure();
+
+	Harness::ExecuteAssemblyFunction = (UnrealCLR::ExecuteAssemblyFunctionDelegate)Harness::NativeFunctions[0];
+	Harness::LoadAssemblyFunction = (UnrealCLR::LoadAssemblyFunctionDelegate)Harness::NativeFunctions[1];
+	Harness::UnloadAssemblies = (UnrealCLR::UnloadAssembliesDelegate)Harness::NativeFunctions[2];
+	Harness::LoadAssemblyFunctions = (UnrealCLR::LoadAssemblyFunctionsDelegate)Harness::NativeFunctions[3];
+
+	std::printf("Cold initialization: %.2f ms (library load %.2f ms, runtime initialization %.2f ms, runtime assembly load %.2f ms, table binding %.2f ms, runtime assembly initialization %.2f ms)\n", hostTimings.HostLibraryLoad + hostTimings.RuntimeInitialization + hostTimings.RuntimeAssemblyLoad + tableBinding + runtimeAssemblyInitialization, hostTimings.HostLibraryLoad, hostTimings.RuntimeInitialization, hostTimings.RuntimeAssemblyLoad, tableBinding, runtimeAssemblyInitialization);
+
+	if (systemMode)
+		return Harness::RunSystem(probeAssemblyPath.c_str(), systemTypeName, frames);
+
+	// Function resolution, the first call loads the probe and the framework which binds the stub tables
+
+	measure();
+
+	void* emptyFunction = Harness::LoadAssemblyFunction(probeAssemblyPath.c_str(), probeTypeName, "Empty", false);
+	const double firstResolve = measure();
+	void* interopFunction = Harness::LoadAssemblyFunction(probeAssemblyPath.c_str(), probeTypeName, "Interop", false);
+	const double uncachedResolve = measure();
+
+	if (!emptyFunction || !interopFunction)
+		return Harness::Fail("Unable to resolve probe functions!");
+
+	for (int32_t i = 0; i < iterations; i++) {
+		Harness::LoadAssemblyFunction(probeAssemblyPath.c_str(), probeTypeName, "Empty", false);
+	}
+
+	const double cachedResolve = measure();
+
+	std::printf("Function resolve: first %.2f ms, uncached %.3f ms, cached %.1f ns\n", firstResolve, uncachedResolve, cachedResolve * 1000000.0 / iterations);
+
+	// Execution overhead of an empty function and of a function with a single engine call, both are called untimed beforehand until tiered compilation promotes the call path
+
+	const double warmUpEnd = Harness::Now() + 500.0;
+
+	while (Harness::Now() < warmUpEnd) {
+		for (int32_t i = 0; i < 1000; i++) {
+			Harness::ExecuteAssemblyFunction(emptyFunction);
+			Harness::ExecuteAssemblyFunction(interopFunction);
+		}
+	}
+
+	measure();
+
+	for (int32_t i = 0; i < iterations; i++) {
+		Harness::ExecuteAssemblyFunction(emptyFunction);
+	}
+
+	const double emptyExecute = measure();
+
+	for (int32_t i = 0; i < iterations; i++) {
+		Harness::ExecuteAssemblyFunction(interopFunction);
+	}
+
+	const double interopExecute = measure();
+
+	std::printf("Execute: empty %.1f ns, with engine call %.1f ns\n", emptyExecute * 1000000.0 / iterations, interopExecute * 1000000.0 / iterations);
+
+	// Load and unload cycles as on each play session, the collection of the unloaded context continues in the background
+
+	double minimum = 0.0;
+	double maximum = 0.0;
+	double total = 0.0;
+
+	for (int32_t i = 0; i < cycles; i++) {
+		measure();
+
+		Harness::UnloadAssemblies();
+
+		void* function = Harness::LoadAssemblyFunction(probeAssemblyPath.c_str(), probeTypeName, "Empty", false);
+
+		if (!function)
+			return Harness::Fail("Unable to resolve probe function after unloading!");
+
+		Harness::ExecuteAssemblyFunction(function);
+
+		const double cycle = measure();
+
+		minimum = i == 0 ? cycle : std::min(minimum, cycle);
+		maximum = std::max(maximum, cycle);
+		total += cycle;
+	}
+
+	std::printf("Load and unload cycle: mean %.2f ms, min %.2f ms, max %.2f ms over %d cycles\n", total / cycles, minimum, maximum, cycles);
+
+	Harness::UnloadAssemblies();
+
+	return Harness::Errors + Simulation::GetErrors() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file
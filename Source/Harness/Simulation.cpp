@@ -0,0 +1,1870 @@
+/*
+ * Copyright (c) 2020 Stanislav Denisov (nxrighthere@gmail.com)
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU Lesser General Public License
+ * (LGPL) version 3 with a static linking exception which accompanies this
+ * distribution.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Simulation.h"
+#include "UnrealCLRInterop.h"
+
+namespace Simulation {
+	using UnrealCLRFramework::LogLevel;
+	using UnrealCLRFramework::ComponentMobility;
+	using UnrealCLRFramework::AttachmentTransformRule;
+	using UnrealCLRFramework::ActorType;
+	using UnrealCLRFramework::ComponentType;
+	using UnrealCLRFramework::CommandType;
+	using UnrealCLRFramework::PropertyType;
+	using UnrealCLRFramework::Command;
+	using UnrealCLRFramework::LogEntry;
+	using UnrealCLRFramework::LogBuffer;
+	using UnrealCLRFramework::ObjectItem;
+	using UnrealCLRFramework::ConsoleVariableDelegate;
+	using UnrealCLRFramework::DispatchDelegate;
+	using UnrealCLRFramework::TickDelegate;
+	using UnrealCLRFramework::TickExecuteDelegate;
+
+	// Mirrors of the engine-dependent interop types, the layout must match UnrealCLRFramework.h
+
+	struct Color {
+		uint8_t B;
+		uint8_t G;
+		uint8_t R;
+		uint8_t A;
+	};
+
+	struct Vector2 {
+		float X;
+		float Y;
+	};
+
+	struct Vector3 {
+		float X;
+		float Y;
+		float Z;
+	};
+
+	struct Quaternion {
+		float X;
+		float Y;
+		float Z;
+		float W;
+	};
+
+	struct Transform {
+		Vector3 Location;
+		Quaternion Rotation;
+		Vector3 Scale;
+	};
+
+	struct InternedName {
+		uint32_t Id;
+		uint32_t DisplayId;
+		int32_t Number;
+	};
+
+	struct PropertyHandle {
+		const void* Property;
+		const void* Class;
+		int32_t Offset;
+		PropertyType Type;
+	};
+
+	static_assert(sizeof(Transform) == 40 && sizeof(Transform) == sizeof(Command::Payload), "Interop layout is mirrored by the managed side");
+	static_assert(sizeof(InternedName) == 12 && 24 + sizeof(InternedName) <= sizeof(Command::Payload), "Interned name layout is mirrored by the managed side");
+
+	static int32_t Errors;
+
+	static void Print(LogLevel Level, const char* Message) {
+		if (Level >= LogLevel::Error)
+			Errors++;
+
+		std::fprintf(Level == LogLevel::Display ? stdout : stderr, "%s: %s\n", Level == LogLevel::Display ? "Display" : Level == LogLevel::Warning ? "Warning" : "Error", Message);
+	}
+
+	// The length in bytes precedes the null-terminated string, the buffer is reused by the next call
+	static std::vector<char> StringBuffer;
+
+	static const char* Encode(const std::string& Source) {
+		const int32_t length = static_cast<int32_t>(Source.size());
+
+		StringBuffer.resize(sizeof(int32_t) + length + 1);
+		std::memcpy(StringBuffer.data(), &length, sizeof(int32_t));
+		std::memcpy(StringBuffer.data() + sizeof(int32_t), Source.data(), length);
+		StringBuffer[sizeof(int32_t) + length] = '\0';
+
+		return StringBuffer.data() + sizeof(int32_t);
+	}
+
+	namespace Math {
+		static Vector3 Add(const Vector3& A, const Vector3& B) {
+			return { A.X + B.X, A.Y + B.Y, A.Z + B.Z };
+		}
+
+		static Vector3 Subtract(const Vector3& A, const Vector3& B) {
+			return { A.X - B.X, A.Y - B.Y, A.Z - B.Z };
+		}
+
+		static Vector3 Multiply(const Vector3& A, const Vector3& B) {
+			return { A.X * B.X, A.Y * B.Y, A.Z * B.Z };
+		}
+
+		static Vector3 Divide(const Vector3& A, const Vector3& B) {
+			return { B.X != 0.0f ? A.X / B.X : 0.0f, B.Y != 0.0f ? A.Y / B.Y : 0.0f, B.Z != 0.0f ? A.Z / B.Z : 0.0f };
+		}
+
+		static Quaternion Multiply(const Quaternion& A, const Quaternion& B) {
+			return {
+				A.W * B.X + A.X * B.W + A.Y * B.Z - A.Z * B.Y,
+				A.W * B.Y - A.X * B.Z + A.Y * B.W + A.Z * B.X,
+				A.W * B.Z + A.X * B.Y - A.Y * B.X + A.Z * B.W,
+				A.W * B.W - A.X * B.X - A.Y * B.Y - A.Z * B.Z
+			};
+		}
+
+		static Quaternion Inverse(const Quaternion& Value) {
+			return { -Value.X, -Value.Y, -Value.Z, Value.W };
+		}
+
+		static Vector3 Rotate(const Quaternion& Rotation, const Vector3& Value) {
+			const Vector3 axis = { Rotation.X, Rotation.Y, Rotation.Z };
+			const Vector3 twice = { 2.0f * (axis.Y * Value.Z - axis.Z * Value.Y), 2.0f * (axis.Z * Value.X - axis.X * Value.Z), 2.0f * (axis.X * Value.Y - axis.Y * Value.X) };
+
+			return {
+				Value.X + Rotation.W * twice.X + (axis.Y * twice.Z - axis.Z * twice.Y),
+				Value.Y + Rotation.W * twice.Y + (axis.Z * twice.X - axis.X * twice.Z),
+				Value.Z + Rotation.W * twice.Z + (axis.X * twice.Y - axis.Y * twice.X)
+			};
+		}
+
+		static Transform Compose(const Transform& Parent, const Transform& Child) {
+			return { Add(Parent.Location, Rotate(Parent.Rotation, Multiply(Parent.Scale, Child.Location))), Multiply(Parent.Rotation, Child.Rotation), Multiply(Parent.Scale, Child.Scale) };
+		}
+
+		static Transform Relative(const Transform& Parent, const Transform& World) {
+			const Quaternion inverse = Inverse(Parent.Rotation);
+
+			return { Divide(Rotate(inverse, Subtract(World.Location, Parent.Location)), Parent.Scale), Multiply(inverse, World.Rotation), Divide(World.Scale, Parent.Scale) };
+		}
+
+		static const Transform Identity = { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f }, { 1.0f, 1.0f, 1.0f } };
+	}
+
+	// Names are compared without case like the engine names, the first spelling is kept for each name and other spellings are kept separately for display as in case-preserving builds
+	namespace Names {
+		static std::vector<std::string> Strings = { "None" };
+		static std::unordered_map<std::string, uint32_t> Ids = { { "none", 0 }, { "", 0 } };
+		static std::vector<std::string> Displays = { "None" };
+		static std::unordered_map<std::string, uint32_t> DisplayIds = { { "None", 0 }, { "", 0 } };
+
+		static std::string Fold(const char* Value) {
+			std::string folded(Value);
+
+			for (char& character : folded) {
+				character = static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+			}
+
+			return folded;
+		}
+
+		// Unknown names are resolved to none without interning, lookups by arbitrary strings do not grow the table
+		static uint32_t Find(const char* Value) {
+			auto iterator = Ids.find(Fold(Value));
+
+			return iterator != Ids.end() ? iterator->second : 0;
+		}
+
+		static uint32_t Intern(const char* Value) {
+			std::string folded = Fold(Value);
+			auto iterator = Ids.find(folded);
+
+			if (iterator != Ids.end())
+				return iterator->second;
+
+			const uint32_t id = static_cast<uint32_t>(Strings.size());
+
+			Strings.emplace_back(Value);
+			Ids.emplace(std::move(folded), id);
+
+			return id;
+		}
+
+		static uint32_t InternDisplay(const char* Value) {
+			auto iterator = DisplayIds.find(Value);
+
+			if (iterator != DisplayIds.end())
+				return iterator->second;
+
+			const uint32_t id = static_cast<uint32_t>(Displays.size());
+
+			Displays.emplace_back(Value);
+			DisplayIds.emplace(Displays.back(), id);
+
+			return id;
+		}
+	}
+
+	namespace Clock {
+		constexpr uint64_t garbageCollectionInterval = 60;
+
+		static uint64_t Frame;
+		static float DeltaSeconds = 1.0f / 60.0f;
+		static double Time;
+		static bool ExitRequested;
+	}
+
+	namespace Scene {
+		constexpr int32_t pendingKillFlag = 1 << 29;
+
+		struct Property {
+			const char* Name;
+			PropertyType Type;
+			int32_t Offset;
+			uint32_t Id;
+		};
+
+		struct Class {
+			const char* Name;
+			const Class* Parent;
+			std::vector<Property> Properties;
+		};
+
+		struct Object {
+			int32_t Index;
+			const Class* Type;
+			uint32_t Name;
+			std::vector<uint32_t> Tags;
+		};
+
+		struct Component;
+
+		struct Actor : Object {
+			ActorType Kind;
+			float InitialLifeSpan = 0.0f;
+			float CustomTimeDilation = 1.0f;
+			float LifeSpan = 0.0f;
+			bool Hidden = false;
+			bool EnableCollision = true;
+			bool BlockInput = false;
+			Component* Root = nullptr;
+			std::vector<Component*> Components;
+		};
+
+		struct Component : Object {
+			ComponentType Kind;
+			ComponentMobility Mobility = ComponentMobility::Movable;
+			bool Visible = true;
+			Actor* Owner = nullptr;
+			Component* Parent = nullptr;
+			int32_t Slot;
+		};
+
+		static Class ActorClasses[12] = {
+			{ "Actor", nullptr, { } }, { "CameraActor", &ActorClasses[0], { } }, { "Pawn", &ActorClasses[0], { } }, { "Character", &ActorClasses[2], { } },
+			{ "AIController", &ActorClasses[0], { } }, { "PlayerController", &ActorClasses[0], { } }, { "Brush", &ActorClasses[0], { } }, { "AmbientSound", &ActorClasses[0], { } },
+			{ "DirectionalLight", &ActorClasses[0], { } }, { "PointLight", &ActorClasses[0], { } }, { "RectLight", &ActorClasses[0], { } }, { "SpotLight", &ActorClasses[0], { } }
+		};
+
+		static Class ComponentClasses[14] = {
+			{ "ActorComponent", nullptr, { } }, { "InputComponent", &ComponentClasses[0], { } }, { "SceneComponent", &ComponentClasses[0], { } }, { "AudioComponent", &ComponentClasses[2], { } },
+			{ "CameraComponent", &ComponentClasses[2], { } }, { "LightComponent", &ComponentClasses[2], { } }, { "DirectionalLightComponent", &ComponentClasses[5], { } }, { "MotionControllerComponent", &ComponentClasses[2], { } },
+			{ "StaticMeshComponent", &ComponentClasses[2], { } }, { "InstancedStaticMeshComponent", &ComponentClasses[8], { } }, { "BoxComponent", &ComponentClasses[2], { } }, { "SphereComponent", &ComponentClasses[2], { } },
+			{ "CapsuleComponent", &ComponentClasses[2], { } }, { "SkeletalMeshComponent", &ComponentClasses[2], { } }
+		};
+
+		// Items are never relocated since the managed side keeps pointers to them, relative transforms of components are stored in a flat array
+		static std::deque<ObjectItem> Items;
+		static std::vector<int32_t> FreeItems;
+		static std::vector<Transform> Transforms;
+		static std::vector<int32_t> FreeTransforms;
+		static std::vector<Actor*> Actors;
+		static std::vector<Actor*> DestroyedActors;
+		static std::vector<Component*> DestroyedComponents;
+		static int32_t Counter;
+
+		template <typename T, typename M>
+		static int32_t OffsetOf(M T::*Member) {
+			static const T prototype = { };
+
+			return static_cast<int32_t>(reinterpret_cast<const char*>(&(prototype.*Member)) - reinterpret_cast<const char*>(&prototype));
+		}
+
+		static void InitializeClasses() {
+			ActorClasses[0].Properties = {
+				{ "InitialLifeSpan", PropertyType::Float, OffsetOf(&Actor::InitialLifeSpan), 0 },
+				{ "CustomTimeDilation", PropertyType::Float, OffsetOf(&Actor::CustomTimeDilation), 0 },
+				{ "bHidden", PropertyType::Bool, OffsetOf(&Actor::Hidden), 0 },
+				{ "bBlockInput", PropertyType::Bool, OffsetOf(&Actor::BlockInput), 0 }
+			};
+
+			ComponentClasses[2].Properties = {
+				{ "bVisible", PropertyType::Bool, OffsetOf(&Component::Visible), 0 }
+			};
+
+			for (Class* type : { &ActorClasses[0], &ComponentClasses[2] }) {
+				for (Property& property : type->Properties) {
+					property.Id = Names::Intern(property.Name);
+				}
+			}
+		}
+
+		static bool IsA(const Class* Type, const Class* Base) {
+			for (; Type; Type = Type->Parent) {
+				if (Type == Base)
+					return true;
+			}
+
+			return false;
+		}
+
+		static const Property* FindProperty(const Class* Type, uint32_t Name) {
+			for (; Type; Type = Type->Parent) {
+				for (const Property& property : Type->Properties) {
+					if (property.Id == Name)
+						return &property;
+				}
+			}
+
+			return nullptr;
+		}
+
+		static bool IsPendingKill(const Object* Object) {
+			return (Items[Object->Index].Flags & pendingKillFlag) != 0;
+		}
+
+		static void Register(Object* Object, const Class* Type, const char* Name) {
+			if (!FreeItems.empty()) {
+				Object->Index = FreeItems.back();
+				FreeItems.pop_back();
+
+				ObjectItem& item = Items[Object->Index];
+
+				item.Object = Object;
+				item.Flags = 0;
+				item.SerialNumber++;
+			} else {
+				Object->Index = static_cast<int32_t>(Items.size());
+				Items.push_back({ Object, 0, -1, 1 });
+			}
+
+			Object->Type = Type;
+			Object->Name = Name ? Names::Intern(Name) : Names::Intern((std::string(Type->Name) + "_" + std::to_string(Counter++)).c_str());
+		}
+
+		static Actor* Spawn(const char* Name, ActorType Type) {
+			Actor* actor = new Actor();
+
+			Register(actor, &ActorClasses[static_cast<int32_t>(Type)], Name);
+			actor->Kind = Type;
+			Actors.push_back(actor);
+
+			return actor;
+		}
+
+		static Component* Create(Actor* Owner, ComponentType Type, const char* Name) {
+			Component* component = new Component();
+
+			Register(component, &ComponentClasses[static_cast<int32_t>(Type)], Name);
+			component->Kind = Type;
+			component->Owner = Owner;
+
+			if (!FreeTransforms.empty()) {
+				component->Slot = FreeTransforms.back();
+				FreeTransforms.pop_back();
+				Transforms[component->Slot] = Math::Identity;
+			} else {
+				component->Slot = static_cast<int32_t>(Transforms.size());
+				Transforms.push_back(Math::Identity);
+			}
+
+			Owner->Components.push_back(component);
+
+			return component;
+		}
+
+		// Children of the destroyed component are attached to its parent, the first child of the root component becomes the new root
+		static void Destroy(Component* Component) {
+			if (IsPendingKill(Component))
+				return;
+
+			Actor* owner = Component->Owner;
+			Scene::Component* parent = Component->Parent;
+
+			owner->Components.erase(std::find(owner->Components.begin(), owner->Components.end(), Component));
+
+			if (owner->Root == Component) {
+				parent = nullptr;
+
+				for (Scene::Component* child : owner->Components) {
+					if (child->Parent == Component) {
+						parent = child;
+						child->Parent = nullptr;
+
+						break;
+					}
+				}
+
+				owner->Root = parent;
+			}
+
+			for (Scene::Component* child : owner->Components) {
+				if (child->Parent == Component)
+					child->Parent = parent;
+			}
+
+			Items[Component->Index].Flags |= pendingKillFlag;
+			DestroyedComponents.push_back(Component);
+		}
+
+		static bool Destroy(Actor* Actor) {
+			if (IsPendingKill(Actor))
+				return false;
+
+			for (Component* component : Actor->Components) {
+				Items[component->Index].Flags |= pendingKillFlag;
+				DestroyedComponents.push_back(component);
+			}
+
+			Actor->Components.clear();
+			Actor->Root = nullptr;
+			Actors.erase(std::find(Actors.begin(), Actors.end(), Actor));
+			Items[Actor->Index].Flags |= pendingKillFlag;
+			DestroyedActors.push_back(Actor);
+
+			return true;
+		}
+
+		// Destroyed objects are released periodically as the engine does, the managed side may still query them in the meantime
+		static void CollectGarbage() {
+			for (Component* component : DestroyedComponents) {
+				Items[component->Index].Object = nullptr;
+				FreeItems.push_back(component->Index);
+				FreeTransforms.push_back(component->Slot);
+
+				delete component;
+			}
+
+			for (Actor* actor : DestroyedActors) {
+				Items[actor->Index].Object = nullptr;
+				FreeItems.push_back(actor->Index);
+
+				delete actor;
+			}
+
+			DestroyedComponents.clear();
+			DestroyedActors.clear();
+		}
+
+		static Transform GetWorldTransform(const Component* Component) {
+			Transform transform = Transforms[Component->Slot];
+
+			for (const Scene::Component* parent = Component->Parent; parent; parent = parent->Parent) {
+				transform = Math::Compose(Transforms[parent->Slot], transform);
+			}
+
+			return transform;
+		}
+
+		static void SetWorldTransform(const Component* Component, const Transform& Value) {
+			Transforms[Component->Slot] = Component->Parent ? Math::Relative(GetWorldTransform(Component->Parent), Value) : Value;
+		}
+
+		template <typename T>
+		static bool GetProperty(const Object* Object, uint32_t Name, PropertyType Type, T* Value) {
+			const Property* property = FindProperty(Object->Type, Name);
+
+			if (!property || property->Type != Type)
+				return false;
+
+			std::memcpy(Value, reinterpret_cast<const uint8_t*>(Object) + property->Offset, sizeof(T));
+
+			return true;
+		}
+
+		template <typename T>
+		static bool SetProperty(Object* Object, uint32_t Name, PropertyType Type, T Value) {
+			const Property* property = FindProperty(Object->Type, Name);
+
+			if (!property || property->Type != Type)
+				return false;
+
+			std::memcpy(reinterpret_cast<uint8_t*>(Object) + property->Offset, &Value, sizeof(T));
+
+			return true;
+		}
+
+		static void AddTag(Object* Object, const char* Tag) {
+			const uint32_t tag = Names::Intern(Tag);
+
+			if (std::find(Object->Tags.begin(), Object->Tags.end(), tag) == Object->Tags.end())
+				Object->Tags.push_back(tag);
+		}
+
+		static void RemoveTag(Object* Object, const char* Tag) {
+			Object->Tags.erase(std::remove(Object->Tags.begin(), Object->Tags.end(), Names::Find(Tag)), Object->Tags.end());
+		}
+
+		static bool HasTag(const Object* Object, uint32_t Tag) {
+			return Tag != 0 && std::find(Object->Tags.begin(), Object->Tags.end(), Tag) != Object->Tags.end();
+		}
+	}
+
+	namespace Console {
+		enum struct VariableType : int32_t {
+			Bool,
+			Int,
+			Float,
+			String
+		};
+
+		struct Variable {
+			VariableType Type;
+			bool Bool;
+			int32_t Int;
+			float Float;
+			std::string String;
+			ConsoleVariableDelegate Callback;
+		};
+
+		static std::unordered_map<std::string, std::unique_ptr<Variable>> Variables;
+
+		static Variable* Register(const char* Name, VariableType Type) {
+			std::unique_ptr<Variable>& variable = Variables[Name];
+
+			if (variable)
+				return nullptr;
+
+			variable.reset(new Variable());
+			variable->Type = Type;
+
+			return variable.get();
+		}
+
+		// Values are kept in every representation, conversions happen on assignment only
+		static void Set(Variable* Variable, const std::string& Value) {
+			Variable->String = Value;
+			Variable->Float = std::strtof(Value.c_str(), nullptr);
+			Variable->Int = static_cast<int32_t>(Variable->Float);
+			Variable->Bool = Variable->Int != 0 || Value == "true" || Value == "True";
+
+			if (Variable->Callback)
+				Variable->Callback();
+		}
+	}
+
+	namespace Logger {
+		constexpr int32_t Capacity = 4096;
+		constexpr int32_t SlotSize = 128;
+
+		static LogEntry Entries[Capacity];
+		static uint8_t Payload[Capacity * SlotSize];
+		static LogBuffer Buffer = { 0, 0, 0, Capacity, SlotSize, 0, Entries, Payload, &Clock::Frame };
+		static std::vector<char> Scratch;
+
+		static void Drain() {
+			const int32_t dropped = __atomic_exchange_n(&Buffer.Dropped, 0, __ATOMIC_SEQ_CST);
+
+			if (dropped > 0)
+				std::fprintf(stderr, "Warning: %d messages were dropped since the log buffer was full\n", dropped);
+
+			int64_t read = Buffer.Read;
+
+			while (read != __atomic_load_n(&Buffer.Write, __ATOMIC_ACQUIRE)) {
+				LogEntry& entry = Entries[read & (Capacity - 1)];
+
+				// Entries are drained in the order of reservation, an entry which is still being written is left for the next frame
+				if (__atomic_load_n(&entry.Committed, __ATOMIC_ACQUIRE) == 0)
+					break;
+
+				const int32_t offset = (read & (Capacity - 1)) * SlotSize;
+				const int32_t length = entry.CategoryLength + entry.MessageLength;
+				const char* payload = reinterpret_cast<const char*>(Payload + offset);
+
+				if (offset + length > Capacity * SlotSize) {
+					const int32_t tail = Capacity * SlotSize - offset;
+
+					Scratch.resize(length);
+					std::memcpy(Scratch.data(), payload, tail);
+					std::memcpy(Scratch.data() + tail, Payload, length - tail);
+					payload = Scratch.data();
+				}
+
+				const std::string message = std::string("[Frame ") + std::to_string(entry.Frame) + "] " + (entry.CategoryLength > 0 ? std::string(payload, entry.CategoryLength) + ": " : std::string()) + std::string(payload + entry.CategoryLength, entry.MessageLength);
+
+				Print(entry.Level, message.c_str());
+
+				read += entry.Count;
+
+				__atomic_store_n(&entry.Committed, 0, __ATOMIC_RELEASE);
+				__atomic_store_n(&Buffer.Read, read, __ATOMIC_RELEASE);
+			}
+		}
+	}
+
+	// Tick groups and prerequisites are not simulated, functions are called in the order of registration after the game thread dispatch
+	namespace TickFunctions {
+		struct Function {
+			TickExecuteDelegate Execute;
+			TickDelegate Tick;
+			float Interval;
+			float Elapsed;
+			bool Enabled;
+			bool Registered;
+		};
+
+		static std::vector<std::unique_ptr<Function>> Functions;
+		static std::vector<std::unique_ptr<Function>> Removed;
+		static std::vector<Function*> Scratch;
+
+		static void Execute() {
+			Scratch.clear();
+
+			for (const std::unique_ptr<Function>& function : Functions) {
+				Scratch.push_back(function.get());
+			}
+
+			// Functions unregistered during the pass stay allocated until the next frame as in the plugin
+			for (Function* function : Scratch) {
+				if (!function->Registered || !function->Enabled)
+					continue;
+
+				function->Elapsed += Clock::DeltaSeconds;
+
+				if (function->Elapsed < function->Interval)
+					continue;
+
+				const float deltaTime = function->Elapsed;
+
+				function->Elapsed = 0.0f;
+				function->Execute(function->Tick, deltaTime);
+			}
+		}
+	}
+
+	namespace Framework {
+		namespace CommandLine {
+			static std::string Arguments;
+
+			static const char* Get() {
+				return Encode(Arguments);
+			}
+
+			static void Set(const char* Arguments) {
+				CommandLine::Arguments = Arguments;
+			}
+
+			static void Append(const char* Arguments) {
+				CommandLine::Arguments += Arguments;
+			}
+		}
+
+		namespace Debug {
+			static void Log(LogLevel Level, const char* Message) {
+				Print(Level, Message);
+			}
+
+			static void HandleException(const char* Exception) {
+				Errors++;
+
+				std::fprintf(stderr, "Exception: %s\n", Exception);
+			}
+
+			static void AddOnScreenMessage(int32_t Key, float TimeToDisplay, Color DisplayColor, const char* Message) {
+				std::printf("Screen: %s\n", Message);
+			}
+
+			static LogBuffer* GetLogBuffer() {
+				return &Logger::Buffer;
+			}
+		}
+
+		namespace Object {
+			static bool IsPendingKill(Scene::Object* Object) {
+				return Scene::IsPendingKill(Object);
+			}
+
+			static bool IsValid(Scene::Object* Object) {
+				return Object && !Scene::IsPendingKill(Object);
+			}
+
+			static void Rename(Scene::Object* Object, const char* Name) {
+				Object->Name = Names::Intern(Name);
+			}
+
+			static const char* GetName(Scene::Object* Object) {
+				return Encode(Names::Strings[Object->Name]);
+			}
+
+			static bool GetBool(Scene::Object* Object, const char* Name, bool* Value) {
+				return Scene::GetProperty(Object, Names::Find(Name), PropertyType::Bool, Value);
+			}
+
+			static bool GetInt(Scene::Object* Object, const char* Name, int32_t* Value) {
+				return Scene::GetProperty(Object, Names::Find(Name), PropertyType::Int, Value);
+			}
+
+			static bool GetFloat(Scene::Object* Object, const char* Name, float* Value) {
+				return Scene::GetProperty(Object, Names::Find(Name), PropertyType::Float, Value);
+			}
+
+			static bool SetBool(Scene::Object* Object, const char* Name, bool Value) {
+				return Scene::SetProperty(Object, Names::Find(Name), PropertyType::Bool, Value);
+			}
+
+			static bool SetInt(Scene::Object* Object, const char* Name, int32_t Value) {
+				return Scene::SetProperty(Object, Names::Find(Name), PropertyType::Int, Value);
+			}
+
+			static bool SetFloat(Scene::Object* Object, const char* Name, float Value) {
+				return Scene::SetProperty(Object, Names::Find(Name), PropertyType::Float, Value);
+			}
+
+			static bool GetBoolInterned(Scene::Object* Object, const InternedName* Name, bool* Value) {
+				return Scene::GetProperty(Object, Name->Id, PropertyType::Bool, Value);
+			}
+
+			static bool GetIntInterned(Scene::Object* Object, const InternedName* Name, int32_t* Value) {
+				return Scene::GetProperty(Object, Name->Id, PropertyType::Int, Value);
+			}
+
+			static bool GetFloatInterned(Scene::Object* Object, const InternedName* Name, float* Value) {
+				return Scene::GetProperty(Object, Name->Id, PropertyType::Float, Value);
+			}
+
+			static bool SetBoolInterned(Scene::Object* Object, const InternedName* Name, bool Value) {
+				return Scene::SetProperty(Object, Name->Id, PropertyType::Bool, Value);
+			}
+
+			static bool SetIntInterned(Scene::Object* Object, const InternedName* Name, int32_t Value) {
+				return Scene::SetProperty(Object, Name->Id, PropertyType::Int, Value);
+			}
+
+			static bool SetFloatInterned(Scene::Object* Object, const InternedName* Name, float Value) {
+				return Scene::SetProperty(Object, Name->Id, PropertyType::Float, Value);
+			}
+
+			static ObjectItem* GetItem(Scene::Object* Object, int32_t* Index, int32_t* SerialNumber, const Scene::Class** Class) {
+				ObjectItem* item = &Scene::Items[Object->Index];
+
+				*Index = Object->Index;
+				*SerialNumber = item->SerialNumber;
+				*Class = Object->Type;
+
+				return item;
+			}
+
+			static bool GetPropertyHandle(Scene::Object* Object, const char* Name, PropertyHandle* Result) {
+				const Scene::Property* property = Scene::FindProperty(Object->Type, Names::Find(Name));
+
+				if (!property)
+					return false;
+
+				Result->Property = property;
+				Result->Class = Object->Type;
+				Result->Offset = property->Offset;
+				Result->Type = property->Type;
+
+				return true;
+			}
+		}
+
+		namespace Name {
+			static void Create(const char* Value, InternedName* Result) {
+				Result->Id = Names::Intern(Value);
+				Result->DisplayId = Names::InternDisplay(Value);
+				Result->Number = 0;
+			}
+
+			static const char* GetString(const InternedName* Value) {
+				return Encode(Value->DisplayId < Names::Displays.size() ? Names::Displays[Value->DisplayId] : Names::Displays[0]);
+			}
+		}
+
+		namespace Application {
+			static std::string ProjectDirectory;
+			static std::string ProjectName = "Simulation";
+			static float VolumeMultiplier = 1.0f;
+
+			static const char* GetProjectDirectory() {
+				return Encode(ProjectDirectory);
+			}
+
+			static const char* GetDefaultLanguage() {
+				return Encode("en");
+			}
+
+			static const char* GetProjectName() {
+				return Encode(ProjectName);
+			}
+
+			static float GetVolumeMultiplier() {
+				return VolumeMultiplier;
+			}
+
+			static void SetProjectName(const char* ProjectName) {
+				Application::ProjectName = ProjectName;
+			}
+
+			static void SetVolumeMultiplier(float Value) {
+				VolumeMultiplier = Value;
+			}
+		}
+
+		namespace ConsoleManager {
+			static bool IsRegisteredVariable(const char* Name) {
+				return Console::Variables.find(Name) != Console::Variables.end();
+			}
+
+			static Console::Variable* FindVariable(const char* Name) {
+				auto iterator = Console::Variables.find(Name);
+
+				return iterator != Console::Variables.end() ? iterator->second.get() : nullptr;
+			}
+
+			static Console::Variable* RegisterVariableBool(const char* Name, const char* Help, bool DefaultValue, bool ReadOnly) {
+				Console::Variable* variable = Console::Register(Name, Console::VariableType::Bool);
+
+				if (variable)
+					Console::Set(variable, DefaultValue ? "1" : "0");
+
+				return variable;
+			}
+
+			static Console::Variable* RegisterVariableInt(const char* Name, const char* Help, int32_t DefaultValue, bool ReadOnly) {
+				Console::Variable* variable = Console::Register(Name, Console::VariableType::Int);
+
+				if (variable)
+					Console::Set(variable, std::to_string(DefaultValue));
+
+				return variable;
+			}
+
+			static Console::Variable* RegisterVariableFloat(const char* Name, const char* Help, float DefaultValue, bool ReadOnly) {
+				Console::Variable* variable = Console::Register(Name, Console::VariableType::Float);
+
+				if (variable)
+					Console::Set(variable, std::to_string(DefaultValue));
+
+				return variable;
+			}
+
+			static Console::Variable* RegisterVariableString(const char* Name, const char* Help, const char* DefaultValue, bool ReadOnly) {
+				Console::Variable* variable = Console::Register(Name, Console::VariableType::String);
+
+				if (variable)
+					Console::Set(variable, DefaultValue);
+
+				return variable;
+			}
+
+			static void UnregisterObject(const char* Name) {
+				Console::Variables.erase(Name);
+			}
+		}
+
+		namespace Engine {
+			static float MaxFPS = 0.0f;
+
+			static uint32_t GetFrameNumber() {
+				return static_cast<uint32_t>(Clock::Frame);
+			}
+
+			static bool IsExitRequested() {
+				return Clock::ExitRequested;
+			}
+
+			static void GetViewportSize(Vector2* Value) {
+				*Value = { 1920.0f, 1080.0f };
+			}
+
+			static void GetScreenResolution(Vector2* Value) {
+				*Value = { 1920.0f, 1080.0f };
+			}
+
+			static int32_t GetWindowMode() {
+				// Windowed
+				return 2;
+			}
+
+			static const char* GetVersion() {
+				return Encode("Simulation");
+			}
+
+			static float GetMaxFPS() {
+				return MaxFPS;
+			}
+
+			static void SetMaxFPS(float MaxFPS) {
+				Engine::MaxFPS = MaxFPS;
+			}
+
+			static void ForceGarbageCollection(bool FullPurge) {
+				Scene::CollectGarbage();
+			}
+
+			static void RequestExit(bool Force) {
+				Clock::ExitRequested = true;
+			}
+		}
+
+		namespace World {
+			static bool SimulatePhysics;
+			static Vector3 WorldOrigin;
+
+			static bool GetSimulatePhysics() {
+				return SimulatePhysics;
+			}
+
+			static int32_t GetActorCount() {
+				return static_cast<int32_t>(Scene::Actors.size());
+			}
+
+			static float GetDeltaSeconds() {
+				return Clock::DeltaSeconds;
+			}
+
+			static float GetRealTimeSeconds() {
+				return static_cast<float>(Clock::Time);
+			}
+
+			static float GetTimeSeconds() {
+				return static_cast<float>(Clock::Time);
+			}
+
+			static void GetWorldOrigin(Vector3* Value) {
+				*Value = WorldOrigin;
+			}
+
+			static Scene::Actor* GetActor(const char* Name, ActorType Type) {
+				const Scene::Class* type = &Scene::ActorClasses[static_cast<int32_t>(Type)];
+				const uint32_t name = Name ? Names::Find(Name) : 0;
+
+				if (Name && name == 0)
+					return nullptr;
+
+				for (Scene::Actor* actor : Scene::Actors) {
+					if ((!Name || actor->Name == name) && Scene::IsA(actor->Type, type))
+						return actor;
+				}
+
+				return nullptr;
+			}
+
+			static Scene::Actor* GetActorByTag(const char* Tag, ActorType Type) {
+				const Scene::Class* type = &Scene::ActorClasses[static_cast<int32_t>(Type)];
+				const uint32_t tag = Names::Find(Tag);
+
+				for (Scene::Actor* actor : Scene::Actors) {
+					if (Scene::HasTag(actor, tag) && Scene::IsA(actor->Type, type))
+						return actor;
+				}
+
+				return nullptr;
+			}
+
+			static void SetSimulatePhysics(bool Value) {
+				SimulatePhysics = Value;
+			}
+
+			static void SetWorldOrigin(const Vector3* Value) {
+				WorldOrigin = *Value;
+			}
+		}
+
+		namespace ConsoleObject {
+			static bool IsBool(Console::Variable* ConsoleObject) {
+				return ConsoleObject->Type == Console::VariableType::Bool;
+			}
+
+			static bool IsInt(Console::Variable* ConsoleObject) {
+				return ConsoleObject->Type == Console::VariableType::Int;
+			}
+
+			static bool IsFloat(Console::Variable* ConsoleObject) {
+				return ConsoleObject->Type == Console::VariableType::Float;
+			}
+
+			static bool IsString(Console::Variable* ConsoleObject) {
+				return ConsoleObject->Type == Console::VariableType::String;
+			}
+		}
+
+		namespace ConsoleVariable {
+			static bool GetBool(Console::Variable* ConsoleVariable) {
+				return ConsoleVariable->Bool;
+			}
+
+			static int32_t GetInt(Console::Variable* ConsoleVariable) {
+				return ConsoleVariable->Int;
+			}
+
+			static float GetFloat(Console::Variable* ConsoleVariable) {
+				return ConsoleVariable->Float;
+			}
+
+			static const char* GetString(Console::Variable* ConsoleVariable) {
+				return Encode(ConsoleVariable->String);
+			}
+
+			static void SetBool(Console::Variable* ConsoleVariable, bool Value) {
+				Console::Set(ConsoleVariable, Value ? "1" : "0");
+			}
+
+			static void SetInt(Console::Variable* ConsoleVariable, int32_t Value) {
+				Console::Set(ConsoleVariable, std::to_string(Value));
+			}
+
+			static void SetFloat(Console::Variable* ConsoleVariable, float Value) {
+				Console::Set(ConsoleVariable, std::to_string(Value));
+			}
+
+			static void SetString(Console::Variable* ConsoleVariable, const char* Value) {
+				Console::Set(ConsoleVariable, Value);
+			}
+
+			static void SetOnChangedCallback(Console::Variable* ConsoleVariable, ConsoleVariableDelegate Function) {
+				ConsoleVariable->Callback = Function;
+			}
+
+			static void ClearOnChangedCallback(Console::Variable* ConsoleVariable) {
+				ConsoleVariable->Callback = nullptr;
+			}
+		}
+
+		namespace SceneComponent {
+			static bool IsAttachedToComponent(Scene::Component* SceneComponent, Scene::Component* Component) {
+				for (const Scene::Component* parent = SceneComponent->Parent; parent; parent = parent->Parent) {
+					if (parent == Component)
+						return true;
+				}
+
+				return false;
+			}
+
+			static bool IsAttachedToActor(Scene::Component* SceneComponent, Scene::Actor* Actor) {
+				return SceneComponent->Owner == Actor;
+			}
+
+			static Scene::Component* Create(Scene::Actor* Actor, ComponentType Type, const char* Name, bool SetAsRoot, void* Blueprint) {
+				if (Type < ComponentType::Scene)
+					return nullptr;
+
+				Scene::Component* component = Scene::Create(Actor, Type, Name);
+
+				if (!Actor->Root || SetAsRoot)
+					Actor->Root = component;
+				else
+					component->Parent = Actor->Root;
+
+				return component;
+			}
+
+			static bool AttachToComponent(Scene::Component* SceneComponent, Scene::Component* Parent, AttachmentTransformRule AttachmentRule, const char* SocketName) {
+				if (Parent == SceneComponent || IsAttachedToComponent(Parent, SceneComponent))
+					return false;
+
+				const Transform world = Scene::GetWorldTransform(SceneComponent);
+
+				SceneComponent->Parent = Parent;
+
+				Transform& relative = Scene::Transforms[SceneComponent->Slot];
+
+				if (AttachmentRule == AttachmentTransformRule::KeepWorldTransform) {
+					Scene::SetWorldTransform(SceneComponent, world);
+				} else if (AttachmentRule == AttachmentTransformRule::SnapToTargetIncludingScale) {
+					relative = Math::Identity;
+				} else if (AttachmentRule == AttachmentTransformRule::SnapToTargetNotIncludingScale) {
+					relative.Location = Math::Identity.Location;
+					relative.Rotation = Math::Identity.Rotation;
+				}
+
+				return true;
+			}
+
+			static void AddLocalOffset(Scene::Component* SceneComponent, const Vector3* DeltaLocation) {
+				Transform& relative = Scene::Transforms[SceneComponent->Slot];
+
+				relative.Location = Math::Add(relative.Location, Math::Rotate(relative.Rotation, *DeltaLocation));
+			}
+
+			static void AddLocalRotation(Scene::Component* SceneComponent, const Quaternion* DeltaRotation) {
+				Transform& relative = Scene::Transforms[SceneComponent->Slot];
+
+				relative.Rotation = Math::Multiply(relative.Rotation, *DeltaRotation);
+			}
+
+			static void AddRelativeLocation(Scene::Component* SceneComponent, const Vector3* DeltaLocation) {
+				Transform& relative = Scene::Transforms[SceneComponent->Slot];
+
+				relative.Location = Math::Add(relative.Location, *DeltaLocation);
+			}
+
+			static void AddRelativeRotation(Scene::Component* SceneComponent, const Quaternion* DeltaRotation) {
+				Transform& relative = Scene::Transforms[SceneComponent->Slot];
+
+				relative.Rotation = Math::Multiply(*DeltaRotation, relative.Rotation);
+			}
+
+			static void AddLocalTransform(Scene::Component* SceneComponent, const Transform* DeltaTransform) {
+				Transform& relative = Scene::Transforms[SceneComponent->Slot];
+
+				relative = Math::Compose(relative, *DeltaTransform);
+			}
+
+			static void AddWorldOffset(Scene::Component* SceneComponent, const Vector3* DeltaLocation) {
+				Transform world = Scene::GetWorldTransform(SceneComponent);
+
+				world.Location = Math::Add(world.Location, *DeltaLocation);
+
+				Scene::SetWorldTransform(SceneComponent, world);
+			}
+
+			static void AddWorldRotation(Scene::Component* SceneComponent, const Quaternion* DeltaRotation) {
+				Transform world = Scene::GetWorldTransform(SceneComponent);
+
+				world.Rotation = Math::Multiply(*DeltaRotation, world.Rotation);
+
+				Scene::SetWorldTransform(SceneComponent, world);
+			}
+
+			static void AddWorldTransform(Scene::Component* SceneComponent, const Transform* DeltaTransform) {
+				Transform world = Scene::GetWorldTransform(SceneComponent);
+
+				world.Location = Math::Add(world.Location, DeltaTransform->Location);
+				world.Rotation = Math::Multiply(DeltaTransform->Rotation, world.Rotation);
+
+				Scene::SetWorldTransform(SceneComponent, world);
+			}
+
+			static void GetComponentVelocity(Scene::Component* SceneComponent, Vector3* Value) {
+				*Value = { 0.0f, 0.0f, 0.0f };
+			}
+
+			static void GetComponentLocation(Scene::Component* SceneComponent, Vector3* Value) {
+				*Value = Scene::GetWorldTransform(SceneComponent).Location;
+			}
+
+			static void GetComponentRotation(Scene::Component* SceneComponent, Quaternion* Value) {
+				*Value = Scene::GetWorldTransform(SceneComponent).Rotation;
+			}
+
+			static void GetComponentScale(Scene::Component* SceneComponent, Vector3* Value) {
+				*Value = Scene::GetWorldTransform(SceneComponent).Scale;
+			}
+
+			static void GetComponentTransform(Scene::Component* SceneComponent, Transform* Value) {
+				*Value = Scene::GetWorldTransform(SceneComponent);
+			}
+
+			static void GetForwardVector(Scene::Component* SceneComponent, Vector3* Value) {
+				*Value = Math::Rotate(Scene::GetWorldTransform(SceneComponent).Rotation, { 1.0f, 0.0f, 0.0f });
+			}
+
+			static void GetRightVector(Scene::Component* SceneComponent, Vector3* Value) {
+				*Value = Math::Rotate(Scene::GetWorldTransform(SceneComponent).Rotation, { 0.0f, 1.0f, 0.0f });
+			}
+
+			static void GetUpVector(Scene::Component* SceneComponent, Vector3* Value) {
+				*Value = Math::Rotate(Scene::GetWorldTransform(SceneComponent).Rotation, { 0.0f, 0.0f, 1.0f });
+			}
+
+			static void SetMobility(Scene::Component* SceneComponent, ComponentMobility Mobility) {
+				SceneComponent->Mobility = Mobility;
+			}
+
+			static void SetRelativeLocation(Scene::Component* SceneComponent, const Vector3* Location) {
+				Scene::Transforms[SceneComponent->Slot].Location = *Location;
+			}
+
+			static void SetRelativeRotation(Scene::Component* SceneComponent, const Quaternion* Rotation) {
+				Scene::Transforms[SceneComponent->Slot].Rotation = *Rotation;
+			}
+
+			static void SetRelativeTransform(Scene::Component* SceneComponent, const Transform* Transform) {
+				Scene::Transforms[SceneComponent->Slot] = *Transform;
+			}
+
+			static void SetWorldLocation(Scene::Component* SceneComponent, const Vector3* Location) {
+				Transform world = Scene::GetWorldTransform(SceneComponent);
+
+				world.Location = *Location;
+
+				Scene::SetWorldTransform(SceneComponent, world);
+			}
+
+			static void SetWorldRotation(Scene::Component* SceneComponent, const Quaternion* Rotation) {
+				Transform world = Scene::GetWorldTransform(SceneComponent);
+
+				world.Rotation = *Rotation;
+
+				Scene::SetWorldTransform(SceneComponent, world);
+			}
+
+			static void SetWorldTransform(Scene::Component* SceneComponent, const Transform* Transform) {
+				Scene::SetWorldTransform(SceneComponent, *Transform);
+			}
+
+			static void GetComponentsLocations(Scene::Component** SceneComponents, int32_t Count, Vector3* Values) {
+				for (int32_t i = 0; i < Count; i++) {
+					Values[i] = Scene::GetWorldTransform(SceneComponents[i]).Location;
+				}
+			}
+
+			static void GetComponentsRotations(Scene::Component** SceneComponents, int32_t Count, Quaternion* Values) {
+				for (int32_t i = 0; i < Count; i++) {
+					Values[i] = Scene::GetWorldTransform(SceneComponents[i]).Rotation;
+				}
+			}
+
+			static void GetComponentsTransforms(Scene::Component** SceneComponents, int32_t Count, Transform* Values) {
+				for (int32_t i = 0; i < Count; i++) {
+					Values[i] = Scene::GetWorldTransform(SceneComponents[i]);
+				}
+			}
+		}
+
+		namespace Actor {
+			static bool IsPendingKill(Scene::Actor* Actor) {
+				return Scene::IsPendingKill(Actor);
+			}
+
+			static bool IsRootComponentMovable(Scene::Actor* Actor) {
+				return Actor->Root && Actor->Root->Mobility == ComponentMobility::Movable;
+			}
+
+			static Scene::Actor* Spawn(const char* Name, ActorType Type, void* Blueprint) {
+				return Scene::Spawn(Name, Type);
+			}
+
+			static bool Destroy(Scene::Actor* Actor) {
+				return Scene::Destroy(Actor);
+			}
+
+			static void Rename(Scene::Actor* Actor, const char* Name) {
+				Actor->Name = Names::Intern(Name);
+			}
+
+			static void Hide(Scene::Actor* Actor, bool Value) {
+				Actor->Hidden = Value;
+			}
+
+			static bool TeleportTo(Scene::Actor* Actor, const Vector3* DestinationLocation, const Quaternion* DestinationRotation, bool IsATest, bool NoCheck) {
+				if (!Actor->Root)
+					return false;
+
+				if (!IsATest) {
+					Transform world = Scene::GetWorldTransform(Actor->Root);
+
+					world.Location = *DestinationLocation;
+					world.Rotation = *DestinationRotation;
+
+					Scene::SetWorldTransform(Actor->Root, world);
+				}
+
+				return true;
+			}
+
+			static Scene::Component* GetComponent(Scene::Actor* Actor, const char* Name, ComponentType Type) {
+				const Scene::Class* type = &Scene::ComponentClasses[static_cast<int32_t>(Type)];
+				const uint32_t name = Name ? Names::Find(Name) : 0;
+
+				if (Name && name == 0)
+					return nullptr;
+
+				for (Scene::Component* component : Actor->Components) {
+					if ((!Name || component->Name == name) && Scene::IsA(component->Type, type))
+						return component;
+				}
+
+				return nullptr;
+			}
+
+			static Scene::Component* GetRootComponent(Scene::Actor* Actor, ComponentType Type) {
+				if (Actor->Root && Scene::IsA(Actor->Root->Type, &Scene::ComponentClasses[static_cast<int32_t>(Type)]))
+					return Actor->Root;
+
+				return nullptr;
+			}
+
+			static bool GetBlockInput(Scene::Actor* Actor) {
+				return Actor->BlockInput;
+			}
+
+			static float GetDistanceTo(Scene::Actor* Actor, Scene::Actor* Other) {
+				if (!Actor->Root || !Other->Root)
+					return 0.0f;
+
+				const Vector3 delta = Math::Subtract(Scene::GetWorldTransform(Other->Root).Location, Scene::GetWorldTransform(Actor->Root).Location);
+
+				return std::sqrt(delta.X * delta.X + delta.Y * delta.Y + delta.Z * delta.Z);
+			}
+
+			static void GetBounds(Scene::Actor* Actor, bool OnlyCollidingComponents, Vector3* Origin, Vector3* Extent) {
+				*Origin = Actor->Root ? Scene::GetWorldTransform(Actor->Root).Location : Math::Identity.Location;
+				*Extent = { 0.0f, 0.0f, 0.0f };
+			}
+
+			static bool SetRootComponent(Scene::Actor* Actor, Scene::Component* RootComponent) {
+				if (RootComponent->Owner != Actor)
+					return false;
+
+				RootComponent->Parent = nullptr;
+				Actor->Root = RootComponent;
+
+				return true;
+			}
+
+			static void SetBlockInput(Scene::Actor* Actor, bool Value) {
+				Actor->BlockInput = Value;
+			}
+
+			static void SetLifeSpan(Scene::Actor* Actor, float LifeSpan) {
+				Actor->LifeSpan = LifeSpan;
+			}
+
+			static void SetEnableCollision(Scene::Actor* Actor, bool Value) {
+				Actor->EnableCollision = Value;
+			}
+
+			static void AddTag(Scene::Actor* Actor, const char* Tag) {
+				Scene::AddTag(Actor, Tag);
+			}
+
+			static void RemoveTag(Scene::Actor* Actor, const char* Tag) {
+				Scene::RemoveTag(Actor, Tag);
+			}
+
+			static bool HasTag(Scene::Actor* Actor, const char* Tag) {
+				return Scene::HasTag(Actor, Names::Find(Tag));
+			}
+
+			static bool HasTagInterned(Scene::Actor* Actor, const InternedName* Tag) {
+				return Scene::HasTag(Actor, Tag->Id);
+			}
+
+			static int32_t GetComponents(Scene::Actor* Actor, ComponentType Type, Scene::Component** Components, int32_t Capacity) {
+				const Scene::Class* type = &Scene::ComponentClasses[static_cast<int32_t>(Type)];
+				int32_t count = 0;
+
+				for (Scene::Component* component : Actor->Components) {
+					if (!Scene::IsA(component->Type, type))
+						continue;
+
+					if (count < Capacity)
+						Components[count] = component;
+
+					count++;
+				}
+
+				return count;
+			}
+		}
+
+		namespace ActorComponent {
+			static Scene::Actor* GetOwner(Scene::Component* ActorComponent) {
+				return ActorComponent->Owner;
+			}
+
+			static void Destroy(Scene::Component* ActorComponent, bool PromoteChildren) {
+				Scene::Destroy(ActorComponent);
+			}
+
+			static void AddTag(Scene::Component* ActorComponent, const char* Tag) {
+				Scene::AddTag(ActorComponent, Tag);
+			}
+
+			static void RemoveTag(Scene::Component* ActorComponent, const char* Tag) {
+				Scene::RemoveTag(ActorComponent, Tag);
+			}
+
+			static bool HasTag(Scene::Component* ActorComponent, const char* Tag) {
+				return Scene::HasTag(ActorComponent, Names::Find(Tag));
+			}
+
+			static bool HasTagInterned(Scene::Component* ActorComponent, const InternedName* Tag) {
+				return Scene::HasTag(ActorComponent, Tag->Id);
+			}
+		}
+
+		namespace CommandBuffer {
+			// Physics commands have no effect since the scene is not simulated
+			static void Execute(const Command* Commands, int32_t Count) {
+				for (int32_t i = 0; i < Count; i++) {
+					const Command& current = Commands[i];
+
+					// Resolved as the plugin does, objects released by the garbage collection after recording are skipped
+					if (current.ObjectIndex < 0 || current.ObjectIndex >= static_cast<int32_t>(Scene::Items.size()))
+						continue;
+
+					const ObjectItem& item = Scene::Items[current.ObjectIndex];
+
+					if (!item.Object || item.SerialNumber != current.SerialNumber || (item.Flags & Scene::pendingKillFlag) != 0)
+						continue;
+
+					Scene::Component* component = static_cast<Scene::Component*>(item.Object);
+					Scene::Actor* actor = static_cast<Scene::Actor*>(item.Object);
+
+					switch (current.Type) {
+						case CommandType::AddLocalOffset:
+							SceneComponent::AddLocalOffset(component, current.Get<Vector3>());
+							break;
+
+						case CommandType::AddLocalRotation:
+							SceneComponent::AddLocalRotation(component, current.Get<Quaternion>());
+							break;
+
+						case CommandType::AddRelativeLocation:
+							SceneComponent::AddRelativeLocation(component, current.Get<Vector3>());
+							break;
+
+						case CommandType::AddRelativeRotation:
+							SceneComponent::AddRelativeRotation(component, current.Get<Quaternion>());
+							break;
+
+						case CommandType::AddLocalTransform:
+							SceneComponent::AddLocalTransform(component, current.Get<Transform>());
+							break;
+
+						case CommandType::AddWorldOffset:
+							SceneComponent::AddWorldOffset(component, current.Get<Vector3>());
+							break;
+
+						case CommandType::AddWorldRotation:
+							SceneComponent::AddWorldRotation(component, current.Get<Quaternion>());
+							break;
+
+						case CommandType::AddWorldTransform:
+							SceneComponent::AddWorldTransform(component, current.Get<Transform>());
+							break;
+
+						case CommandType::SetRelativeLocation:
+							SceneComponent::SetRelativeLocation(component, current.Get<Vector3>());
+							break;
+
+						case CommandType::SetRelativeRotation:
+							SceneComponent::SetRelativeRotation(component, current.Get<Quaternion>());
+							break;
+
+						case CommandType::SetRelativeTransform:
+							SceneComponent::SetRelativeTransform(component, current.Get<Transform>());
+							break;
+
+						case CommandType::SetWorldLocation:
+							SceneComponent::SetWorldLocation(component, current.Get<Vector3>());
+							break;
+
+						case CommandType::SetWorldRotation:
+							SceneComponent::SetWorldRotation(component, current.Get<Quaternion>());
+							break;
+
+						case CommandType::SetWorldTransform:
+							SceneComponent::SetWorldTransform(component, current.Get<Transform>());
+							break;
+
+						case CommandType::Hide:
+							Actor::Hide(actor, current.Flags != 0);
+							break;
+
+						case CommandType::SetEnableCollision:
+							Actor::SetEnableCollision(actor, current.Flags != 0);
+							break;
+
+						case CommandType::TeleportTo:
+							Actor::TeleportTo(actor, current.Get<Vector3>(), current.Get<Quaternion>(12), false, current.Flags != 0);
+							break;
+
+						default:
+							break;
+					}
+				}
+			}
+		}
+
+		namespace TickFunction {
+			static TickFunctions::Function* Register(TickExecuteDelegate Execute, TickDelegate Function, int32_t Group, float Interval, bool TickEvenWhenPaused) {
+				TickFunctions::Functions.emplace_back(new TickFunctions::Function { Execute, Function, Interval, 0.0f, true, true });
+
+				return TickFunctions::Functions.back().get();
+			}
+
+			static void Unregister(TickFunctions::Function* TickFunction) {
+				std::vector<std::unique_ptr<TickFunctions::Function>>& functions = TickFunctions::Functions;
+
+				for (size_t i = 0; i < functions.size(); i++) {
+					if (functions[i].get() == TickFunction) {
+						TickFunction->Registered = false;
+						TickFunctions::Removed.push_back(std::move(functions[i]));
+						functions.erase(functions.begin() + i);
+
+						break;
+					}
+				}
+			}
+
+			static bool IsRegistered(TickFunctions::Function* TickFunction) {
+				for (const std::unique_ptr<TickFunctions::Function>& function : TickFunctions::Functions) {
+					if (function.get() == TickFunction)
+						return true;
+				}
+
+				return false;
+			}
+
+			static bool IsEnabled(TickFunctions::Function* TickFunction) {
+				return TickFunction->Enabled;
+			}
+
+			static float GetInterval(TickFunctions::Function* TickFunction) {
+				return TickFunction->Interval;
+			}
+
+			static void SetEnabled(TickFunctions::Function* TickFunction, bool Value) {
+				TickFunction->Enabled = Value;
+			}
+
+			static void SetInterval(TickFunctions::Function* TickFunction, float Value) {
+				TickFunction->Interval = Value;
+			}
+		}
+
+		namespace GameThread {
+			static std::vector<DispatchDelegate> Dispatchers;
+
+			static void SetDispatcher(DispatchDelegate Function) {
+				if (std::find(Dispatchers.begin(), Dispatchers.end(), Function) == Dispatchers.end())
+					Dispatchers.push_back(Function);
+			}
+		}
+	}
+
+	// Table and entry indices generated from the shared layout, a function which is renamed or moved in the layout fails to bind at compile time
+
+	namespace Tables {
+		#define UNREALCLR_TABLE_BEGIN(Table) Table,
+		#define UNREALCLR_TABLE_ENTRY(Table, Function)
+		#define UNREALCLR_TABLE_END(Table)
+
+		enum : int32_t {
+			#include "../Native/Source/UnrealCLR/Public/UnrealCLRTables.inl"
+			Count
+		};
+
+		#undef UNREALCLR_TABLE_BEGIN
+		#undef UNREALCLR_TABLE_ENTRY
+		#undef UNREALCLR_TABLE_END
+	}
+
+	constexpr int32_t storageSize = 64;
+
+	namespace Entries {
+		#define UNREALCLR_TABLE_BEGIN(Table) namespace Table { enum : int32_t {
+		#define UNREALCLR_TABLE_ENTRY(Table, Function) Function,
+		#define UNREALCLR_TABLE_END(Table) Count }; static_assert(Count <= storageSize, "Table storage is exceeded"); }
+
+		#include "../Native/Source/UnrealCLR/Public/UnrealCLRTables.inl"
+
+		#undef UNREALCLR_TABLE_BEGIN
+		#undef UNREALCLR_TABLE_ENTRY
+		#undef UNREALCLR_TABLE_END
+	}
+
+	static void* Storage[Tables::Count][storageSize];
+	static void* Functions[Tables::Count];
+
+	// Entries which are not simulated return zero for scalars and null for pointers, floating-point values are returned in a different register and have their own stub
+	static void* Stub() {
+		return nullptr;
+	}
+
+	static float StubFloat() {
+		return 0.0f;
+	}
+
+	void** GetFunctions() {
+		if (Functions[0])
+			return Functions;
+
+		for (int32_t i = 0; i < Tables::Count; i++) {
+			for (int32_t j = 0; j < storageSize; j++) {
+				Storage[i][j] = (void*)&Stub;
+			}
+
+			Functions[i] = Storage[i];
+		}
+
+		#define SIMULATION_STUB(Table, Function, Stub) Storage[Tables::Table][Entries::Table::Function] = (void*)&Stub;
+
+		// Entries returning floating-point values which are not simulated, an entry which becomes simulated is bound below instead
+		SIMULATION_STUB(SoundBase, GetDuration, StubFloat);
+
+		SIMULATION_STUB(AnimationInstance, MontagePlay, StubFloat);
+
+		SIMULATION_STUB(PlayerInput, GetTimeKeyPressed, StubFloat);
+		SIMULATION_STUB(PlayerInput, GetTimeKeyPressedInterned, StubFloat);
+
+		SIMULATION_STUB(CameraComponent, GetAspectRatio, StubFloat);
+		SIMULATION_STUB(CameraComponent, GetFieldOfView, StubFloat);
+		SIMULATION_STUB(CameraComponent, GetOrthoFarClipPlane, StubFloat);
+		SIMULATION_STUB(CameraComponent, GetOrthoNearClipPlane, StubFloat);
+		SIMULATION_STUB(CameraComponent, GetOrthoWidth, StubFloat);
+
+		SIMULATION_STUB(PrimitiveComponent, GetMass, StubFloat);
+		SIMULATION_STUB(PrimitiveComponent, GetDistanceToCollision, StubFloat);
+		SIMULATION_STUB(PrimitiveComponent, GetAngularDamping, StubFloat);
+		SIMULATION_STUB(PrimitiveComponent, GetLinearDamping, StubFloat);
+
+		SIMULATION_STUB(SphereComponent, GetScaledSphereRadius, StubFloat);
+		SIMULATION_STUB(SphereComponent, GetUnscaledSphereRadius, StubFloat);
+		SIMULATION_STUB(SphereComponent, GetShapeScale, StubFloat);
+
+		SIMULATION_STUB(CapsuleComponent, GetScaledCapsuleRadius, StubFloat);
+		SIMULATION_STUB(CapsuleComponent, GetUnscaledCapsuleRadius, StubFloat);
+		SIMULATION_STUB(CapsuleComponent, GetShapeScale, StubFloat);
+
+		SIMULATION_STUB(LightComponentBase, GetIntensity, StubFloat);
+
+		#undef SIMULATION_STUB
+
+		#define SIMULATION_BIND(Table, Function) Storage[Tables::Table][Entries::Table::Function] = (void*)&Framework::Table::Function;
+
+		SIMULATION_BIND(CommandLine, Get);
+		SIMULATION_BIND(CommandLine, Set);
+		SIMULATION_BIND(CommandLine, Append);
+
+		SIMULATION_BIND(Debug, Log);
+		SIMULATION_BIND(Debug, HandleException);
+		SIMULATION_BIND(Debug, AddOnScreenMessage);
+		SIMULATION_BIND(Debug, GetLogBuffer);
+
+		SIMULATION_BIND(Object, IsPendingKill);
+		SIMULATION_BIND(Object, IsValid);
+		SIMULATION_BIND(Object, Rename);
+		SIMULATION_BIND(Object, GetName);
+		SIMULATION_BIND(Object, GetBool);
+		SIMULATION_BIND(Object, GetInt);
+		SIMULATION_BIND(Object, GetFloat);
+		SIMULATION_BIND(Object, SetBool);
+		SIMULATION_BIND(Object, SetInt);
+		SIMULATION_BIND(Object, SetFloat);
+		SIMULATION_BIND(Object, GetBoolInterned);
+		SIMULATION_BIND(Object, GetIntInterned);
+		SIMULATION_BIND(Object, GetFloatInterned);
+		SIMULATION_BIND(Object, SetBoolInterned);
+		SIMULATION_BIND(Object, SetIntInterned);
+		SIMULATION_BIND(Object, SetFloatInterned);
+		SIMULATION_BIND(Object, GetItem);
+		SIMULATION_BIND(Object, GetPropertyHandle);
+
+		SIMULATION_BIND(Name, Create);
+		SIMULATION_BIND(Name, GetString);
+
+		SIMULATION_BIND(Application, GetProjectDirectory);
+		SIMULATION_BIND(Application, GetDefaultLanguage);
+		SIMULATION_BIND(Application, GetProjectName);
+		SIMULATION_BIND(Application, GetVolumeMultiplier);
+		SIMULATION_BIND(Application, SetProjectName);
+		SIMULATION_BIND(Application, SetVolumeMultiplier);
+
+		SIMULATION_BIND(ConsoleManager, IsRegisteredVariable);
+		SIMULATION_BIND(ConsoleManager, FindVariable);
+		SIMULATION_BIND(ConsoleManager, RegisterVariableBool);
+		SIMULATION_BIND(ConsoleManager, RegisterVariableInt);
+		SIMULATION_BIND(ConsoleManager, RegisterVariableFloat);
+		SIMULATION_BIND(ConsoleManager, RegisterVariableString);
+		SIMULATION_BIND(ConsoleManager, UnregisterObject);
+
+		SIMULATION_BIND(Engine, GetFrameNumber);
+		SIMULATION_BIND(Engine, IsExitRequested);
+		SIMULATION_BIND(Engine, GetViewportSize);
+		SIMULATION_BIND(Engine, GetScreenResolution);
+		SIMULATION_BIND(Engine, GetWindowMode);
+		SIMULATION_BIND(Engine, GetVersion);
+		SIMULATION_BIND(Engine, GetMaxFPS);
+		SIMULATION_BIND(Engine, SetMaxFPS);
+		SIMULATION_BIND(Engine, ForceGarbageCollection);
+		SIMULATION_BIND(Engine, RequestExit);
+
+		SIMULATION_BIND(World, GetSimulatePhysics);
+		SIMULATION_BIND(World, GetActorCount);
+		SIMULATION_BIND(World, GetDeltaSeconds);
+		SIMULATION_BIND(World, GetRealTimeSeconds);
+		SIMULATION_BIND(World, GetTimeSeconds);
+		SIMULATION_BIND(World, GetWorldOrigin);
+		SIMULATION_BIND(World, GetActor);
+		SIMULATION_BIND(World, GetActorByTag);
+		SIMULATION_BIND(World, SetSimulatePhysics);
+		SIMULATION_BIND(World, SetWorldOrigin);
+
+		SIMULATION_BIND(ConsoleObject, IsBool);
+		SIMULATION_BIND(ConsoleObject, IsInt);
+		SIMULATION_BIND(ConsoleObject, IsFloat);
+		SIMULATION_BIND(ConsoleObject, IsString);
+
+		SIMULATION_BIND(ConsoleVariable, GetBool);
+		SIMULATION_BIND(ConsoleVariable, GetInt);
+		SIMULATION_BIND(ConsoleVariable, GetFloat);
+		SIMULATION_BIND(ConsoleVariable, GetString);
+		SIMULATION_BIND(ConsoleVariable, SetBool);
+		SIMULATION_BIND(ConsoleVariable, SetInt);
+		SIMULATION_BIND(ConsoleVariable, SetFloat);
+		SIMULATION_BIND(ConsoleVariable, SetString);
+		SIMULATION_BIND(ConsoleVariable, SetOnChangedCallback);
+		SIMULATION_BIND(ConsoleVariable, ClearOnChangedCallback);
+
+		SIMULATION_BIND(Actor, IsPendingKill);
+		SIMULATION_BIND(Actor, IsRootComponentMovable);
+		SIMULATION_BIND(Actor, Spawn);
+		SIMULATION_BIND(Actor, Destroy);
+		SIMULATION_BIND(Actor, Rename);
+		SIMULATION_BIND(Actor, Hide);
+		SIMULATION_BIND(Actor, TeleportTo);
+		SIMULATION_BIND(Actor, GetComponent);
+		SIMULATION_BIND(Actor, GetRootComponent);
+		SIMULATION_BIND(Actor, GetBlockInput);
+		SIMULATION_BIND(Actor, GetDistanceTo);
+		SIMULATION_BIND(Actor, GetBounds);
+		SIMULATION_BIND(Actor, SetRootComponent);
+		SIMULATION_BIND(Actor, SetBlockInput);
+		SIMULATION_BIND(Actor, SetLifeSpan);
+		SIMULATION_BIND(Actor, SetEnableCollision);
+		SIMULATION_BIND(Actor, AddTag);
+		SIMULATION_BIND(Actor, RemoveTag);
+		SIMULATION_BIND(Actor, HasTag);
+		SIMULATION_BIND(Actor, HasTagInterned);
+		SIMULATION_BIND(Actor, GetComponents);
+
+		SIMULATION_BIND(ActorComponent, GetOwner);
+		SIMULATION_BIND(ActorComponent, Destroy);
+		SIMULATION_BIND(ActorComponent, AddTag);
+		SIMULATION_BIND(ActorComponent, RemoveTag);
+		SIMULATION_BIND(ActorComponent, HasTag);
+		SIMULATION_BIND(ActorComponent, HasTagInterned);
+
+		SIMULATION_BIND(SceneComponent, IsAttachedToComponent);
+		SIMULATION_BIND(SceneComponent, IsAttachedToActor);
+		SIMULATION_BIND(SceneComponent, Create);
+		SIMULATION_BIND(SceneComponent, AttachToComponent);
+		SIMULATION_BIND(SceneComponent, AddLocalOffset);
+		SIMULATION_BIND(SceneComponent, AddLocalRotation);
+		SIMULATION_BIND(SceneComponent, AddRelativeLocation);
+		SIMULATION_BIND(SceneComponent, AddRelativeRotation);
+		SIMULATION_BIND(SceneComponent, AddLocalTransform);
+		SIMULATION_BIND(SceneComponent, AddWorldOffset);
+		SIMULATION_BIND(SceneComponent, AddWorldRotation);
+		SIMULATION_BIND(SceneComponent, AddWorldTransform);
+		SIMULATION_BIND(SceneComponent, GetComponentVelocity);
+		SIMULATION_BIND(SceneComponent, GetComponentLocation);
+		SIMULATION_BIND(SceneComponent, GetComponentRotation);
+		SIMULATION_BIND(SceneComponent, GetComponentScale);
+		SIMULATION_BIND(SceneComponent, GetComponentTransform);
+		SIMULATION_BIND(SceneComponent, GetForwardVector);
+		SIMULATION_BIND(SceneComponent, GetRightVector);
+		SIMULATION_BIND(SceneComponent, GetUpVector);
+		SIMULATION_BIND(SceneComponent, SetMobility);
+		SIMULATION_BIND(SceneComponent, SetRelativeLocation);
+		SIMULATION_BIND(SceneComponent, SetRelativeRotation);
+		SIMULATION_BIND(SceneComponent, SetRelativeTransform);
+		SIMULATION_BIND(SceneComponent, SetWorldLocation);
+		SIMULATION_BIND(SceneComponent, SetWorldRotation);
+		SIMULATION_BIND(SceneComponent, SetWorldTransform);
+		SIMULATION_BIND(SceneComponent, GetComponentsLocations);
+		SIMULATION_BIND(SceneComponent, GetComponentsRotations);
+		SIMULATION_BIND(SceneComponent, GetComponentsTransforms);
+
+		SIMULATION_BIND(CommandBuffer, Execute);
+
+		SIMULATION_BIND(TickFunction, Register);
+		SIMULATION_BIND(TickFunction, Unregister);
+		SIMULATION_BIND(TickFunction, IsRegistered);
+		SIMULATION_BIND(TickFunction, IsEnabled);
+		SIMULATION_BIND(TickFunction, GetInterval);
+		SIMULATION_BIND(TickFunction, SetEnabled);
+		SIMULATION_BIND(TickFunction, SetInterval);
+
+		SIMULATION_BIND(GameThread, SetDispatcher);
+
+		#undef SIMULATION_BIND
+
+		Scene::InitializeClasses();
+
+		return Functions;
+	}
+
+	void Initialize(const char* ProjectDirectory, float DeltaSeconds) {
+		Framework::Application::ProjectDirectory = std::string(ProjectDirectory) + "/";
+		Clock::DeltaSeconds = DeltaSeconds;
+	}
+
+	// Advances the clock with a fixed step for deterministic results and performs the per-frame work of the plugin
+	void BeginFrame() {
+		Clock::Frame++;
+		Clock::Time += Clock::DeltaSeconds;
+
+		TickFunctions::Removed.clear();
+		Logger::Drain();
+
+		for (size_t i = 0; i < Framework::GameThread::Dispatchers.size(); i++) {
+			Framework::GameThread::Dispatchers[i]();
+		}
+
+		TickFunctions::Execute();
+
+		for (size_t i = Scene::Actors.size(); i > 0; i--) {
+			Scene::Actor* actor = Scene::Actors[i - 1];
+
+			if (actor->LifeSpan > 0.0f && (actor->LifeSpan -= Clock::DeltaSeconds) <= 0.0f)
+				Scene::Destroy(actor);
+		}
+
+		if (Clock::Frame % Clock::garbageCollectionInterval == 0)
+			Scene::CollectGarbage();
+	}
+
+	// Releases the scene and the state of the play session as the plugin does on world cleanup
+	void EndPlay() {
+		Logger::Drain();
+
+		while (!Scene::Actors.empty()) {
+			Scene::Destroy(Scene::Actors.back());
+		}
+
+		Scene::CollectGarbage();
+		TickFunctions::Functions.clear();
+		TickFunctions::Removed.clear();
+		Console::Variables.clear();
+		Framework::GameThread::Dispatchers.clear();
+		Clock::ExitRequested = false;
+	}
+
+	bool IsExitRequested() {
+		return Clock::ExitRequested;
+	}
+
+	int32_t GetActorCount() {
+		return static_cast<int32_t>(Scene::Actors.size());
+	}
+
+	int32_t GetErrors() {
+		return Errors;
+	}
+}
\ No newline at end of file
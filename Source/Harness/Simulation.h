@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2020 Stanislav Denisov (nxrighthere@gmail.com)
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU Lesser General Public License
+ * (LGPL) version 3 with a static linking exception which accompanies this
+ * distribution.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// Simulated world backend, implements the shared function tables against an in-memory scene instead of the engine
+namespace Simulation {
+	// Returns the function tables in the layout of UnrealCLRTables.inl, entries which are not simulated are stubs returning zero
+	void** GetFunctions();
+
+	void Initialize(const char* ProjectDirectory, float DeltaSeconds);
+	void BeginFrame();
+	void EndPlay();
+
+	bool IsExitRequested();
+	int32_t GetActorCount();
+	int32_t GetErrors();
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Drawing;
+using System.Globalization;
+using System.IO;
+using System.Reflection;
+using System.Reflection.PortableExecutable;
+using System.Runtime.InteropServices;
+using System.Text.Json;
+using UnrealEngine.Framework;
+using Debug = UnrealEngine.Framework.Debug;
+
+namespace UnrealEngine.Benchmarks {
+	internal sealed class BenchmarkRunner {
+		private const int warmupIterations = 100;
+		private const int batchSize = 10;
+		private readonly string system;
+		private readonly int frames;
+		private readonly List<Benchmark> benchmarks = new List<Benchmark>();
+		private int current;
+		private int frame;
+
+		private sealed class Benchmark {
+			internal string table;
+			internal string name;
+			internal Action action;
+			internal int iterations;
+			internal double[] samples;
+			internal int sampleCount;
+			internal long allocatedBytes;
+		}
+
+		public BenchmarkRunner(string system, int frames = 60) {
+			this.system = system;
+			this.frames = frames;
+		}
+
+		public bool IsCompleted => current == benchmarks.Count;
+
+		public void Add(string table, string name, Action action, int iterationsPerFrame = 10000) {
+			int iterations = Math.Max(iterationsPerFrame / batchSize, 1) * batchSize;
+
+			benchmarks.Add(new Benchmark {
+				table = table,
+				name = name,
+				action = action,
+				iterations = iterations,
+				samples = new double[(iterations / batchSize) * frames]
+			});
+		}
+
+		// Measures one benchmark per frame for the specified number of frames, the samples are averaged over small batches since single calls are below the timer resolution
+		public void Tick() {
+			if (IsCompleted)
+				return;
+
+			Benchmark benchmark = benchmarks[current];
+			Action action = benchmark.action;
+
+			if (frame == 0) {
+				for (int i = 0; i < warmupIterations; i++) {
+					action();
+				}
+			}
+
+			double nanosecondsPerTick = 1000000000.0 / Stopwatch.Frequency / batchSize;
+			long allocatedBytes = GC.GetAllocatedBytesForCurrentThread();
+
+			for (int i = 0; i < benchmark.iterations; i += batchSize) {
+				long timestamp = Stopwatch.GetTimestamp();
+
+				for (int j = 0; j < batchSize; j++) {
+					action();
+				}
+
+				benchmark.samples[benchmark.sampleCount++] = (Stopwatch.GetTimestamp() - timestamp) * nanosecondsPerTick;
+			}
+
+			benchmark.allocatedBytes += GC.GetAllocatedBytesForCurrentThread() - allocatedBytes;
+
+			if (++frame < frames)
+				return;
+
+			Array.Sort(benchmark.samples, 0, benchmark.sampleCount);
+
+			Debug.Log(LogLevel.Display, benchmark.table + "." + benchmark.name + " call cost: " + Format(Mean(benchmark)) + " ns, p99: " + Format(Percentile(benchmark, 0.99)) + " ns, allocated: " + Format(AllocatedBytesPerCall(benchmark)) + " bytes per call");
+
+			frame = 0;
+
+			if (++current == benchmarks.Count) {
+				string path = Write();
+
+				Debug.Log(LogLevel.Display, system + " results are written to " + path);
+				Debug.AddOnScreenMessage(-1, 10.0f, Color.MediumTurquoise, system + " completed! Verify results in " + path);
+			}
+		}
+
+		private string Write() {
+			string path = CreatePath(system);
+
+			using (FileStream stream = File.Create(path)) {
+				using (Utf8JsonWriter writer = new Utf8JsonWriter(stream, new JsonWriterOptions { Indented = true })) {
+					writer.WriteStartObject();
+					WriteEnvironment(writer, system);
+					writer.WriteNumber("frames", frames);
+					writer.WriteNumber("batchSize", batchSize);
+					writer.WriteStartArray("results");
+
+					foreach (Benchmark benchmark in benchmarks) {
+						writer.WriteStartObject();
+						writer.WriteString("table", benchmark.table);
+						writer.WriteString("name", benchmark.name);
+						writer.WriteNumber("iterationsPerFrame", benchmark.iterations);
+						writer.WriteNumber("mean", Round(Mean(benchmark)));
+						writer.WriteNumber("min", Round(benchmark.samples[0]));
+						writer.WriteNumber("p50", Round(Percentile(benchmark, 0.5)));
+						writer.WriteNumber("p90", Round(Percentile(benchmark, 0.9)));
+						writer.WriteNumber("p99", Round(Percentile(benchmark, 0.99)));
+						writer.WriteNumber("max", Round(benchmark.samples[benchmark.sampleCount - 1]));
+						writer.WriteNumber("allocatedBytesPerCall", Round(AllocatedBytesPerCall(benchmark)));
+						writer.WriteEndObject();
+					}
+
+					writer.WriteEndArray();
+					writer.WriteEndObject();
+				}
+			}
+
+			return path;
+		}
+
+		internal static string CreatePath(string system) {
+			string directory = Path.Combine(Application.ProjectDirectory, "Saved", "Benchmarks");
+
+			Directory.CreateDirectory(directory);
+
+			return Path.Combine(directory, system + "-" + DateTime.Now.ToString("yyyyMMdd-HHmmss", CultureInfo.InvariantCulture) + ".json");
+		}
+
+		internal static void WriteEnvironment(Utf8JsonWriter writer, string system) {
+			Type shared = typeof(Actor).Assembly.GetType("UnrealEngine.Framework.Shared");
+
+			writer.WriteString("system", system);
+			writer.WriteString("date", DateTime.UtcNow);
+			writer.WriteString("engine", Engine.Version);
+			writer.WriteString("runtime", RuntimeInformation.FrameworkDescription);
+			writer.WriteString("platform", RuntimeInformation.OSDescription);
+			writer.WriteNumber("processors", Environment.ProcessorCount);
+			writer.WriteBoolean("blittableFunctions", (bool)shared.GetField("blittableFunctions", BindingFlags.NonPublic | BindingFlags.Static).GetValue(null));
+			writer.WriteBoolean("interopStatistics", InteropStatistics.IsEnabled);
+			writer.WriteBoolean("readyToRunFramework", IsReadyToRun(typeof(Actor).Assembly));
+			writer.WriteBoolean("readyToRunBenchmarks", IsReadyToRun(typeof(BenchmarkRunner).Assembly));
+		}
+
+		// Images precompiled with ReadyToRun carry a native header in addition to IL
+		internal static bool IsReadyToRun(Assembly assembly) {
+			using (PEReader reader = new PEReader(File.OpenRead(assembly.Location))) {
+				return reader.PEHeaders.CorHeader.ManagedNativeHeaderDirectory.Size > 0;
+			}
+		}
+
+		private static double Mean(Benchmark benchmark) {
+			double sum = 0.0;
+
+			for (int i = 0; i < benchmark.sampleCount; i++) {
+				sum += benchmark.samples[i];
+			}
+
+			return sum / benchmark.sampleCount;
+		}
+
+		private static double AllocatedBytesPerCall(Benchmark benchmark) => (double)benchmark.allocatedBytes / ((long)benchmark.sampleCount * batchSize);
+
+		private static double Percentile(Benchmark benchmark, double percentile) => benchmark.samples[Math.Min((int)Math.Ceiling(percentile * benchmark.sampleCount) - 1, benchmark.sampleCount - 1)];
+
+		private static double Round(double value) => Math.Round(value, 2);
+
+		private static string Format(double value) => value.ToString("F1", CultureInfo.InvariantCulture);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+using System;
+using UnrealEngine.Framework;
+using Debug = UnrealEngine.Framework.Debug;
+
+namespace UnrealEngine.Benchmarks {
+	public static class LifetimeBenchmarks {
+		private static Actor actor = new Actor("LifetimeBenchmarkActor");
+		private static SceneComponent sceneComponent = new SceneComponent(actor, setAsRoot: true);
+		private static BenchmarkRunner runner = new BenchmarkRunner(nameof(LifetimeBenchmarks), 30);
+
+		public static void OnBeginPlay() {
+			Debug.Log(LogLevel.Display, "Starting " + nameof(LifetimeBenchmarks) + "...");
+
+			runner.Add("Actor", "Spawn and destroy", () => new Actor().Destroy(), 100);
+			runner.Add("SceneComponent", "Create and destroy", () => new SceneComponent(actor).Destroy(), 100);
+			runner.Add("World", "GetActor", () => World.GetActor<Actor>("LifetimeBenchmarkActor"), 1000);
+			runner.Add("Actor", "GetRootComponent", () => actor.GetRootComponent<SceneComponent>(), 1000);
+		}
+
+		public static void OnEndPlay() {
+			actor.Destroy();
+			Debug.ClearOnScreenMessages();
+		}
+
+		public static void OnTick() => runner.Tick();
+	}
+}
\ No newline at end of file
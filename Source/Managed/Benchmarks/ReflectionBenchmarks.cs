@@ -0,0 +1,33 @@
+using System;
+using UnrealEngine.Framework;
+using Debug = UnrealEngine.Framework.Debug;
+
+namespace UnrealEngine.Benchmarks {
+	public static class ReflectionBenchmarks {
+		private static Actor actor = new Actor("ReflectionBenchmarkActor");
+		private static SceneComponent sceneComponent = new SceneComponent(actor, setAsRoot: true);
+		private static Name lifeSpanName = new Name("InitialLifeSpan");
+		private static PropertyHandle lifeSpanHandle = actor.GetPropertyHandle("InitialLifeSpan");
+		private static float lifeSpan = 0.0f;
+		private static BenchmarkRunner runner = new BenchmarkRunner(nameof(ReflectionBenchmarks));
+
+		public static void OnBeginPlay() {
+			Debug.Log(LogLevel.Display, "Starting " + nameof(ReflectionBenchmarks) + "...");
+
+			runner.Add("Object", "GetFloat(string)", () => actor.GetFloat("InitialLifeSpan", ref lifeSpan));
+			runner.Add("Object", "GetFloat(Name)", () => actor.GetFloat(lifeSpanName, ref lifeSpan));
+			runner.Add("Object", "GetFloat(PropertyHandle)", () => actor.GetFloat(lifeSpanHandle, ref lifeSpan));
+			runner.Add("Object", "SetFloat(string)", () => actor.SetFloat("InitialLifeSpan", 0.0f));
+			runner.Add("Object", "SetFloat(Name)", () => actor.SetFloat(lifeSpanName, 0.0f));
+			runner.Add("Object", "SetFloat(PropertyHandle)", () => actor.SetFloat(lifeSpanHandle, 0.0f));
+			runner.Add("Object", "GetPropertyHandle", () => actor.GetPropertyHandle("InitialLifeSpan"), 1000);
+		}
+
+		public static void OnEndPlay() {
+			actor.Destroy();
+			Debug.ClearOnScreenMessages();
+		}
+
+		public static void OnTick() => runner.Tick();
+	}
+}
\ No newline at end of file
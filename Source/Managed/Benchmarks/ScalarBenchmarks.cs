@@ -0,0 +1,33 @@
+using System;
+using UnrealEngine.Framework;
+using Debug = UnrealEngine.Framework.Debug;
+
+namespace UnrealEngine.Benchmarks {
+	public static class ScalarBenchmarks {
+		private static Actor actor = new Actor("ScalarBenchmarkActor");
+		private static SceneComponent sceneComponent = new SceneComponent(actor, setAsRoot: true);
+		private static ConsoleVariable consoleVariable = ConsoleManager.RegisterVariable("Benchmarks.ScalarVariable", "Scalar benchmark variable", 0);
+		private static BenchmarkRunner runner = new BenchmarkRunner(nameof(ScalarBenchmarks));
+
+		public static void OnBeginPlay() {
+			Debug.Log(LogLevel.Display, "Starting " + nameof(ScalarBenchmarks) + "...");
+
+			runner.Add("Engine", "FrameNumber", () => _ = Engine.FrameNumber);
+			runner.Add("Engine", "IsSplitScreen", () => _ = Engine.IsSplitScreen);
+			runner.Add("World", "DeltaTime", () => _ = World.DeltaTime);
+			runner.Add("World", "RealTime", () => _ = World.RealTime);
+			runner.Add("Application", "IsCanEverRender", () => _ = Application.IsCanEverRender);
+			runner.Add("Actor", "IsRootComponentMovable", () => _ = actor.IsRootComponentMovable);
+			runner.Add("ConsoleVariable", "GetInt", () => _ = consoleVariable.GetInt());
+			runner.Add("ConsoleVariable", "SetInt", () => consoleVariable.SetInt(1));
+		}
+
+		public static void OnEndPlay() {
+			ConsoleManager.UnregisterObject("Benchmarks.ScalarVariable");
+			actor.Destroy();
+			Debug.ClearOnScreenMessages();
+		}
+
+		public static void OnTick() => runner.Tick();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+using System;
+using System.Diagnostics;
+using System.Drawing;
+using System.Globalization;
+using System.IO;
+using System.Numerics;
+using System.Text.Json;
+using UnrealEngine.Framework;
+using Debug = UnrealEngine.Framework.Debug;
+
+namespace UnrealEngine.Benchmarks {
+	// Measures the startup of a system in a single play session, compare the results of assemblies published with and without ReadyToRun
+	public static class StartupBenchmarks {
+		private static double[] tickTimes = new double[2];
+		private static long beginPlay;
+		private static double beginPlayTime;
+		private static double timeToFirstTick;
+		private static int ticks;
+		private static TickFunction tickFunction;
+		private static Actor actor;
+		private static SceneComponent sceneComponent;
+
+		public static void OnBeginPlay() {
+			beginPlay = Stopwatch.GetTimestamp();
+
+			actor = new Actor("StartupBenchmarkActor");
+			sceneComponent = new SceneComponent(actor, setAsRoot: true);
+			tickFunction = TickFunction.Register(OnStartupTick);
+			beginPlayTime = Milliseconds(beginPlay, Stopwatch.GetTimestamp());
+
+			Debug.Log(LogLevel.Display, "Starting " + nameof(StartupBenchmarks) + "...");
+		}
+
+		public static void OnEndPlay() {
+			if (tickFunction.IsCreated)
+				tickFunction.Unregister();
+
+			actor.Destroy();
+			Debug.ClearOnScreenMessages();
+		}
+
+		// The first tick pays for compilation of the tick body and the framework functions it calls unless they are precompiled, the second one is the steady state
+		private static void OnStartupTick(float deltaTime) {
+			long timestamp = Stopwatch.GetTimestamp();
+
+			if (ticks == 0)
+				timeToFirstTick = Milliseconds(beginPlay, timestamp);
+
+			Update(deltaTime);
+
+			tickTimes[ticks] = Milliseconds(timestamp, Stopwatch.GetTimestamp());
+
+			if (++ticks < tickTimes.Length)
+				return;
+
+			tickFunction.Unregister();
+
+			Debug.Log(LogLevel.Display, "Time to first tick: " + Format(timeToFirstTick) + " ms, begin play: " + Format(beginPlayTime) + " ms, first tick: " + Format(tickTimes[0]) + " ms, second tick: " + Format(tickTimes[1]) + " ms");
+
+			string path = Write();
+
+			Debug.Log(LogLevel.Display, nameof(StartupBenchmarks) + " results are written to " + path);
+			Debug.AddOnScreenMessage(-1, 10.0f, Color.MediumTurquoise, nameof(StartupBenchmarks) + " completed! Verify results in " + path);
+		}
+
+		private static void Update(float deltaTime) {
+			Vector3 location = default;
+
+			sceneComponent.GetLocation(ref location);
+			sceneComponent.SetRelativeLocation(location + Vector3.UnitZ * deltaTime);
+			sceneComponent.AddLocalRotation(Quaternion.CreateFromYawPitchRoll(deltaTime, 0.0f, 0.0f));
+
+			_ = actor.Name;
+			_ = World.GetActor<Actor>("StartupBenchmarkActor");
+		}
+
+		private static string Write() {
+			string path = BenchmarkRunner.CreatePath(nameof(StartupBenchmarks));
+
+			using (FileStream stream = File.Create(path)) {
+				using (Utf8JsonWriter writer = new Utf8JsonWriter(stream, new JsonWriterOptions { Indented = true })) {
+					writer.WriteStartObject();
+					BenchmarkRunner.WriteEnvironment(writer, nameof(StartupBenchmarks));
+					writer.WriteNumber("timeToFirstTick", Round(timeToFirstTick));
+					writer.WriteNumber("beginPlay", Round(beginPlayTime));
+					writer.WriteNumber("firstTick", Round(tickTimes[0]));
+					writer.WriteNumber("secondTick", Round(tickTimes[1]));
+					writer.WriteEndObject();
+				}
+			}
+
+			return path;
+		}
+
+		private static double Milliseconds(long start, long end) => (end - start) * 1000.0 / Stopwatch.Frequency;
+
+		private static double Round(double value) => Math.Round(value, 3);
+
+		private static string Format(double value) => value.ToString("F3", CultureInfo.InvariantCulture);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+using System;
+using UnrealEngine.Framework;
+using Debug = UnrealEngine.Framework.Debug;
+
+namespace UnrealEngine.Benchmarks {
+	public static class StringBenchmarks {
+		private static Actor actor = new Actor("StringBenchmarkActor");
+		private static SceneComponent sceneComponent = new SceneComponent(actor, "StringBenchmarkComponent", setAsRoot: true);
+		private static ConsoleVariable consoleVariable = ConsoleManager.RegisterVariable("Benchmarks.StringVariable", "String benchmark variable", "Value");
+		private static Name benchmarkTag = new Name("BenchmarkTag");
+		private static char[] nameBuffer = new char[256];
+		private static BenchmarkRunner runner = new BenchmarkRunner(nameof(StringBenchmarks));
+
+		public static void OnBeginPlay() {
+			Debug.Log(LogLevel.Display, "Starting " + nameof(StringBenchmarks) + "...");
+
+			actor.AddTag("BenchmarkTag");
+
+			runner.Add("Actor", "HasTag(string)", () => actor.HasTag("BenchmarkTag"));
+			runner.Add("Actor", "HasTag(Name)", () => actor.HasTag(benchmarkTag));
+			runner.Add("Actor", "AddTag", () => actor.AddTag("TemporaryTag"));
+			runner.Add("Actor", "RemoveTag", () => actor.RemoveTag("TemporaryTag"));
+			runner.Add("Actor", "Name", () => _ = actor.Name);
+			runner.Add("Actor", "TryGetName", () => actor.TryGetName(nameBuffer, out _));
+			runner.Add("ConsoleVariable", "SetString", () => consoleVariable.SetString("Value"));
+			runner.Add("ConsoleVariable", "GetString", () => _ = consoleVariable.GetString());
+			runner.Add("CommandLine", "Get", () => _ = CommandLine.Get(), 1000);
+		}
+
+		public static void OnEndPlay() {
+			ConsoleManager.UnregisterObject("Benchmarks.StringVariable");
+			actor.Destroy();
+			Debug.ClearOnScreenMessages();
+		}
+
+		public static void OnTick() => runner.Tick();
+	}
+}
\ No newline at end of file
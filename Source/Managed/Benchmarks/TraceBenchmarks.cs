@@ -0,0 +1,148 @@
+using System;
+using System.Diagnostics;
+using System.Drawing;
+using System.Globalization;
+using System.IO;
+using System.Text.Json;
+using UnrealEngine.Framework;
+using Debug = UnrealEngine.Framework.Debug;
+
+namespace UnrealEngine.Benchmarks {
+	public static class TraceBenchmarks {
+		private const int passes = 10;
+		private static InteropTrace trace;
+		private static string tracePath;
+		private static double[,] samples;
+		private static int[] skipped;
+		private static int pass;
+		private static int frame;
+
+		public static void OnBeginPlay() {
+			Debug.Log(LogLevel.Display, "Starting " + nameof(TraceBenchmarks) + "...");
+
+			string directory = Path.Combine(Application.ProjectDirectory, "Saved", "Traces");
+
+			if (Directory.Exists(directory)) {
+				foreach (string path in Directory.GetFiles(directory, "*.trace")) {
+					if (tracePath == null || File.GetLastWriteTimeUtc(path) > File.GetLastWriteTimeUtc(tracePath))
+						tracePath = path;
+				}
+			}
+
+			if (tracePath == null) {
+				Debug.Log(LogLevel.Warning, "No interop traces found in " + directory + ", record one with " + nameof(InteropRecorder));
+
+				return;
+			}
+
+			trace = InteropTrace.Load(tracePath);
+			samples = new double[trace.FrameCount, passes];
+			skipped = new int[trace.FrameCount];
+
+			Debug.Log(LogLevel.Display, "Replaying " + trace.FrameCount + " frames with " + trace.CallCount + " calls from " + tracePath);
+		}
+
+		public static void OnEndPlay() => Debug.ClearOnScreenMessages();
+
+		// Replays one recorded frame per frame, the trace is replayed from the beginning after each pass and the first pass is a warmup
+		public static void OnTick() {
+			if (trace == null || pass > passes)
+				return;
+
+			long timestamp = Stopwatch.GetTimestamp();
+			int skippedCalls = trace.Replay(frame);
+			double microseconds = (Stopwatch.GetTimestamp() - timestamp) * 1000000.0 / Stopwatch.Frequency;
+
+			if (pass > 0) {
+				samples[frame, pass - 1] = microseconds;
+				skipped[frame] = skippedCalls;
+			}
+
+			if (++frame < trace.FrameCount)
+				return;
+
+			// Actors and components created by the pass are destroyed, so each pass replays against the same world, the garbage is collected at the end of this frame before the next pass
+			frame = 0;
+			trace.Reset();
+			Engine.ForceGarbageCollection();
+
+			if (++pass <= passes)
+				return;
+
+			double total = 0.0;
+			int worst = 0;
+
+			for (int i = 0; i < trace.FrameCount; i++) {
+				total += Mean(i);
+
+				if (Mean(i) > Mean(worst))
+					worst = i;
+			}
+
+			Debug.Log(LogLevel.Display, "Trace replay cost: " + Format(total / trace.FrameCount) + " us per frame, worst frame " + trace.GetFrameNumber(worst) + ": " + Format(Mean(worst)) + " us for " + trace.GetCallCount(worst) + " calls");
+
+			string path = Write();
+
+			Debug.Log(LogLevel.Display, nameof(TraceBenchmarks) + " results are written to " + path);
+			Debug.AddOnScreenMessage(-1, 10.0f, Color.MediumTurquoise, nameof(TraceBenchmarks) + " completed! Verify results in " + path);
+		}
+
+		private static string Write() {
+			string directory = Path.Combine(Application.ProjectDirectory, "Saved", "Benchmarks");
+			string path = Path.Combine(directory, nameof(TraceBenchmarks) + "-" + DateTime.Now.ToString("yyyyMMdd-HHmmss", CultureInfo.InvariantCulture) + ".json");
+
+			Directory.CreateDirectory(directory);
+
+			using (FileStream stream = File.Create(path)) {
+				using (Utf8JsonWriter writer = new Utf8JsonWriter(stream, new JsonWriterOptions { Indented = true })) {
+					writer.WriteStartObject();
+					writer.WriteString("system", nameof(TraceBenchmarks));
+					writer.WriteString("date", DateTime.UtcNow);
+					writer.WriteString("engine", Engine.Version);
+					writer.WriteString("trace", Path.GetFileName(tracePath));
+					writer.WriteNumber("passes", passes);
+					writer.WriteStartArray("frames");
+
+					for (int i = 0; i < trace.FrameCount; i++) {
+						double min = double.MaxValue;
+						double max = 0.0;
+
+						for (int j = 0; j < passes; j++) {
+							min = Math.Min(min, samples[i, j]);
+							max = Math.Max(max, samples[i, j]);
+						}
+
+						writer.WriteStartObject();
+						writer.WriteNumber("frame", trace.GetFrameNumber(i));
+						writer.WriteNumber("calls", trace.GetCallCount(i));
+						writer.WriteNumber("skippedCalls", skipped[i]);
+						writer.WriteNumber("recorded", Round(trace.GetRecordedTime(i) * 1000.0));
+						writer.WriteNumber("mean", Round(Mean(i)));
+						writer.WriteNumber("min", Round(min));
+						writer.WriteNumber("max", Round(max));
+						writer.WriteEndObject();
+					}
+
+					writer.WriteEndArray();
+					writer.WriteEndObject();
+				}
+			}
+
+			return path;
+		}
+
+		private static double Mean(int frame) {
+			double sum = 0.0;
+
+			for (int i = 0; i < passes; i++) {
+				sum += samples[frame, i];
+			}
+
+			return sum / passes;
+		}
+
+		private static double Round(double value) => Math.Round(value, 2);
+
+		private static string Format(double value) => value.ToString("F1", CultureInfo.InvariantCulture);
+	}
+}
\ No newline at end of file
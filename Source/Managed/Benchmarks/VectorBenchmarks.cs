@@ -0,0 +1,31 @@
+using System;
+using System.Numerics;
+using UnrealEngine.Framework;
+using Debug = UnrealEngine.Framework.Debug;
+
+namespace UnrealEngine.Benchmarks {
+	public static class VectorBenchmarks {
+		private static Actor actor = new Actor("VectorBenchmarkActor");
+		private static SceneComponent sceneComponent = new SceneComponent(actor, setAsRoot: true);
+		private static Vector3 location = default(Vector3);
+		private static Transform transform = default(Transform);
+		private static BenchmarkRunner runner = new BenchmarkRunner(nameof(VectorBenchmarks));
+
+		public static void OnBeginPlay() {
+			Debug.Log(LogLevel.Display, "Starting " + nameof(VectorBenchmarks) + "...");
+
+			runner.Add("SceneComponent", "GetLocation", () => sceneComponent.GetLocation(ref location));
+			runner.Add("SceneComponent", "GetTransform", () => sceneComponent.GetTransform(ref transform));
+			runner.Add("SceneComponent", "SetRelativeLocation", () => sceneComponent.SetRelativeLocation(location));
+			runner.Add("SceneComponent", "SetWorldLocation", () => sceneComponent.SetWorldLocation(location));
+			runner.Add("SceneComponent", "AddLocalOffset", () => sceneComponent.AddLocalOffset(Vector3.Zero));
+		}
+
+		public static void OnEndPlay() {
+			actor.Destroy();
+			Debug.ClearOnScreenMessages();
+		}
+
+		public static void OnTick() => runner.Tick();
+	}
+}
\ No newline at end of file
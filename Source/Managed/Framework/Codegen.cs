@@ -13,6 +13,9 @@
  */
 
 using System;
+using System.Buffers;
+using System.Diagnostics;
+using System.IO;
 using System.Numerics;
 using System.Reflection;
 using System.Reflection.Emit;
@@ -24,12 +27,30 @@ namespace UnrealEngine.Framework {
 	// Automatically generated
 
 	internal static class Shared {
+		#if BLITTABLE_FUNCTIONS
+			internal const bool blittableFunctions = true;
+		#else
+			internal const bool blittableFunctions = false;
+		#endif
+
+		#if INTEROP_STATISTICS
+			internal const bool interopStatistics = true;
+		#else
+			internal const bool interopStatistics = false;
+		#endif
+
+		#if INTEROP_RECORDING
+			internal const bool interopRecording = true;
+		#else
+			internal const bool interopRecording = false;
+		#endif
+
 		private static bool loaded;
 
 		internal static unsafe void Load(IntPtr functions) {
 			if (!loaded) {
 				try {
-					int position = 0;
+					int position = 0;
 					IntPtr* buffer = (IntPtr*)functions;
 
 					unchecked {
@@ -64,6 +85,7 @@ namespace UnrealEngine.Framework {
 						Debug.drawLine = GenerateOptimizedFunction<Debug.DrawLineFunction>(debugFunctions[head++]);
 						Debug.drawPoint = GenerateOptimizedFunction<Debug.DrawPointFunction>(debugFunctions[head++]);
 						Debug.flushPersistentLines = GenerateOptimizedFunction<Debug.FlushPersistentLinesFunction>(debugFunctions[head++]);
+						Debug.getLogBuffer = GenerateOptimizedFunction<Debug.GetLogBufferFunction>(debugFunctions[head++]);
 					}
 
 					unchecked {
@@ -97,6 +119,42 @@ namespace UnrealEngine.Framework {
 						Object.setFloat = GenerateOptimizedFunction<Object.SetFloatFunction>(objectFunctions[head++]);
 						Object.setDouble = GenerateOptimizedFunction<Object.SetDoubleFunction>(objectFunctions[head++]);
 						Object.setText = GenerateOptimizedFunction<Object.SetTextFunction>(objectFunctions[head++]);
+						Object.getBoolInterned = GenerateOptimizedFunction<Object.GetBoolInternedFunction>(objectFunctions[head++]);
+						Object.getByteInterned = GenerateOptimizedFunction<Object.GetByteInternedFunction>(objectFunctions[head++]);
+						Object.getShortInterned = GenerateOptimizedFunction<Object.GetShortInternedFunction>(objectFunctions[head++]);
+						Object.getIntInterned = GenerateOptimizedFunction<Object.GetIntInternedFunction>(objectFunctions[head++]);
+						Object.getLongInterned = GenerateOptimizedFunction<Object.GetLongInternedFunction>(objectFunctions[head++]);
+						Object.getUShortInterned = GenerateOptimizedFunction<Object.GetUShortInternedFunction>(objectFunctions[head++]);
+						Object.getUIntInterned = GenerateOptimizedFunction<Object.GetUIntInternedFunction>(objectFunctions[head++]);
+						Object.getULongInterned = GenerateOptimizedFunction<Object.GetULongInternedFunction>(objectFunctions[head++]);
+						Object.getFloatInterned = GenerateOptimizedFunction<Object.GetFloatInternedFunction>(objectFunctions[head++]);
+						Object.getDoubleInterned = GenerateOptimizedFunction<Object.GetDoubleInternedFunction>(objectFunctions[head++]);
+						Object.getTextInterned = GenerateOptimizedFunction<Object.GetTextInternedFunction>(objectFunctions[head++]);
+						Object.setBoolInterned = GenerateOptimizedFunction<Object.SetBoolInternedFunction>(objectFunctions[head++]);
+						Object.setByteInterned = GenerateOptimizedFunction<Object.SetByteInternedFunction>(objectFunctions[head++]);
+						Object.setShortInterned = GenerateOptimizedFunction<Object.SetShortInternedFunction>(objectFunctions[head++]);
+						Object.setIntInterned = GenerateOptimizedFunction<Object.SetIntInternedFunction>(objectFunctions[head++]);
+						Object.setLongInterned = GenerateOptimizedFunction<Object.SetLongInternedFunction>(objectFunctions[head++]);
+						Object.setUShortInterned = GenerateOptimizedFunction<Object.SetUShortInternedFunction>(objectFunctions[head++]);
+						Object.setUIntInterned = GenerateOptimizedFunction<Object.SetUIntInternedFunction>(objectFunctions[head++]);
+						Object.setULongInterned = GenerateOptimizedFunction<Object.SetULongInternedFunction>(objectFunctions[head++]);
+						Object.setFloatInterned = GenerateOptimizedFunction<Object.SetFloatInternedFunction>(objectFunctions[head++]);
+						Object.setDoubleInterned = GenerateOptimizedFunction<Object.SetDoubleInternedFunction>(objectFunctions[head++]);
+						Object.setTextInterned = GenerateOptimizedFunction<Object.SetTextInternedFunction>(objectFunctions[head++]);
+						Object.getItem = GenerateOptimizedFunction<Object.GetItemFunction>(objectFunctions[head++]);
+						Object.getPropertyHandle = GenerateOptimizedFunction<Object.GetPropertyHandleFunction>(objectFunctions[head++]);
+						Object.getTextByHandle = GenerateOptimizedFunction<Object.GetTextByHandleFunction>(objectFunctions[head++]);
+						Object.setTextByHandle = GenerateOptimizedFunction<Object.SetTextByHandleFunction>(objectFunctions[head++]);
+						Object.loadAsync = GenerateOptimizedFunction<Object.LoadAsyncFunction>(objectFunctions[head++]);
+						Object.cancelLoadAsync = GenerateOptimizedFunction<Object.CancelLoadAsyncFunction>(objectFunctions[head++]);
+					}
+
+					unchecked {
+						int head = 0;
+						IntPtr* nameFunctions = (IntPtr*)buffer[position++];
+
+						Name.create = GenerateOptimizedFunction<Name.CreateFunction>(nameFunctions[head++]);
+						Name.getString = GenerateOptimizedFunction<Name.GetStringFunction>(nameFunctions[head++]);
 					}
 
 					unchecked {
@@ -230,6 +288,8 @@ namespace UnrealEngine.Framework {
 						Actor.addTag = GenerateOptimizedFunction<Actor.AddTagFunction>(actorFunctions[head++]);
 						Actor.removeTag = GenerateOptimizedFunction<Actor.RemoveTagFunction>(actorFunctions[head++]);
 						Actor.hasTag = GenerateOptimizedFunction<Actor.HasTagFunction>(actorFunctions[head++]);
+						Actor.hasTagInterned = GenerateOptimizedFunction<Actor.HasTagInternedFunction>(actorFunctions[head++]);
+						Actor.getComponents = GenerateOptimizedFunction<Actor.GetComponentsFunction>(actorFunctions[head++]);
 					}
 
 					unchecked {
@@ -332,6 +392,8 @@ namespace UnrealEngine.Framework {
 						PlayerInput.getTimeKeyPressed = GenerateOptimizedFunction<PlayerInput.GetTimeKeyPressedFunction>(playerInputFunctions[head++]);
 						PlayerInput.getMouseSensitivity = GenerateOptimizedFunction<PlayerInput.GetMouseSensitivityFunction>(playerInputFunctions[head++]);
 						PlayerInput.setMouseSensitivity = GenerateOptimizedFunction<PlayerInput.SetMouseSensitivityFunction>(playerInputFunctions[head++]);
+						PlayerInput.isKeyPressedInterned = GenerateOptimizedFunction<PlayerInput.IsKeyPressedInternedFunction>(playerInputFunctions[head++]);
+						PlayerInput.getTimeKeyPressedInterned = GenerateOptimizedFunction<PlayerInput.GetTimeKeyPressedInternedFunction>(playerInputFunctions[head++]);
 					}
 
 					unchecked {
@@ -351,6 +413,7 @@ namespace UnrealEngine.Framework {
 						ActorComponent.addTag = GenerateOptimizedFunction<ActorComponent.AddTagFunction>(actorComponentFunctions[head++]);
 						ActorComponent.removeTag = GenerateOptimizedFunction<ActorComponent.RemoveTagFunction>(actorComponentFunctions[head++]);
 						ActorComponent.hasTag = GenerateOptimizedFunction<ActorComponent.HasTagFunction>(actorComponentFunctions[head++]);
+						ActorComponent.hasTagInterned = GenerateOptimizedFunction<ActorComponent.HasTagInternedFunction>(actorComponentFunctions[head++]);
 					}
 
 					unchecked {
@@ -401,6 +464,9 @@ namespace UnrealEngine.Framework {
 						SceneComponent.setWorldLocation = GenerateOptimizedFunction<SceneComponent.SetWorldLocationFunction>(sceneComponentFunctions[head++]);
 						SceneComponent.setWorldRotation = GenerateOptimizedFunction<SceneComponent.SetWorldRotationFunction>(sceneComponentFunctions[head++]);
 						SceneComponent.setWorldTransform = GenerateOptimizedFunction<SceneComponent.SetWorldTransformFunction>(sceneComponentFunctions[head++]);
+						SceneComponent.getComponentsLocations = GenerateOptimizedFunction<SceneComponent.GetComponentsLocationsFunction>(sceneComponentFunctions[head++]);
+						SceneComponent.getComponentsRotations = GenerateOptimizedFunction<SceneComponent.GetComponentsRotationsFunction>(sceneComponentFunctions[head++]);
+						SceneComponent.getComponentsTransforms = GenerateOptimizedFunction<SceneComponent.GetComponentsTransformsFunction>(sceneComponentFunctions[head++]);
 					}
 
 					unchecked {
@@ -471,6 +537,15 @@ namespace UnrealEngine.Framework {
 						PrimitiveComponent.setEnableGravity = GenerateOptimizedFunction<PrimitiveComponent.SetEnableGravityFunction>(primitiveComponentFunctions[head++]);
 						PrimitiveComponent.setCollisionMode = GenerateOptimizedFunction<PrimitiveComponent.SetCollisionModeFunction>(primitiveComponentFunctions[head++]);
 						PrimitiveComponent.createAndSetMaterialInstanceDynamic = GenerateOptimizedFunction<PrimitiveComponent.CreateAndSetMaterialInstanceDynamicFunction>(primitiveComponentFunctions[head++]);
+						PrimitiveComponent.addAngularImpulseInDegreesInterned = GenerateOptimizedFunction<PrimitiveComponent.AddAngularImpulseInDegreesInternedFunction>(primitiveComponentFunctions[head++]);
+						PrimitiveComponent.addAngularImpulseInRadiansInterned = GenerateOptimizedFunction<PrimitiveComponent.AddAngularImpulseInRadiansInternedFunction>(primitiveComponentFunctions[head++]);
+						PrimitiveComponent.addForceInterned = GenerateOptimizedFunction<PrimitiveComponent.AddForceInternedFunction>(primitiveComponentFunctions[head++]);
+						PrimitiveComponent.addForceAtLocationInterned = GenerateOptimizedFunction<PrimitiveComponent.AddForceAtLocationInternedFunction>(primitiveComponentFunctions[head++]);
+						PrimitiveComponent.addImpulseInterned = GenerateOptimizedFunction<PrimitiveComponent.AddImpulseInternedFunction>(primitiveComponentFunctions[head++]);
+						PrimitiveComponent.addImpulseAtLocationInterned = GenerateOptimizedFunction<PrimitiveComponent.AddImpulseAtLocationInternedFunction>(primitiveComponentFunctions[head++]);
+						PrimitiveComponent.addTorqueInDegreesInterned = GenerateOptimizedFunction<PrimitiveComponent.AddTorqueInDegreesInternedFunction>(primitiveComponentFunctions[head++]);
+						PrimitiveComponent.addTorqueInRadiansInterned = GenerateOptimizedFunction<PrimitiveComponent.AddTorqueInRadiansInternedFunction>(primitiveComponentFunctions[head++]);
+						PrimitiveComponent.setMassInterned = GenerateOptimizedFunction<PrimitiveComponent.SetMassInternedFunction>(primitiveComponentFunctions[head++]);
 					}
 
 					unchecked {
@@ -565,6 +640,9 @@ namespace UnrealEngine.Framework {
 						InstancedStaticMeshComponent.addInstance = GenerateOptimizedFunction<InstancedStaticMeshComponent.AddInstanceFunction>(instancedStaticMeshComponentFunctions[head++]);
 						InstancedStaticMeshComponent.updateInstanceTransform = GenerateOptimizedFunction<InstancedStaticMeshComponent.UpdateInstanceTransformFunction>(instancedStaticMeshComponentFunctions[head++]);
 						InstancedStaticMeshComponent.clearInstances = GenerateOptimizedFunction<InstancedStaticMeshComponent.ClearInstancesFunction>(instancedStaticMeshComponentFunctions[head++]);
+						InstancedStaticMeshComponent.addInstances = GenerateOptimizedFunction<InstancedStaticMeshComponent.AddInstancesFunction>(instancedStaticMeshComponentFunctions[head++]);
+						InstancedStaticMeshComponent.updateInstanceTransforms = GenerateOptimizedFunction<InstancedStaticMeshComponent.UpdateInstanceTransformsFunction>(instancedStaticMeshComponentFunctions[head++]);
+						InstancedStaticMeshComponent.removeInstances = GenerateOptimizedFunction<InstancedStaticMeshComponent.RemoveInstancesFunction>(instancedStaticMeshComponentFunctions[head++]);
 					}
 
 					unchecked {
@@ -616,8 +694,62 @@ namespace UnrealEngine.Framework {
 						MaterialInstanceDynamic.setTextureParameterValue = GenerateOptimizedFunction<MaterialInstanceDynamic.SetTextureParameterValueFunction>(materialInstanceDynamicFunctions[head++]);
 						MaterialInstanceDynamic.setVectorParameterValue = GenerateOptimizedFunction<MaterialInstanceDynamic.SetVectorParameterValueFunction>(materialInstanceDynamicFunctions[head++]);
 						MaterialInstanceDynamic.setScalarParameterValue = GenerateOptimizedFunction<MaterialInstanceDynamic.SetScalarParameterValueFunction>(materialInstanceDynamicFunctions[head++]);
+						MaterialInstanceDynamic.setTextureParameterValueInterned = GenerateOptimizedFunction<MaterialInstanceDynamic.SetTextureParameterValueInternedFunction>(materialInstanceDynamicFunctions[head++]);
+						MaterialInstanceDynamic.setVectorParameterValueInterned = GenerateOptimizedFunction<MaterialInstanceDynamic.SetVectorParameterValueInternedFunction>(materialInstanceDynamicFunctions[head++]);
+						MaterialInstanceDynamic.setScalarParameterValueInterned = GenerateOptimizedFunction<MaterialInstanceDynamic.SetScalarParameterValueInternedFunction>(materialInstanceDynamicFunctions[head++]);
+					}
+
+					unchecked {
+						int head = 0;
+						IntPtr* commandBufferFunctions = (IntPtr*)buffer[position++];
+
+						CommandBuffer.execute = GenerateOptimizedFunction<CommandBuffer.ExecuteFunction>(commandBufferFunctions[head++]);
+					}
+
+					unchecked {
+						int head = 0;
+						IntPtr* tickFunctionFunctions = (IntPtr*)buffer[position++];
+
+						TickFunction.register = GenerateOptimizedFunction<TickFunction.RegisterFunction>(tickFunctionFunctions[head++]);
+						TickFunction.unregister = GenerateOptimizedFunction<TickFunction.UnregisterFunction>(tickFunctionFunctions[head++]);
+						TickFunction.isRegistered = GenerateOptimizedFunction<TickFunction.IsRegisteredFunction>(tickFunctionFunctions[head++]);
+						TickFunction.isEnabled = GenerateOptimizedFunction<TickFunction.IsEnabledFunction>(tickFunctionFunctions[head++]);
+						TickFunction.getInterval = GenerateOptimizedFunction<TickFunction.GetIntervalFunction>(tickFunctionFunctions[head++]);
+						TickFunction.setEnabled = GenerateOptimizedFunction<TickFunction.SetEnabledFunction>(tickFunctionFunctions[head++]);
+						TickFunction.setInterval = GenerateOptimizedFunction<TickFunction.SetIntervalFunction>(tickFunctionFunctions[head++]);
+						TickFunction.addPrerequisite = GenerateOptimizedFunction<TickFunction.AddPrerequisiteFunction>(tickFunctionFunctions[head++]);
+						TickFunction.addActorPrerequisite = GenerateOptimizedFunction<TickFunction.AddActorPrerequisiteFunction>(tickFunctionFunctions[head++]);
+						TickFunction.addComponentPrerequisite = GenerateOptimizedFunction<TickFunction.AddComponentPrerequisiteFunction>(tickFunctionFunctions[head++]);
+						TickFunction.removePrerequisite = GenerateOptimizedFunction<TickFunction.RemovePrerequisiteFunction>(tickFunctionFunctions[head++]);
+						TickFunction.removeActorPrerequisite = GenerateOptimizedFunction<TickFunction.RemoveActorPrerequisiteFunction>(tickFunctionFunctions[head++]);
+						TickFunction.removeComponentPrerequisite = GenerateOptimizedFunction<TickFunction.RemoveComponentPrerequisiteFunction>(tickFunctionFunctions[head++]);
+					}
+
+					unchecked {
+						int head = 0;
+						IntPtr* gameThreadFunctions = (IntPtr*)buffer[position++];
+
+						GameThread.setDispatcher = GenerateOptimizedFunction<GameThread.SetDispatcherFunction>(gameThreadFunctions[head++]);
 					}
 
+					unchecked {
+						int head = 0;
+						IntPtr* statisticsFunctions = (IntPtr*)buffer[position++];
+
+						InteropStatistics.register = GenerateOptimizedFunction<InteropStatistics.RegisterFunction>(statisticsFunctions[head++]);
+					}
+
+					GameThread.Initialize();
+					Logger.Initialize(Debug.getLogBuffer());
+
+					#if INTEROP_STATISTICS
+						InteropStatistics.Initialize();
+					#endif
+
+					#if INTEROP_RECORDING
+						InteropRecorder.Initialize();
+					#endif
+
 					loaded = true;
 				}
 
@@ -646,17 +778,286 @@ namespace UnrealEngine.Framework {
 			DynamicMethod dynamicMethod = new DynamicMethod(method.Name, method.ReturnType, parameterTypes, Assembly.GetExecutingAssembly().ManifestModule);
 			ILGenerator generator = dynamicMethod.GetILGenerator();
 
+			dynamicMethod.InitLocals = false;
+
+			#if JOB_SAFETY_CHECKS
+				generator.Emit(OpCodes.Call, typeof(JobScheduler).GetMethod(nameof(JobScheduler.VerifyEngineAccess), BindingFlags.Static | BindingFlags.NonPublic));
+			#endif
+
+			#if GAME_THREAD_CHECKS
+				generator.Emit(OpCodes.Call, typeof(GameThread).GetMethod(nameof(GameThread.VerifyAccess), BindingFlags.Static | BindingFlags.NonPublic));
+			#endif
+
+			#if INTEROP_STATISTICS
+				IntPtr counter = InteropStatistics.Allocate(type);
+				LocalBuilder timestamp = generator.DeclareLocal(typeof(long));
+
+				generator.Emit(OpCodes.Call, typeof(Stopwatch).GetMethod(nameof(Stopwatch.GetTimestamp)));
+				generator.Emit(OpCodes.Stloc, timestamp);
+			#endif
+
+			#if INTEROP_RECORDING
+				LocalBuilder call = generator.DeclareLocal(typeof(int));
+				Label skipArguments = generator.DefineLabel();
+
+				generator.Emit(OpCodes.Ldc_I4, InteropRecorder.Register(type));
+				generator.Emit(OpCodes.Call, typeof(InteropRecorder).GetMethod(nameof(InteropRecorder.Begin), BindingFlags.Static | BindingFlags.NonPublic));
+				generator.Emit(OpCodes.Dup);
+				generator.Emit(OpCodes.Stloc, call);
+				generator.Emit(OpCodes.Ldc_I4_0);
+				generator.Emit(OpCodes.Blt, skipArguments);
+				EmitRecording(generator, parameterTypes);
+				generator.MarkLabel(skipArguments);
+			#endif
+
+			EmitCall(generator, pointer, method.ReturnType, parameterTypes);
+
+			#if INTEROP_RECORDING
+				Label skipResult = generator.DefineLabel();
+
+				generator.Emit(OpCodes.Ldloc, call);
+				generator.Emit(OpCodes.Ldc_I4_0);
+				generator.Emit(OpCodes.Blt, skipResult);
+
+				if (method.ReturnType == typeof(IntPtr) && !method.ReturnParameter.IsDefined(typeof(EncodedStringAttribute), false)) {
+					generator.Emit(OpCodes.Dup);
+					generator.Emit(OpCodes.Ldloc, call);
+					generator.Emit(OpCodes.Call, typeof(InteropRecorder).GetMethod(nameof(InteropRecorder.End), BindingFlags.Static | BindingFlags.NonPublic, null, new Type[] { typeof(IntPtr), typeof(int) }, null));
+				} else {
+					generator.Emit(OpCodes.Call, typeof(InteropRecorder).GetMethod(nameof(InteropRecorder.End), BindingFlags.Static | BindingFlags.NonPublic, null, Type.EmptyTypes, null));
+				}
+
+				generator.MarkLabel(skipResult);
+			#endif
+
+			#if INTEROP_STATISTICS
+				generator.Emit(OpCodes.Ldc_I8, counter.ToInt64());
+				generator.Emit(OpCodes.Conv_I);
+				generator.Emit(OpCodes.Ldloc, timestamp);
+				generator.Emit(OpCodes.Call, typeof(InteropStatistics).GetMethod(nameof(InteropStatistics.Record), BindingFlags.Static | BindingFlags.NonPublic));
+			#endif
+
+			generator.Emit(OpCodes.Ret);
+
+			return dynamicMethod.CreateDelegate(type) as TDelegate;
+		}
+
+		// Generates an indirect call of a static managed function, the first parameter of the delegate is the function pointer
+		internal static TDelegate GenerateManagedFunction<TDelegate>() where TDelegate : class {
+			Type type = typeof(TDelegate);
+			MethodInfo method = type.GetMethod("Invoke");
+			ParameterInfo[] parameterInfos = method.GetParameters();
+			Type[] parameterTypes = new Type[parameterInfos.Length];
+			Type[] argumentTypes = new Type[parameterInfos.Length - 1];
+
 			for (int i = 0; i < parameterTypes.Length; i++) {
+				parameterTypes[i] = parameterInfos[i].ParameterType;
+			}
+
+			Array.Copy(parameterTypes, 1, argumentTypes, 0, argumentTypes.Length);
+
+			DynamicMethod dynamicMethod = new DynamicMethod(method.Name, method.ReturnType, parameterTypes, Assembly.GetExecutingAssembly().ManifestModule);
+			ILGenerator generator = dynamicMethod.GetILGenerator();
+
+			dynamicMethod.InitLocals = false;
+
+			for (int i = 1; i < parameterTypes.Length; i++) {
 				generator.Emit(OpCodes.Ldarg, i);
 			}
 
-			generator.Emit(OpCodes.Ldc_I8, pointer.ToInt64());
-			generator.Emit(OpCodes.Conv_I);
-			generator.EmitCalli(OpCodes.Calli, CallingConvention.Cdecl, method.ReturnType, parameterTypes);
+			generator.Emit(OpCodes.Ldarg_0);
+			generator.EmitCalli(OpCodes.Calli, CallingConventions.Standard, method.ReturnType, argumentTypes, null);
 			generator.Emit(OpCodes.Ret);
 
 			return dynamicMethod.CreateDelegate(type) as TDelegate;
 		}
+
+		#if INTEROP_RECORDING
+			// Arguments are written before the call, so the values passed by reference are recorded as inputs
+			private static void EmitRecording(ILGenerator generator, Type[] parameterTypes) {
+				for (int i = 0; i < parameterTypes.Length; i++) {
+					Type parameterType = parameterTypes[i];
+					InteropRecorder.Argument argument = InteropRecorder.GetArgument(parameterType, out _);
+
+					if (argument == InteropRecorder.Argument.Value) {
+						generator.Emit(OpCodes.Ldarg, i);
+						generator.Emit(OpCodes.Call, typeof(InteropRecorder).GetMethod(nameof(InteropRecorder.WriteValue), BindingFlags.Static | BindingFlags.NonPublic).MakeGenericMethod(parameterType.GetElementType()));
+
+						continue;
+					}
+
+					if (parameterType == typeof(Bool)) {
+						generator.Emit(OpCodes.Ldarga, i);
+						generator.Emit(OpCodes.Ldind_U1);
+					} else {
+						generator.Emit(OpCodes.Ldarg, i);
+					}
+
+					generator.Emit(OpCodes.Call, typeof(InteropRecorder).GetMethod("Write" + argument, BindingFlags.Static | BindingFlags.NonPublic));
+				}
+			}
+		#endif
+
+		private static void EmitCall(ILGenerator generator, IntPtr pointer, Type returnType, Type[] parameterTypes) {
+			Type[] nativeTypes = new Type[parameterTypes.Length];
+			LocalBuilder[] buffers = new LocalBuilder[parameterTypes.Length];
+			LocalBuilder[] sizes = new LocalBuilder[parameterTypes.Length];
+
+			// Strings are passed as UTF-8 in both modes, buffers are allocated before any argument is pushed since localloc requires an empty evaluation stack
+			for (int i = 0; i < parameterTypes.Length; i++) {
+				if (parameterTypes[i] == typeof(string)) {
+					Label heap = generator.DefineLabel();
+					Label done = generator.DefineLabel();
+
+					buffers[i] = generator.DeclareLocal(typeof(byte*));
+					sizes[i] = generator.DeclareLocal(typeof(int));
+					generator.Emit(OpCodes.Ldarg, i);
+					generator.Emit(OpCodes.Call, typeof(StringMarshal).GetMethod(nameof(StringMarshal.Measure), BindingFlags.Static | BindingFlags.NonPublic));
+					generator.Emit(OpCodes.Dup);
+					generator.Emit(OpCodes.Stloc, sizes[i]);
+					generator.Emit(OpCodes.Ldc_I4, StringMarshal.stackLimit);
+					generator.Emit(OpCodes.Bgt, heap);
+					generator.Emit(OpCodes.Ldloc, sizes[i]);
+					generator.Emit(OpCodes.Localloc);
+					generator.Emit(OpCodes.Stloc, buffers[i]);
+					generator.Emit(OpCodes.Br, done);
+					generator.MarkLabel(heap);
+					generator.Emit(OpCodes.Ldloc, sizes[i]);
+					generator.Emit(OpCodes.Call, typeof(Marshal).GetMethod(nameof(Marshal.AllocHGlobal), new Type[] { typeof(int) }));
+					generator.Emit(OpCodes.Stloc, buffers[i]);
+					generator.MarkLabel(done);
+				}
+			}
+
+			for (int i = 0; i < parameterTypes.Length; i++) {
+				Type parameterType = parameterTypes[i];
+
+				if (parameterType == typeof(string)) {
+					generator.Emit(OpCodes.Ldloc, buffers[i]);
+					generator.Emit(OpCodes.Ldarg, i);
+					generator.Emit(OpCodes.Call, typeof(StringMarshal).GetMethod(nameof(StringMarshal.Encode), BindingFlags.Static | BindingFlags.NonPublic));
+					nativeTypes[i] = typeof(IntPtr);
+
+					continue;
+				}
+
+				#if BLITTABLE_FUNCTIONS
+					if (parameterType.IsByRef) {
+						LocalBuilder pinned = generator.DeclareLocal(parameterType, true);
+
+						generator.Emit(OpCodes.Ldarg, i);
+						generator.Emit(OpCodes.Stloc, pinned);
+						generator.Emit(OpCodes.Ldloc, pinned);
+						generator.Emit(OpCodes.Conv_I);
+						nativeTypes[i] = typeof(IntPtr);
+
+						continue;
+					}
+
+					if (parameterType == typeof(Bool)) {
+						generator.Emit(OpCodes.Ldarga, i);
+						generator.Emit(OpCodes.Ldind_U1);
+						nativeTypes[i] = typeof(byte);
+
+						continue;
+					}
+				#endif
+
+				generator.Emit(OpCodes.Ldarg, i);
+				nativeTypes[i] = parameterType;
+			}
+
+			generator.Emit(OpCodes.Ldc_I8, pointer.ToInt64());
+			generator.Emit(OpCodes.Conv_I);
+
+			#if BLITTABLE_FUNCTIONS
+				generator.EmitCalli(OpCodes.Calli, CallingConvention.Cdecl, returnType == typeof(Bool) ? typeof(byte) : returnType, nativeTypes);
+
+				if (returnType == typeof(Bool))
+					generator.Emit(OpCodes.Newobj, typeof(Bool).GetConstructor(new Type[] { typeof(byte) }));
+			#else
+				generator.EmitCalli(OpCodes.Calli, CallingConvention.Cdecl, returnType, nativeTypes);
+			#endif
+
+			for (int i = 0; i < parameterTypes.Length; i++) {
+				if (parameterTypes[i] == typeof(string)) {
+					generator.Emit(OpCodes.Ldloc, buffers[i]);
+					generator.Emit(OpCodes.Ldloc, sizes[i]);
+					generator.Emit(OpCodes.Call, typeof(StringMarshal).GetMethod(nameof(StringMarshal.Free), BindingFlags.Static | BindingFlags.NonPublic));
+				}
+			}
+		}
+	}
+
+	// Marks the native functions which return strings encoded into the shared buffer instead of pointers to objects
+	[AttributeUsage(AttributeTargets.ReturnValue)]
+	internal sealed class EncodedStringAttribute : Attribute { }
+
+	internal static unsafe class StringMarshal {
+		internal const int stackLimit = 4096;
+
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		internal static int Measure(string value) => value != null ? (value.Length * 3) + 1 : 1;
+
+		internal static IntPtr Encode(byte* destination, string value) {
+			if (value == null)
+				return IntPtr.Zero;
+
+			int length = value.Length;
+
+			fixed (char* source = value) {
+				int i = 0;
+
+				while (i < length && source[i] < 0x80) {
+					destination[i] = (byte)source[i];
+					i++;
+				}
+
+				if (i < length)
+					i += Encoding.UTF8.GetBytes(source + i, length - i, destination + i, (length - i) * 3);
+
+				destination[i] = 0;
+			}
+
+			return (IntPtr)destination;
+		}
+
+		// Native functions return null-terminated UTF-8 preceded by its length in bytes, the buffer is reused by the next call
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		internal static ReadOnlySpan<byte> GetBytes(IntPtr source) => new ReadOnlySpan<byte>((byte*)source, *((int*)source - 1));
+
+		internal static string Decode(IntPtr source) {
+			if (source == IntPtr.Zero)
+				return null;
+
+			return Encoding.UTF8.GetString(GetBytes(source));
+		}
+
+		internal static bool Decode(IntPtr source, Span<char> destination, out int length) {
+			ReadOnlySpan<byte> bytes = GetBytes(source);
+
+			if (Encoding.UTF8.GetCharCount(bytes) > destination.Length) {
+				length = 0;
+
+				return false;
+			}
+
+			length = Encoding.UTF8.GetChars(bytes, destination);
+
+			return true;
+		}
+
+		internal static void Decode(IntPtr source, IBufferWriter<char> destination) {
+			ReadOnlySpan<byte> bytes = GetBytes(source);
+
+			destination.Advance(Encoding.UTF8.GetChars(bytes, destination.GetSpan(Encoding.UTF8.GetCharCount(bytes))));
+		}
+
+		[MethodImpl(MethodImplOptions.AggressiveInlining)]
+		internal static void Free(byte* buffer, int size) {
+			if (size > stackLimit)
+				Marshal.FreeHGlobal((IntPtr)buffer);
+		}
 	}
 
 	internal struct Bool {
@@ -669,6 +1070,54 @@ namespace UnrealEngine.Framework {
 		public static implicit operator Bool(bool value) => !value ? new Bool(0) : new Bool(1);
 	}
 
+	internal unsafe struct ObjectReference {
+		private const int pendingKillFlag = 1 << 29;
+		private const int unreachableFlag = 1 << 28;
+
+		private ObjectItem* item;
+		private int index;
+		private int serialNumber;
+		private IntPtr @class;
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct ObjectItem {
+			internal IntPtr @object;
+			internal int flags;
+			internal int clusterRootIndex;
+			internal int serialNumber;
+		}
+
+		public ObjectReference(IntPtr pointer) {
+			index = 0;
+			serialNumber = 0;
+			@class = IntPtr.Zero;
+			item = (ObjectItem*)Object.getItem(pointer, ref index, ref serialNumber, ref @class);
+		}
+
+		public int Index => index;
+
+		public int SerialNumber => serialNumber;
+
+		public IntPtr Class => @class;
+
+		public bool IsAlive(IntPtr pointer) => item != null && item->@object == pointer && item->serialNumber == serialNumber && (item->flags & (pendingKillFlag | unreachableFlag)) == 0;
+	}
+
+	internal enum PropertyType : int {
+		None,
+		Bool,
+		Byte,
+		Short,
+		Int,
+		Long,
+		UShort,
+		UInt,
+		ULong,
+		Float,
+		Double,
+		Text
+	}
+
 	internal enum ObjectType : int {
 		Blueprint,
 		SoundWave,
@@ -714,6 +1163,61 @@ namespace UnrealEngine.Framework {
 		SkeletalMesh
 	}
 
+	internal enum CommandType : int {
+		// Scene component
+		AddLocalOffset,
+		AddLocalRotation,
+		AddRelativeLocation,
+		AddRelativeRotation,
+		AddLocalTransform,
+		AddWorldOffset,
+		AddWorldRotation,
+		AddWorldTransform,
+		SetRelativeLocation,
+		SetRelativeRotation,
+		SetRelativeTransform,
+		SetWorldLocation,
+		SetWorldRotation,
+		SetWorldTransform,
+		// Primitive component
+		AddAngularImpulseInDegrees,
+		AddAngularImpulseInRadians,
+		AddForce,
+		AddForceAtLocation,
+		AddImpulse,
+		AddImpulseAtLocation,
+		AddTorqueInDegrees,
+		AddTorqueInRadians,
+		// Actor
+		Hide,
+		SetEnableCollision,
+		TeleportTo
+	}
+
+	[StructLayout(LayoutKind.Explicit, Size = 56)]
+	internal struct Command {
+		[FieldOffset(0)]
+		internal CommandType type;
+		[FieldOffset(4)]
+		internal int flags;
+		[FieldOffset(8)]
+		internal int objectIndex;
+		[FieldOffset(12)]
+		internal int serialNumber;
+		[FieldOffset(16)]
+		internal Vector3 vector;
+		[FieldOffset(16)]
+		internal Quaternion rotation;
+		[FieldOffset(16)]
+		internal Transform transform;
+		[FieldOffset(28)]
+		internal Vector3 location;
+		[FieldOffset(28)]
+		internal Quaternion destinationRotation;
+		[FieldOffset(40)]
+		internal Name boneName;
+	}
+
 	static partial class Assert {
 		internal delegate void OutputMessageFunction(string message);
 
@@ -721,7 +1225,8 @@ namespace UnrealEngine.Framework {
 	}
 
 	static partial class CommandLine {
-		internal delegate void GetFunction(StringBuilder arguments);
+		[return: EncodedString]
+		internal delegate IntPtr GetFunction();
 		internal delegate void SetFunction(string arguments);
 		internal delegate void AppendFunction(string arguments);
 
@@ -743,6 +1248,7 @@ namespace UnrealEngine.Framework {
 		internal delegate void DrawLineFunction(in Vector3 start, in Vector3 end, int color, Bool persistentLines, float lifeTime, byte depthPriority, float thickness);
 		internal delegate void DrawPointFunction(in Vector3 location, float size, int color, Bool persistentLines, float lifeTime, byte depthPriority);
 		internal delegate void FlushPersistentLinesFunction();
+		internal delegate IntPtr GetLogBufferFunction();
 
 		internal static LogFunction log;
 		internal static HandleExceptionFunction handleException;
@@ -756,6 +1262,7 @@ namespace UnrealEngine.Framework {
 		internal static DrawLineFunction drawLine;
 		internal static DrawPointFunction drawPoint;
 		internal static FlushPersistentLinesFunction flushPersistentLines;
+		internal static GetLogBufferFunction getLogBuffer;
 	}
 
 	internal static class Object {
@@ -763,7 +1270,8 @@ namespace UnrealEngine.Framework {
 		internal delegate Bool IsValidFunction(IntPtr @object);
 		internal delegate IntPtr LoadFunction(ObjectType type, string name);
 		internal delegate void RenameFunction(IntPtr @object, string name);
-		internal delegate void GetNameFunction(IntPtr @object, StringBuilder name);
+		[return: EncodedString]
+		internal delegate IntPtr GetNameFunction(IntPtr @object);
 		internal delegate Bool GetBoolFunction(IntPtr @object, string name, ref bool value);
 		internal delegate Bool GetByteFunction(IntPtr @object, string name, ref byte value);
 		internal delegate Bool GetShortFunction(IntPtr @object, string name, ref short value);
@@ -774,7 +1282,8 @@ namespace UnrealEngine.Framework {
 		internal delegate Bool GetULongFunction(IntPtr @object, string name, ref ulong value);
 		internal delegate Bool GetFloatFunction(IntPtr @object, string name, ref float value);
 		internal delegate Bool GetDoubleFunction(IntPtr @object, string name, ref double value);
-		internal delegate Bool GetTextFunction(IntPtr @object, string name, StringBuilder value);
+		[return: EncodedString]
+		internal delegate IntPtr GetTextFunction(IntPtr @object, string name);
 		internal delegate Bool SetBoolFunction(IntPtr @object, string name, Bool value);
 		internal delegate Bool SetByteFunction(IntPtr @object, string name, byte value);
 		internal delegate Bool SetShortFunction(IntPtr @object, string name, short value);
@@ -786,6 +1295,36 @@ namespace UnrealEngine.Framework {
 		internal delegate Bool SetFloatFunction(IntPtr @object, string name, float value);
 		internal delegate Bool SetDoubleFunction(IntPtr @object, string name, double value);
 		internal delegate Bool SetTextFunction(IntPtr @object, string name, string value);
+		internal delegate Bool GetBoolInternedFunction(IntPtr @object, in Name name, ref bool value);
+		internal delegate Bool GetByteInternedFunction(IntPtr @object, in Name name, ref byte value);
+		internal delegate Bool GetShortInternedFunction(IntPtr @object, in Name name, ref short value);
+		internal delegate Bool GetIntInternedFunction(IntPtr @object, in Name name, ref int value);
+		internal delegate Bool GetLongInternedFunction(IntPtr @object, in Name name, ref long value);
+		internal delegate Bool GetUShortInternedFunction(IntPtr @object, in Name name, ref ushort value);
+		internal delegate Bool GetUIntInternedFunction(IntPtr @object, in Name name, ref uint value);
+		internal delegate Bool GetULongInternedFunction(IntPtr @object, in Name name, ref ulong value);
+		internal delegate Bool GetFloatInternedFunction(IntPtr @object, in Name name, ref float value);
+		internal delegate Bool GetDoubleInternedFunction(IntPtr @object, in Name name, ref double value);
+		[return: EncodedString]
+		internal delegate IntPtr GetTextInternedFunction(IntPtr @object, in Name name);
+		internal delegate Bool SetBoolInternedFunction(IntPtr @object, in Name name, Bool value);
+		internal delegate Bool SetByteInternedFunction(IntPtr @object, in Name name, byte value);
+		internal delegate Bool SetShortInternedFunction(IntPtr @object, in Name name, short value);
+		internal delegate Bool SetIntInternedFunction(IntPtr @object, in Name name, int value);
+		internal delegate Bool SetLongInternedFunction(IntPtr @object, in Name name, long value);
+		internal delegate Bool SetUShortInternedFunction(IntPtr @object, in Name name, ushort value);
+		internal delegate Bool SetUIntInternedFunction(IntPtr @object, in Name name, uint value);
+		internal delegate Bool SetULongInternedFunction(IntPtr @object, in Name name, ulong value);
+		internal delegate Bool SetFloatInternedFunction(IntPtr @object, in Name name, float value);
+		internal delegate Bool SetDoubleInternedFunction(IntPtr @object, in Name name, double value);
+		internal delegate Bool SetTextInternedFunction(IntPtr @object, in Name name, string value);
+		internal delegate IntPtr GetItemFunction(IntPtr @object, ref int index, ref int serialNumber, ref IntPtr @class);
+		internal delegate Bool GetPropertyHandleFunction(IntPtr @object, string name, ref PropertyHandle result);
+		[return: EncodedString]
+		internal delegate IntPtr GetTextByHandleFunction(IntPtr @object, IntPtr property);
+		internal delegate void SetTextByHandleFunction(IntPtr @object, IntPtr property, string value);
+		internal delegate void LoadAsyncFunction(int request, ObjectType type, IntPtr names, int count, IntPtr function);
+		internal delegate void CancelLoadAsyncFunction(int request);
 
 		internal static IsPendingKillFunction isPendingKill;
 		internal static IsValidFunction isValid;
@@ -814,15 +1353,55 @@ namespace UnrealEngine.Framework {
 		internal static SetFloatFunction setFloat;
 		internal static SetDoubleFunction setDouble;
 		internal static SetTextFunction setText;
+		internal static GetBoolInternedFunction getBoolInterned;
+		internal static GetByteInternedFunction getByteInterned;
+		internal static GetShortInternedFunction getShortInterned;
+		internal static GetIntInternedFunction getIntInterned;
+		internal static GetLongInternedFunction getLongInterned;
+		internal static GetUShortInternedFunction getUShortInterned;
+		internal static GetUIntInternedFunction getUIntInterned;
+		internal static GetULongInternedFunction getULongInterned;
+		internal static GetFloatInternedFunction getFloatInterned;
+		internal static GetDoubleInternedFunction getDoubleInterned;
+		internal static GetTextInternedFunction getTextInterned;
+		internal static SetBoolInternedFunction setBoolInterned;
+		internal static SetByteInternedFunction setByteInterned;
+		internal static SetShortInternedFunction setShortInterned;
+		internal static SetIntInternedFunction setIntInterned;
+		internal static SetLongInternedFunction setLongInterned;
+		internal static SetUShortInternedFunction setUShortInterned;
+		internal static SetUIntInternedFunction setUIntInterned;
+		internal static SetULongInternedFunction setULongInterned;
+		internal static SetFloatInternedFunction setFloatInterned;
+		internal static SetDoubleInternedFunction setDoubleInterned;
+		internal static SetTextInternedFunction setTextInterned;
+		internal static GetItemFunction getItem;
+		internal static GetPropertyHandleFunction getPropertyHandle;
+		internal static GetTextByHandleFunction getTextByHandle;
+		internal static SetTextByHandleFunction setTextByHandle;
+		internal static LoadAsyncFunction loadAsync;
+		internal static CancelLoadAsyncFunction cancelLoadAsync;
+	}
+
+	partial struct Name {
+		internal delegate void CreateFunction(string value, ref Name result);
+		[return: EncodedString]
+		internal delegate IntPtr GetStringFunction(in Name value);
+
+		internal static CreateFunction create;
+		internal static GetStringFunction getString;
 	}
 
 	static partial class Application {
 		internal delegate Bool IsCanEverRenderFunction();
 		internal delegate Bool IsPackagedForDistributionFunction();
 		internal delegate Bool IsPackagedForShippingFunction();
-		internal delegate void GetProjectDirectoryFunction(StringBuilder directory);
-		internal delegate void GetDefaultLanguageFunction(StringBuilder language);
-		internal delegate void GetProjectNameFunction(StringBuilder projectName);
+		[return: EncodedString]
+		internal delegate IntPtr GetProjectDirectoryFunction();
+		[return: EncodedString]
+		internal delegate IntPtr GetDefaultLanguageFunction();
+		[return: EncodedString]
+		internal delegate IntPtr GetProjectNameFunction();
 		internal delegate float GetVolumeMultiplierFunction();
 		internal delegate void SetProjectNameFunction(string projectName);
 		internal delegate void SetVolumeMultiplierFunction(float value);
@@ -868,7 +1447,8 @@ namespace UnrealEngine.Framework {
 		internal delegate void GetViewportSizeFunction(ref Vector2 value);
 		internal delegate void GetScreenResolutionFunction(ref Vector2 value);
 		internal delegate WindowMode GetWindowModeFunction();
-		internal delegate void GetVersionFunction(StringBuilder version);
+		[return: EncodedString]
+		internal delegate IntPtr GetVersionFunction();
 		internal delegate float GetMaxFPSFunction();
 		internal delegate void SetMaxFPSFunction(float maxFPS);
 		internal delegate void SetTitleFunction(string title);
@@ -900,7 +1480,8 @@ namespace UnrealEngine.Framework {
 
 	static partial class HeadMountedDisplay {
 		internal delegate Bool IsEnabledFunction();
-		internal delegate void GetDeviceNameFunction(StringBuilder name);
+		[return: EncodedString]
+		internal delegate IntPtr GetDeviceNameFunction();
 
 		internal static IsEnabledFunction isEnabled;
 		internal static GetDeviceNameFunction getDeviceName;
@@ -950,7 +1531,8 @@ namespace UnrealEngine.Framework {
 		internal delegate Bool GetBoolFunction(IntPtr consoleVariable);
 		internal delegate int GetIntFunction(IntPtr consoleVariable);
 		internal delegate float GetFloatFunction(IntPtr consoleVariable);
-		internal delegate void GetStringFunction(IntPtr consoleVariable, StringBuilder value);
+		[return: EncodedString]
+		internal delegate IntPtr GetStringFunction(IntPtr consoleVariable);
 		internal delegate void SetBoolFunction(IntPtr consoleVariable, Bool value);
 		internal delegate void SetIntFunction(IntPtr consoleVariable, int value);
 		internal delegate void SetFloatFunction(IntPtr consoleVariable, float value);
@@ -993,6 +1575,8 @@ namespace UnrealEngine.Framework {
 		internal delegate void AddTagFunction(IntPtr actor, string tag);
 		internal delegate void RemoveTagFunction(IntPtr actor, string tag);
 		internal delegate Bool HasTagFunction(IntPtr actor, string tag);
+		internal delegate Bool HasTagInternedFunction(IntPtr actor, in Name tag);
+		internal delegate int GetComponentsFunction(IntPtr actor, ComponentType type, IntPtr components, int capacity);
 
 		internal static IsPendingKillFunction isPendingKill;
 		internal static IsRootComponentMovableFunction isRootComponentMovable;
@@ -1016,6 +1600,8 @@ namespace UnrealEngine.Framework {
 		internal static AddTagFunction addTag;
 		internal static RemoveTagFunction removeTag;
 		internal static HasTagFunction hasTag;
+		internal static HasTagInternedFunction hasTagInterned;
+		internal static GetComponentsFunction getComponents;
 	}
 
 	partial class Pawn {
@@ -1195,11 +1781,15 @@ namespace UnrealEngine.Framework {
 		internal delegate float GetTimeKeyPressedFunction(IntPtr playerInput, string key);
 		internal delegate void GetMouseSensitivityFunction(IntPtr playerInput, ref Vector2 value);
 		internal delegate void SetMouseSensitivityFunction(IntPtr playerInput, in Vector2 value);
+		internal delegate Bool IsKeyPressedInternedFunction(IntPtr playerInput, in Name key);
+		internal delegate float GetTimeKeyPressedInternedFunction(IntPtr playerInput, in Name key);
 
 		internal static IsKeyPressedFunction isKeyPressed;
 		internal static GetTimeKeyPressedFunction getTimeKeyPressed;
 		internal static GetMouseSensitivityFunction getMouseSensitivity;
 		internal static SetMouseSensitivityFunction setMouseSensitivity;
+		internal static IsKeyPressedInternedFunction isKeyPressedInterned;
+		internal static GetTimeKeyPressedInternedFunction getTimeKeyPressedInterned;
 	}
 
 	partial class StreamableRenderAsset {
@@ -1231,6 +1821,7 @@ namespace UnrealEngine.Framework {
 		internal delegate void AddTagFunction(IntPtr actorComponent, string tag);
 		internal delegate void RemoveTagFunction(IntPtr actorComponent, string tag);
 		internal delegate Bool HasTagFunction(IntPtr actorComponent, string tag);
+		internal delegate Bool HasTagInternedFunction(IntPtr actorComponent, in Name tag);
 
 		internal static IsOwnerSelectedFunction isOwnerSelected;
 		internal static GetOwnerFunction getOwner;
@@ -1238,6 +1829,7 @@ namespace UnrealEngine.Framework {
 		internal static AddTagFunction addTag;
 		internal static RemoveTagFunction removeTag;
 		internal static HasTagFunction hasTag;
+		internal static HasTagInternedFunction hasTagInterned;
 	}
 
 	partial class InputComponent {
@@ -1293,6 +1885,9 @@ namespace UnrealEngine.Framework {
 		internal delegate void SetWorldLocationFunction(IntPtr sceneComponent, in Vector3 location);
 		internal delegate void SetWorldRotationFunction(IntPtr sceneComponent, in Quaternion rotation);
 		internal delegate void SetWorldTransformFunction(IntPtr sceneComponent, in Transform transform);
+		internal delegate void GetComponentsLocationsFunction(IntPtr sceneComponents, int count, IntPtr values);
+		internal delegate void GetComponentsRotationsFunction(IntPtr sceneComponents, int count, IntPtr values);
+		internal delegate void GetComponentsTransformsFunction(IntPtr sceneComponents, int count, IntPtr values);
 
 		internal static IsAttachedToComponentFunction isAttachedToComponent;
 		internal static IsAttachedToActorFunction isAttachedToActor;
@@ -1322,6 +1917,9 @@ namespace UnrealEngine.Framework {
 		internal static SetWorldLocationFunction setWorldLocation;
 		internal static SetWorldRotationFunction setWorldRotation;
 		internal static SetWorldTransformFunction setWorldTransform;
+		internal static GetComponentsLocationsFunction getComponentsLocations;
+		internal static GetComponentsRotationsFunction getComponentsRotations;
+		internal static GetComponentsTransformsFunction getComponentsTransforms;
 	}
 
 	partial class AudioComponent {
@@ -1405,6 +2003,15 @@ namespace UnrealEngine.Framework {
 		internal delegate void SetEnableGravityFunction(IntPtr primitiveComponent, Bool value);
 		internal delegate void SetCollisionModeFunction(IntPtr primitiveComponent, CollisionMode mode);
 		internal delegate IntPtr CreateAndSetMaterialInstanceDynamicFunction(IntPtr primitiveComponent, int elementIndex);
+		internal delegate void AddAngularImpulseInDegreesInternedFunction(IntPtr primitiveComponent, in Vector3 impulse, in Name boneName, Bool velocityChange);
+		internal delegate void AddAngularImpulseInRadiansInternedFunction(IntPtr primitiveComponent, in Vector3 impulse, in Name boneName, Bool velocityChange);
+		internal delegate void AddForceInternedFunction(IntPtr primitiveComponent, in Vector3 force, in Name boneName, Bool accelerationChange);
+		internal delegate void AddForceAtLocationInternedFunction(IntPtr primitiveComponent, in Vector3 force, in Vector3 location, in Name boneName, Bool localSpace);
+		internal delegate void AddImpulseInternedFunction(IntPtr primitiveComponent, in Vector3 impulse, in Name boneName, Bool velocityChange);
+		internal delegate void AddImpulseAtLocationInternedFunction(IntPtr primitiveComponent, in Vector3 impulse, in Vector3 location, in Name boneName);
+		internal delegate void AddTorqueInDegreesInternedFunction(IntPtr primitiveComponent, in Vector3 torque, in Name boneName, Bool accelerationChange);
+		internal delegate void AddTorqueInRadiansInternedFunction(IntPtr primitiveComponent, in Vector3 torque, in Name boneName, Bool accelerationChange);
+		internal delegate void SetMassInternedFunction(IntPtr primitiveComponent, float mass, in Name boneName);
 
 		internal static IsGravityEnabledFunction isGravityEnabled;
 		internal static AddAngularImpulseInDegreesFunction addAngularImpulseInDegrees;
@@ -1438,6 +2045,15 @@ namespace UnrealEngine.Framework {
 		internal static SetEnableGravityFunction setEnableGravity;
 		internal static SetCollisionModeFunction setCollisionMode;
 		internal static CreateAndSetMaterialInstanceDynamicFunction createAndSetMaterialInstanceDynamic;
+		internal static AddAngularImpulseInDegreesInternedFunction addAngularImpulseInDegreesInterned;
+		internal static AddAngularImpulseInRadiansInternedFunction addAngularImpulseInRadiansInterned;
+		internal static AddForceInternedFunction addForceInterned;
+		internal static AddForceAtLocationInternedFunction addForceAtLocationInterned;
+		internal static AddImpulseInternedFunction addImpulseInterned;
+		internal static AddImpulseAtLocationInternedFunction addImpulseAtLocationInterned;
+		internal static AddTorqueInDegreesInternedFunction addTorqueInDegreesInterned;
+		internal static AddTorqueInRadiansInternedFunction addTorqueInRadiansInterned;
+		internal static SetMassInternedFunction setMassInterned;
 	}
 
 	partial class ShapeComponent {
@@ -1545,11 +2161,17 @@ namespace UnrealEngine.Framework {
 		internal delegate int AddInstanceFunction(IntPtr instancedStaticMeshComponent, in Transform instanceTransform);
 		internal delegate Bool UpdateInstanceTransformFunction(IntPtr instancedStaticMeshComponent, int instanceIndex, in Transform instanceTransform, Bool worldSpace, Bool markRenderStateDirty, Bool teleport);
 		internal delegate void ClearInstancesFunction(IntPtr instancedStaticMeshComponent);
+		internal delegate int AddInstancesFunction(IntPtr instancedStaticMeshComponent, IntPtr instanceTransforms, int count);
+		internal delegate Bool UpdateInstanceTransformsFunction(IntPtr instancedStaticMeshComponent, int startIndex, IntPtr instanceTransforms, int count, Bool worldSpace, Bool teleport);
+		internal delegate Bool RemoveInstancesFunction(IntPtr instancedStaticMeshComponent, IntPtr instanceIndices, int count);
 
 		internal static GetInstanceCountFunction getInstanceCount;
 		internal static AddInstanceFunction addInstance;
 		internal static UpdateInstanceTransformFunction updateInstanceTransform;
 		internal static ClearInstancesFunction clearInstances;
+		internal static AddInstancesFunction addInstances;
+		internal static UpdateInstanceTransformsFunction updateInstanceTransforms;
+		internal static RemoveInstancesFunction removeInstances;
 	}
 
 	partial class SkinnedMeshComponent {
@@ -1599,10 +2221,156 @@ namespace UnrealEngine.Framework {
 		internal delegate void SetTextureParameterValueFunction(IntPtr materialInstanceDynamic, string parameterName, IntPtr value);
 		internal delegate void SetVectorParameterValueFunction(IntPtr materialInstanceDynamic, string parameterName, in LinearColor value);
 		internal delegate void SetScalarParameterValueFunction(IntPtr materialInstanceDynamic, string parameterName, float value);
+		internal delegate void SetTextureParameterValueInternedFunction(IntPtr materialInstanceDynamic, in Name parameterName, IntPtr value);
+		internal delegate void SetVectorParameterValueInternedFunction(IntPtr materialInstanceDynamic, in Name parameterName, in LinearColor value);
+		internal delegate void SetScalarParameterValueInternedFunction(IntPtr materialInstanceDynamic, in Name parameterName, float value);
 
 		internal static ClearParameterValuesFunction clearParameterValues;
 		internal static SetTextureParameterValueFunction setTextureParameterValue;
 		internal static SetVectorParameterValueFunction setVectorParameterValue;
 		internal static SetScalarParameterValueFunction setScalarParameterValue;
+		internal static SetTextureParameterValueInternedFunction setTextureParameterValueInterned;
+		internal static SetVectorParameterValueInternedFunction setVectorParameterValueInterned;
+		internal static SetScalarParameterValueInternedFunction setScalarParameterValueInterned;
+	}
+	partial class CommandBuffer {
+		internal delegate void ExecuteFunction(IntPtr commands, int count);
+
+		internal static ExecuteFunction execute;
+	}
+
+	partial class TickFunction {
+		internal delegate IntPtr RegisterFunction(IntPtr execute, IntPtr function, TickGroup group, float interval, Bool tickEvenWhenPaused);
+		internal delegate void UnregisterFunction(IntPtr tickFunction);
+		internal delegate Bool IsRegisteredFunction(IntPtr tickFunction);
+		internal delegate Bool IsEnabledFunction(IntPtr tickFunction);
+		internal delegate float GetIntervalFunction(IntPtr tickFunction);
+		internal delegate void SetEnabledFunction(IntPtr tickFunction, Bool value);
+		internal delegate void SetIntervalFunction(IntPtr tickFunction, float value);
+		internal delegate void AddPrerequisiteFunction(IntPtr tickFunction, IntPtr prerequisite);
+		internal delegate void AddActorPrerequisiteFunction(IntPtr tickFunction, IntPtr prerequisite);
+		internal delegate void AddComponentPrerequisiteFunction(IntPtr tickFunction, IntPtr prerequisite);
+		internal delegate void RemovePrerequisiteFunction(IntPtr tickFunction, IntPtr prerequisite);
+		internal delegate void RemoveActorPrerequisiteFunction(IntPtr tickFunction, IntPtr prerequisite);
+		internal delegate void RemoveComponentPrerequisiteFunction(IntPtr tickFunction, IntPtr prerequisite);
+
+		internal static RegisterFunction register;
+		internal static UnregisterFunction unregister;
+		internal static IsRegisteredFunction isRegistered;
+		internal static IsEnabledFunction isEnabled;
+		internal static GetIntervalFunction getInterval;
+		internal static SetEnabledFunction setEnabled;
+		internal static SetIntervalFunction setInterval;
+		internal static AddPrerequisiteFunction addPrerequisite;
+		internal static AddActorPrerequisiteFunction addActorPrerequisite;
+		internal static AddComponentPrerequisiteFunction addComponentPrerequisite;
+		internal static RemovePrerequisiteFunction removePrerequisite;
+		internal static RemoveActorPrerequisiteFunction removeActorPrerequisite;
+		internal static RemoveComponentPrerequisiteFunction removeComponentPrerequisite;
+	}
+
+	partial class GameThread {
+		internal delegate void SetDispatcherFunction(IntPtr function);
+
+		internal static SetDispatcherFunction setDispatcher;
+	}
+
+	partial class InteropTrace {
+		private delegate bool ReplayFunction(InteropTrace trace);
+
+		// Reads the arguments into locals and invokes the function through the same delegate as the framework, the call is skipped if any of the objects is not created by the replay
+		private static ReplayFunction GenerateReplayFunction(string name, InteropRecorder.Argument[] signature, int[] sizes) {
+			Type type = typeof(InteropTrace).Assembly.GetType(name);
+
+			if (type == null)
+				return null;
+
+			MethodInfo method = type.GetMethod("Invoke");
+			ParameterInfo[] parameters = method.GetParameters();
+			FieldInfo field = null;
+
+			if (parameters.Length != signature.Length)
+				throw new InvalidDataException("The signature of " + name + " doesn't match the recorded one");
+
+			for (int i = 0; i < parameters.Length; i++) {
+				if (InteropRecorder.GetArgument(parameters[i].ParameterType, out int size) != signature[i] || size != sizes[i])
+					throw new InvalidDataException("The signature of " + name + " doesn't match the recorded one");
+			}
+
+			foreach (FieldInfo declaredField in type.DeclaringType.GetFields(BindingFlags.Static | BindingFlags.NonPublic)) {
+				if (declaredField.FieldType == type) {
+					field = declaredField;
+
+					break;
+				}
+			}
+
+			if (field == null)
+				return null;
+
+			DynamicMethod dynamicMethod = new DynamicMethod(type.Name, typeof(bool), new Type[] { typeof(InteropTrace) }, typeof(InteropTrace).Module, true);
+			ILGenerator generator = dynamicMethod.GetILGenerator();
+			LocalBuilder[] locals = new LocalBuilder[parameters.Length];
+			Label invoke = generator.DefineLabel();
+
+			for (int i = 0; i < parameters.Length; i++) {
+				Type parameterType = parameters[i].ParameterType;
+
+				locals[i] = generator.DeclareLocal(parameterType.IsByRef ? parameterType.GetElementType() : parameterType);
+
+				if (signature[i] == InteropRecorder.Argument.Value) {
+					generator.Emit(OpCodes.Ldarg_0);
+					generator.Emit(OpCodes.Ldloca, locals[i]);
+					generator.Emit(OpCodes.Call, typeof(InteropTrace).GetMethod(nameof(ReadValue), BindingFlags.Instance | BindingFlags.NonPublic).MakeGenericMethod(locals[i].LocalType));
+
+					continue;
+				}
+
+				generator.Emit(OpCodes.Ldarg_0);
+				generator.Emit(OpCodes.Call, typeof(InteropTrace).GetMethod("Read" + signature[i], BindingFlags.Instance | BindingFlags.NonPublic));
+
+				if (parameterType == typeof(Bool))
+					generator.Emit(OpCodes.Newobj, typeof(Bool).GetConstructor(new Type[] { typeof(byte) }));
+
+				generator.Emit(OpCodes.Stloc, locals[i]);
+			}
+
+			generator.Emit(OpCodes.Ldarg_0);
+			generator.Emit(OpCodes.Ldfld, typeof(InteropTrace).GetField(nameof(resolved), BindingFlags.Instance | BindingFlags.NonPublic));
+			generator.Emit(OpCodes.Brtrue, invoke);
+			generator.Emit(OpCodes.Ldc_I4_0);
+			generator.Emit(OpCodes.Ret);
+			generator.MarkLabel(invoke);
+			generator.Emit(OpCodes.Ldsfld, field);
+
+			for (int i = 0; i < parameters.Length; i++) {
+				generator.Emit(parameters[i].ParameterType.IsByRef ? OpCodes.Ldloca : OpCodes.Ldloc, locals[i]);
+			}
+
+			generator.Emit(OpCodes.Callvirt, method);
+
+			if (method.ReturnType == typeof(IntPtr)) {
+				LocalBuilder value = generator.DeclareLocal(typeof(IntPtr));
+				string bind = type == typeof(Actor.SpawnFunction) ? nameof(BindActor) : type == typeof(SceneComponent.CreateFunction) ? nameof(BindComponent) : nameof(Bind);
+
+				generator.Emit(OpCodes.Stloc, value);
+				generator.Emit(OpCodes.Ldarg_0);
+				generator.Emit(OpCodes.Ldloc, value);
+				generator.Emit(OpCodes.Call, typeof(InteropTrace).GetMethod(bind, BindingFlags.Instance | BindingFlags.NonPublic));
+			} else if (method.ReturnType != typeof(void)) {
+				generator.Emit(OpCodes.Pop);
+			}
+
+			generator.Emit(OpCodes.Ldc_I4_1);
+			generator.Emit(OpCodes.Ret);
+
+			return dynamicMethod.CreateDelegate(typeof(ReplayFunction)) as ReplayFunction;
+		}
+	}
+
+	partial class InteropStatistics {
+		internal delegate void RegisterFunction(IntPtr tables, IntPtr functions, IntPtr counters, int count, long frequency);
+
+		internal static RegisterFunction register;
 	}
 }
@@ -13,6 +13,9 @@
  */
 
 using System;
+using System.Buffers;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
 using System.Diagnostics;
 using System.Drawing;
 using System.Globalization;
@@ -20,9 +23,13 @@ using System.IO;
 using System.Numerics;
 using System.Reflection;
 using System.Runtime.CompilerServices;
+using System.Runtime.ExceptionServices;
 using System.Runtime.InteropServices;
+using System.Runtime.Loader;
 using System.Runtime.Serialization;
 using System.Text;
+using System.Threading;
+using System.Threading.Tasks;
 
 namespace UnrealEngine.Framework {
 	// Internal
@@ -43,6 +50,543 @@ namespace UnrealEngine.Framework {
 		}
 	}
 
+	internal static class AssetLoader {
+		private static readonly IntPtr onLoaded = typeof(AssetLoader).GetMethod(nameof(OnLoaded), BindingFlags.NonPublic | BindingFlags.Static).MethodHandle.GetFunctionPointer();
+		private static readonly Dictionary<int, Request> requests = new Dictionary<int, Request>();
+		private static int lastRequest;
+
+		private sealed class Request {
+			internal TaskCompletionSource<IntPtr[]> source;
+			internal CancellationTokenRegistration registration;
+		}
+
+		internal static Task<T> Load<T>(ObjectType type, string name, Func<IntPtr, T> factory, CancellationToken cancellationToken) where T : class {
+			if (name == null)
+				throw new ArgumentNullException(nameof(name));
+
+			return Complete(Start(type, new string[] { name }, cancellationToken), factory);
+
+			static async Task<T> Complete(Task<IntPtr[]> task, Func<IntPtr, T> factory) {
+				IntPtr pointer = (await task)[0];
+
+				return pointer != IntPtr.Zero ? factory(pointer) : null;
+			}
+		}
+
+		internal static Task<T[]> Load<T>(ObjectType type, string[] names, Func<IntPtr, T> factory, CancellationToken cancellationToken) where T : class {
+			if (names == null)
+				throw new ArgumentNullException(nameof(names));
+
+			for (int i = 0; i < names.Length; i++) {
+				if (names[i] == null)
+					throw new ArgumentNullException(nameof(names));
+			}
+
+			return Complete(Start(type, names, cancellationToken), factory);
+
+			static async Task<T[]> Complete(Task<IntPtr[]> task, Func<IntPtr, T> factory) {
+				IntPtr[] pointers = await task;
+				T[] objects = new T[pointers.Length];
+
+				for (int i = 0; i < pointers.Length; i++) {
+					if (pointers[i] != IntPtr.Zero)
+						objects[i] = factory(pointers[i]);
+				}
+
+				return objects;
+			}
+		}
+
+		// Issues a streaming request, the task is completed on the game thread when the assets are ready or canceled when the world is torn down
+		private static unsafe Task<IntPtr[]> Start(ObjectType type, string[] names, CancellationToken cancellationToken) {
+			if (cancellationToken.IsCancellationRequested)
+				return Task.FromCanceled<IntPtr[]>(cancellationToken);
+
+			if (names.Length == 0)
+				return Task.FromResult(Array.Empty<IntPtr>());
+
+			int id = ++lastRequest;
+			Request request = new Request { source = new TaskCompletionSource<IntPtr[]>() };
+			IntPtr[] strings = new IntPtr[names.Length];
+
+			requests.Add(id, request);
+
+			try {
+				for (int i = 0; i < names.Length; i++) {
+					strings[i] = Marshal.StringToHGlobalAnsi(names[i]);
+				}
+
+				fixed (IntPtr* pointer = strings) {
+					Object.loadAsync(id, type, (IntPtr)pointer, names.Length, onLoaded);
+				}
+			}
+
+			finally {
+				for (int i = 0; i < strings.Length; i++) {
+					Marshal.FreeHGlobal(strings[i]);
+				}
+			}
+
+			if (cancellationToken.CanBeCanceled && requests.ContainsKey(id))
+				request.registration = cancellationToken.Register(() => Cancel(id));
+
+			return request.source.Task;
+		}
+
+		// The token might be canceled from any thread, while the requests and the streaming functions are accessible only from the game thread
+		private static void Cancel(int id) {
+			if (!GameThread.IsCurrent) {
+				GameThread.Post(() => Cancel(id));
+
+				return;
+			}
+
+			if (requests.Remove(id, out Request request)) {
+				Object.cancelLoadAsync(id);
+				request.source.TrySetCanceled();
+			}
+		}
+
+		private static unsafe void OnLoaded(int id, IntPtr objects, int count) {
+			try {
+				if (!requests.Remove(id, out Request request))
+					return;
+
+				request.registration.Dispose();
+
+				if (count < 0) {
+					request.source.TrySetCanceled();
+
+					return;
+				}
+
+				IntPtr[] pointers = new IntPtr[count];
+
+				for (int i = 0; i < count; i++) {
+					pointers[i] = ((IntPtr*)objects)[i];
+				}
+
+				request.source.TrySetResult(pointers);
+			}
+
+			catch (Exception exception) {
+				Debug.Exception(exception);
+			}
+		}
+	}
+
+	internal static class JobScheduler {
+		[ThreadStatic]
+		private static Worker currentWorker;
+		[ThreadStatic]
+		private static bool executingJob;
+		private static readonly object startLock = new object();
+		private static readonly ConcurrentQueue<Job> submissions = new ConcurrentQueue<Job>();
+		private static readonly SemaphoreSlim signal = new SemaphoreSlim(0);
+		private static Worker[] workers;
+		private static int sleepingWorkers;
+		private static volatile bool stopped;
+
+		internal static int WorkerCount => Math.Max(Environment.ProcessorCount - 1, 1);
+
+		internal static bool IsWorkerThread => currentWorker != null;
+
+		internal static bool IsExecutingJob => executingJob;
+
+		internal abstract class Job {
+			private List<Job> dependents;
+			private Exception exception;
+			private int pendingDependencies = 1;
+			private volatile bool completed;
+
+			internal bool IsCompleted => completed;
+
+			internal Exception Exception => exception;
+
+			protected abstract void Execute();
+
+			internal void DependOn(Job dependency) {
+				if (dependency == null)
+					return;
+
+				Interlocked.Increment(ref pendingDependencies);
+
+				lock (dependency) {
+					if (!dependency.completed) {
+						if (dependency.dependents == null)
+							dependency.dependents = new List<Job>();
+
+						dependency.dependents.Add(this);
+
+						return;
+					}
+				}
+
+				Release(dependency);
+			}
+
+			internal void Submit() => Release(null);
+
+			internal void Run() {
+				// Dependents of a failed job are not executed and inherit its exception
+				if (exception == null) {
+					bool executing = executingJob;
+
+					// Jobs are also executed inline by the game thread while it waits for completion
+					executingJob = true;
+
+					try {
+						Execute();
+					}
+
+					catch (Exception exception) {
+						this.exception = exception;
+					}
+
+					finally {
+						executingJob = executing;
+					}
+				}
+
+				List<Job> dependents;
+
+				lock (this) {
+					completed = true;
+					dependents = this.dependents;
+					this.dependents = null;
+				}
+
+				if (dependents != null) {
+					foreach (Job dependent in dependents) {
+						dependent.Release(this);
+					}
+				}
+			}
+
+			private void Release(Job dependency) {
+				if (dependency != null && dependency.exception != null)
+					Interlocked.CompareExchange(ref exception, dependency.exception, null);
+
+				if (Interlocked.Decrement(ref pendingDependencies) == 0)
+					Enqueue(this);
+			}
+		}
+
+		internal sealed class ActionJob : Job {
+			private readonly Action action;
+
+			internal ActionJob(Action action) => this.action = action;
+
+			protected override void Execute() => action();
+		}
+
+		internal sealed class BatchJob : Job {
+			private readonly ParallelForDelegate action;
+			private readonly int start;
+			private readonly int end;
+
+			internal BatchJob(ParallelForDelegate action, int start, int end) {
+				this.action = action;
+				this.start = start;
+				this.end = end;
+			}
+
+			protected override void Execute() => action(start, end);
+		}
+
+		internal sealed class EmptyJob : Job {
+			protected override void Execute() { }
+		}
+
+		private sealed class Worker {
+			private Job[] jobs = new Job[64];
+			private int top;
+			private int bottom;
+			internal readonly int index;
+
+			internal Worker(int index) => this.index = index;
+
+			internal void Push(Job job) {
+				lock (this) {
+					if (bottom - top == jobs.Length) {
+						Job[] grown = new Job[jobs.Length * 2];
+
+						for (int i = top; i < bottom; i++) {
+							grown[i & (grown.Length - 1)] = jobs[i & (jobs.Length - 1)];
+						}
+
+						jobs = grown;
+					}
+
+					jobs[bottom++ & (jobs.Length - 1)] = job;
+				}
+			}
+
+			// The owner takes the most recently pushed job while it's still hot in the cache
+			internal Job Pop() {
+				lock (this) {
+					if (bottom == top)
+						return null;
+
+					int slot = --bottom & (jobs.Length - 1);
+					Job job = jobs[slot];
+
+					jobs[slot] = null;
+					Reset();
+
+					return job;
+				}
+			}
+
+			// Thieves take the oldest job which is likely to spawn the most work
+			internal Job Steal() {
+				lock (this) {
+					if (bottom == top)
+						return null;
+
+					int slot = top++ & (jobs.Length - 1);
+					Job job = jobs[slot];
+
+					jobs[slot] = null;
+					Reset();
+
+					return job;
+				}
+			}
+
+			private void Reset() {
+				if (bottom == top)
+					bottom = top = 0;
+			}
+		}
+
+		internal static void Enqueue(Job job) {
+			Worker worker = currentWorker;
+
+			if (worker != null) {
+				worker.Push(job);
+			} else {
+				Start();
+				submissions.Enqueue(job);
+			}
+
+			if (Volatile.Read(ref sleepingWorkers) > 0)
+				signal.Release();
+		}
+
+		internal static void Complete(Job job) {
+			if (job == null)
+				return;
+
+			Worker worker = currentWorker;
+			SpinWait spinWait = default(SpinWait);
+
+			// The waiting thread executes pending jobs instead of blocking
+			while (!job.IsCompleted) {
+				if (!TryExecute(worker))
+					spinWait.SpinOnce();
+			}
+
+			if (job.Exception != null)
+				ExceptionDispatchInfo.Capture(job.Exception).Throw();
+		}
+
+		internal static void VerifyEngineAccess() {
+			if (executingJob)
+				throw new InvalidOperationException("Engine functions can't be called from jobs, complete the job handle and access the engine on the game thread");
+		}
+
+		private static void Start() {
+			if (workers != null)
+				return;
+
+			lock (startLock) {
+				if (workers != null)
+					return;
+
+				Worker[] created = new Worker[WorkerCount];
+
+				for (int i = 0; i < created.Length; i++) {
+					created[i] = new Worker(i);
+				}
+
+				// Workers must be stopped before unloading since running threads keep the assemblies alive
+				AssemblyLoadContext.GetLoadContext(Assembly.GetExecutingAssembly()).Unloading += context => Stop();
+
+				workers = created;
+
+				for (int i = 0; i < created.Length; i++) {
+					Thread thread = new Thread(Work) {
+						Name = "UnrealCLR Worker " + i,
+						IsBackground = true
+					};
+
+					thread.Start(created[i]);
+				}
+			}
+		}
+
+		private static void Stop() {
+			stopped = true;
+
+			if (workers != null)
+				signal.Release(workers.Length);
+		}
+
+		private static void Work(object state) {
+			Worker worker = (Worker)state;
+
+			currentWorker = worker;
+
+			while (!stopped) {
+				if (TryExecute(worker))
+					continue;
+
+				Interlocked.Increment(ref sleepingWorkers);
+
+				if (!stopped && !TryExecute(worker))
+					signal.Wait();
+
+				Interlocked.Decrement(ref sleepingWorkers);
+			}
+		}
+
+		private static bool TryExecute(Worker worker) {
+			Job job = worker?.Pop();
+
+			if (job == null && !submissions.TryDequeue(out job))
+				job = Steal(worker);
+
+			if (job == null)
+				return false;
+
+			job.Run();
+
+			return true;
+		}
+
+		private static Job Steal(Worker thief) {
+			Worker[] workers = JobScheduler.workers;
+
+			if (workers == null)
+				return null;
+
+			int start = thief != null ? thief.index + 1 : 0;
+
+			for (int i = 0; i < workers.Length; i++) {
+				Worker victim = workers[(start + i) % workers.Length];
+
+				if (victim == thief)
+					continue;
+
+				Job job = victim.Steal();
+
+				if (job != null)
+					return job;
+			}
+
+			return null;
+		}
+	}
+
+	internal static unsafe class Logger {
+		private static Buffer* buffer;
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Buffer {
+			internal long write;
+			internal long read;
+			internal int dropped;
+			internal int capacity;
+			internal int slotSize;
+			private int padding;
+			internal Entry* entries;
+			internal byte* payload;
+			internal ulong* frameCounter;
+		}
+
+		[StructLayout(LayoutKind.Sequential)]
+		private struct Entry {
+			internal int committed;
+			internal LogLevel level;
+			internal int categoryLength;
+			internal int messageLength;
+			internal int count;
+			private int padding;
+			internal ulong frame;
+		}
+
+		internal static void Initialize(IntPtr logBuffer) => buffer = (Buffer*)logBuffer;
+
+		internal static ulong Frame => Volatile.Read(ref *buffer->frameCounter);
+
+		// Reserves consecutive slots for the entry, the native side drains committed entries once per frame on the game thread
+		internal static bool TryWrite(LogLevel level, string category, string message) {
+			Buffer* buffer = Logger.buffer;
+
+			if (buffer == null)
+				return false;
+
+			int categoryLength = category != null ? Encoding.UTF8.GetByteCount(category) : 0;
+			int messageLength = Encoding.UTF8.GetByteCount(message);
+			int length = categoryLength + messageLength;
+			int count = Math.Max((length + buffer->slotSize - 1) / buffer->slotSize, 1);
+
+			if (count > buffer->capacity)
+				return false;
+
+			long write;
+
+			do {
+				write = Volatile.Read(ref buffer->write);
+
+				if (write + count - Volatile.Read(ref buffer->read) > buffer->capacity) {
+					Interlocked.Increment(ref buffer->dropped);
+
+					return true;
+				}
+			}
+
+			while (Interlocked.CompareExchange(ref buffer->write, write + count, write) != write);
+
+			int index = (int)(write & (buffer->capacity - 1));
+			int offset = index * buffer->slotSize;
+			int size = buffer->capacity * buffer->slotSize;
+
+			if (offset + length <= size) {
+				Encode(category, message, new Span<byte>(buffer->payload + offset, length), categoryLength);
+			} else {
+				byte[] wrapped = ArrayPool<byte>.Shared.Rent(length);
+				Span<byte> bytes = new Span<byte>(wrapped, 0, length);
+				int tail = size - offset;
+
+				Encode(category, message, bytes, categoryLength);
+				bytes.Slice(0, tail).CopyTo(new Span<byte>(buffer->payload + offset, tail));
+				bytes.Slice(tail).CopyTo(new Span<byte>(buffer->payload, length - tail));
+				ArrayPool<byte>.Shared.Return(wrapped);
+			}
+
+			Entry* entry = buffer->entries + index;
+
+			entry->level = level;
+			entry->categoryLength = categoryLength;
+			entry->messageLength = messageLength;
+			entry->count = count;
+			entry->frame = Volatile.Read(ref *buffer->frameCounter);
+
+			Volatile.Write(ref entry->committed, 1);
+
+			return true;
+		}
+
+		private static void Encode(string category, string message, Span<byte> destination, int categoryLength) {
+			if (category != null)
+				Encoding.UTF8.GetBytes(category, destination.Slice(0, categoryLength));
+
+			Encoding.UTF8.GetBytes(message, destination.Slice(categoryLength));
+		}
+	}
+
 	// Public
 
 	/// <summary>
@@ -294,6 +838,28 @@ namespace UnrealEngine.Framework {
 		Windowed
 	}
 
+	/// <summary>
+	/// Specifies the group of a frame in which a tick function is executed
+	/// </summary>
+	public enum TickGroup : int {
+		/// <summary>
+		/// Executed before physics simulation starts
+		/// </summary>
+		PrePhysics = 0,
+		/// <summary>
+		/// Executed in parallel with physics simulation
+		/// </summary>
+		DuringPhysics = 2,
+		/// <summary>
+		/// Executed after physics simulation is done
+		/// </summary>
+		PostPhysics = 4,
+		/// <summary>
+		/// Executed after the camera is updated
+		/// </summary>
+		PostUpdateWork = 5
+	}
+
 	/// <summary>
 	/// A linear 32-bit floating-point RGBA color
 	/// </summary>
@@ -649,40 +1215,323 @@ namespace UnrealEngine.Framework {
 	}
 
 	/// <summary>
-	/// Delegate for action events
+	/// An interned engine name, resolves a string once and passes it to the engine without conversion, suitable for names and tags used every tick, compared without case like the engine names
 	/// </summary>
-	public delegate void InputDelegate();
+	[StructLayout(LayoutKind.Sequential)]
+	public partial struct Name : IEquatable<Name> {
+		private uint id;
+		private uint displayId;
+		private int number;
 
-	/// <summary>
-	/// Delegate for axis events
-	/// </summary>
-	public delegate void InputAxisDelegate(float axisValue);
+		/// <summary>
+		/// Initializes a new instance the name by interning a string in the engine
+		/// </summary>
+		public Name(string value) {
+			if (value == null)
+				throw new ArgumentNullException(nameof(value));
 
-	/// <summary>
-	/// Delegate for console variable events
-	/// </summary>
-	public delegate void ConsoleVariableDelegate();
+			id = 0;
+			displayId = 0;
+			number = 0;
 
-	/// <summary>
-	/// Delegate for console command events
-	/// </summary>
-	public delegate void ConsoleCommandDelegate(float value);
+			create(value, ref this);
+		}
 
-	/// <summary>
-	/// Provides additional static constants and methods for mathematical functions that are lack in <see cref="System.Math"/>, <see cref="System.MathF"/>, and <see cref="System.Numerics"/>
-	/// </summary>
-	public static class Maths {
 		/// <summary>
-		/// Degrees-to-radians conversion constant
+		/// Returns <c>true</c> if the name is empty
 		/// </summary>
-		public const float DegToRadF = MathF.PI * 2.0f / 360.0f;
+		public bool IsNone => id == 0 && number == 0;
 
 		/// <summary>
-		/// Radians-to-degrees conversion constant
+		/// The empty name
 		/// </summary>
-		public const float RadToDegF = 1.0f / DegToRadF;
-
-		// Double-precision
+		public static Name None => default(Name);
+
+		/// <summary>
+		/// Tests for equality between two name objects
+		/// </summary>
+		public static bool operator ==(Name left, Name right) => left.Equals(right);
+
+		/// <summary>
+		/// Tests for inequality between two name objects
+		/// </summary>
+		public static bool operator !=(Name left, Name right) => !left.Equals(right);
+
+		/// <summary>
+		/// Returns a string that represents this instance with the spelling it was created from
+		/// </summary>
+		public override string ToString() => StringMarshal.Decode(getString(this));
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public bool Equals(Name other) => id == other.id && number == other.number;
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public override bool Equals(object value) {
+			if (value == null)
+				return false;
+
+			if (!ReferenceEquals(value.GetType(), typeof(Name)))
+				return false;
+
+			return Equals((Name)value);
+		}
+
+		/// <summary>
+		/// Returns a hash code for the object
+		/// </summary>
+		public override int GetHashCode() => HashCode.Combine(id, number);
+	}
+
+	/// <summary>
+	/// A resolved property of an engine class, reads and writes values directly in memory without looking up the property by name, valid for objects of the exact class it was resolved from
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct PropertyHandle : IEquatable<PropertyHandle> {
+		internal IntPtr property;
+		internal IntPtr @class;
+		internal int offset;
+		internal PropertyType type;
+
+		/// <summary>
+		/// Returns <c>true</c> if the property is resolved
+		/// </summary>
+		public bool IsValid => property != IntPtr.Zero;
+
+		/// <summary>
+		/// Tests for equality between two property handles
+		/// </summary>
+		public static bool operator ==(PropertyHandle left, PropertyHandle right) => left.Equals(right);
+
+		/// <summary>
+		/// Tests for inequality between two property handles
+		/// </summary>
+		public static bool operator !=(PropertyHandle left, PropertyHandle right) => !left.Equals(right);
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public bool Equals(PropertyHandle other) => property == other.property && @class == other.@class;
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public override bool Equals(object value) {
+			if (value == null)
+				return false;
+
+			if (!ReferenceEquals(value.GetType(), typeof(PropertyHandle)))
+				return false;
+
+			return Equals((PropertyHandle)value);
+		}
+
+		/// <summary>
+		/// Returns a hash code for the object
+		/// </summary>
+		public override int GetHashCode() => HashCode.Combine(property, @class);
+
+		internal bool Matches(IntPtr @class, PropertyType type) => this.type == type && this.@class == @class;
+
+		internal unsafe bool Get<T>(IntPtr @object, IntPtr @class, PropertyType type, ref T value) where T : unmanaged {
+			if (!Matches(@class, type))
+				return false;
+
+			value = *(T*)((byte*)@object + offset);
+
+			return true;
+		}
+
+		internal unsafe bool Set<T>(IntPtr @object, IntPtr @class, PropertyType type, T value) where T : unmanaged {
+			if (!Matches(@class, type))
+				return false;
+
+			*(T*)((byte*)@object + offset) = value;
+
+			return true;
+		}
+	}
+
+	/// <summary>
+	/// A handle to a scheduled job, used to declare dependencies between jobs and to wait for completion at sync points on the game thread
+	/// </summary>
+	public readonly struct JobHandle : IEquatable<JobHandle> {
+		internal readonly JobScheduler.Job job;
+
+		internal JobHandle(JobScheduler.Job job) => this.job = job;
+
+		/// <summary>
+		/// Returns <c>true</c> if the job is completed, a default handle is always completed
+		/// </summary>
+		public bool IsCompleted => job == null || job.IsCompleted;
+
+		/// <summary>
+		/// Waits for completion of the job while executing pending jobs on the calling thread, rethrows an exception thrown by the job or by one of its dependencies
+		/// </summary>
+		public void Complete() => JobScheduler.Complete(job);
+
+		/// <summary>
+		/// Tests for equality between two job handles
+		/// </summary>
+		public static bool operator ==(JobHandle left, JobHandle right) => left.Equals(right);
+
+		/// <summary>
+		/// Tests for inequality between two job handles
+		/// </summary>
+		public static bool operator !=(JobHandle left, JobHandle right) => !left.Equals(right);
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public bool Equals(JobHandle other) => ReferenceEquals(job, other.job);
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public override bool Equals(object value) {
+			if (value == null)
+				return false;
+
+			if (!ReferenceEquals(value.GetType(), typeof(JobHandle)))
+				return false;
+
+			return Equals((JobHandle)value);
+		}
+
+		/// <summary>
+		/// Returns a hash code for the object
+		/// </summary>
+		public override int GetHashCode() => RuntimeHelpers.GetHashCode(job);
+	}
+
+	/// <summary>
+	/// A snapshot of the call counter of an engine function or of a whole table of functions
+	/// </summary>
+	public readonly struct InteropCounter : IEquatable<InteropCounter> {
+		private readonly string table;
+		private readonly string function;
+		private readonly long calls;
+		private readonly TimeSpan time;
+
+		internal InteropCounter(string table, string function, long calls, TimeSpan time) {
+			this.table = table;
+			this.function = function;
+			this.calls = calls;
+			this.time = time;
+		}
+
+		/// <summary>
+		/// Returns the name of the table such as <c>Actor</c> or <c>SceneComponent</c>
+		/// </summary>
+		public string Table => table;
+
+		/// <summary>
+		/// Returns the name of the function, or <c>null</c> if the counter accumulates the whole table
+		/// </summary>
+		public string Function => function;
+
+		/// <summary>
+		/// Returns the number of calls
+		/// </summary>
+		public long Calls => calls;
+
+		/// <summary>
+		/// Returns the cumulative time of calls including the transition
+		/// </summary>
+		public TimeSpan Time => time;
+
+		/// <summary>
+		/// Tests for equality between two objects
+		/// </summary>
+		public static bool operator ==(InteropCounter left, InteropCounter right) => left.Equals(right);
+
+		/// <summary>
+		/// Tests for inequality between two objects
+		/// </summary>
+		public static bool operator !=(InteropCounter left, InteropCounter right) => !left.Equals(right);
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public bool Equals(InteropCounter other) => table == other.table && function == other.function && calls == other.calls && time == other.time;
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public override bool Equals(object value) {
+			if (value == null)
+				return false;
+
+			if (!ReferenceEquals(value.GetType(), typeof(InteropCounter)))
+				return false;
+
+			return Equals((InteropCounter)value);
+		}
+
+		/// <summary>
+		/// Returns a hash code for the object
+		/// </summary>
+		public override int GetHashCode() => HashCode.Combine(table, function, calls, time);
+
+		/// <summary>
+		/// Returns a formatted string for the object
+		/// </summary>
+		public override string ToString() => (function != null ? table + "::" + function : table) + ": " + calls + " calls, " + time.TotalMilliseconds.ToString("F3", CultureInfo.InvariantCulture) + " ms";
+	}
+
+	/// <summary>
+	/// Delegate for action events
+	/// </summary>
+	public delegate void InputDelegate();
+
+	/// <summary>
+	/// Delegate for axis events
+	/// </summary>
+	public delegate void InputAxisDelegate(float axisValue);
+
+	/// <summary>
+	/// Delegate for console variable events
+	/// </summary>
+	public delegate void ConsoleVariableDelegate();
+
+	/// <summary>
+	/// Delegate for console command events
+	/// </summary>
+	public delegate void ConsoleCommandDelegate(float value);
+
+	/// <summary>
+	/// Delegate for tick functions
+	/// </summary>
+	public delegate void TickDelegate(float deltaTime);
+
+	/// <summary>
+	/// Delegate for batches of parallel jobs, processes indices from <paramref name="start"/> inclusive to <paramref name="end"/> exclusive
+	/// </summary>
+	public delegate void ParallelForDelegate(int start, int end);
+
+	/// <summary>
+	/// Delegate for batches of parallel jobs over spans, <paramref name="start"/> is the index of the first element of the batch in the whole span
+	/// </summary>
+	public delegate void ParallelForSpanDelegate<T>(Span<T> batch, int start);
+
+	/// <summary>
+	/// Provides additional static constants and methods for mathematical functions that are lack in <see cref="System.Math"/>, <see cref="System.MathF"/>, and <see cref="System.Numerics"/>
+	/// </summary>
+	public static class Maths {
+		/// <summary>
+		/// Degrees-to-radians conversion constant
+		/// </summary>
+		public const float DegToRadF = MathF.PI * 2.0f / 360.0f;
+
+		/// <summary>
+		/// Radians-to-degrees conversion constant
+		/// </summary>
+		public const float RadToDegF = 1.0f / DegToRadF;
+
+		// Double-precision
 
 		/// <summary>
 		/// Returns the dot product of two float values
@@ -2151,19 +3000,10 @@ namespace UnrealEngine.Framework {
 	/// Functionality to work with the command-line of the engine executable
 	/// </summary>
 	public static partial class CommandLine {
-		[ThreadStatic]
-		private static StringBuilder stringBuffer = new StringBuilder(8192);
-
 		/// <summary>
 		/// Returns the user arguments
 		/// </summary>
-		public static string Get() {
-			stringBuffer.Clear();
-
-			get(stringBuffer);
-
-			return stringBuffer.ToString();
-		}
+		public static string Get() => StringMarshal.Decode(get());
 
 		/// <summary>
 		/// Overrides the arguments
@@ -2196,11 +3036,25 @@ namespace UnrealEngine.Framework {
 		/// <summary>
 		/// Logs a message in accordance to the specified level, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
 		/// </summary>
-		public static void Log(LogLevel level, string message) {
+		public static void Log(LogLevel level, string message) => Log(level, null, message);
+
+		/// <summary>
+		/// Logs a message with the category in accordance to the specified level, safe to call from any thread, messages are written to the engine log once per frame on the game thread, fatal messages and messages which exceed the log buffer are written immediately on the game thread outside of jobs or posted to the game thread otherwise, omitted in builds with the <a href="https://docs.unrealengine.com/en-US/Programming/Development/BuildConfigurations/index.html#buildconfigurationdescriptions">Shipping</a> configuration
+		/// </summary>
+		public static void Log(LogLevel level, string category, string message) {
 			if (message == null)
 				throw new ArgumentNullException(nameof(message));
 
-			log(level, message);
+			if (level != LogLevel.Fatal && Logger.TryWrite(level, category, message))
+				return;
+
+			string text = category != null ? category + ": " + message : message;
+
+			if (GameThread.IsCurrent && !JobScheduler.IsExecutingJob) {
+				log(level, text);
+			} else {
+				GameThread.Post(() => log(level, text));
+			}
 		}
 
 		/// <summary>
@@ -2285,9 +3139,6 @@ namespace UnrealEngine.Framework {
 	/// Provides information about the application
 	/// </summary>
 	public static partial class Application {
-		[ThreadStatic]
-		private static StringBuilder stringBuffer = new StringBuilder(8192);
-
 		/// <summary>
 		/// Returns <c>true</c> if the application can render anything
 		/// </summary>
@@ -2306,44 +3157,19 @@ namespace UnrealEngine.Framework {
 		/// <summary>
 		/// Returns the project directory
 		/// </summary>
-		public static string ProjectDirectory {
-			get {
-				stringBuffer.Clear();
-
-				getProjectDirectory(stringBuffer);
-
-				return stringBuffer.ToString();
-			}
-		}
+		public static string ProjectDirectory => StringMarshal.Decode(getProjectDirectory());
 
 		/// <summary>
 		/// Returns the default language used by current platform
 		/// </summary>
-		public static string DefaultLanguage {
-			get {
-				stringBuffer.Clear();
-
-				getDefaultLanguage(stringBuffer);
-
-				return stringBuffer.ToString();
-			}
-		}
+		public static string DefaultLanguage => StringMarshal.Decode(getDefaultLanguage());
 
 		/// <summary>
 		/// Gets or sets the name of the current project
 		/// </summary>
 		public static string ProjectName {
-			get {
-				stringBuffer.Clear();
-
-				getProjectName(stringBuffer);
-
-				return stringBuffer.ToString();
-			}
-
-			set {
-				setProjectName(value);
-			}
+			get => StringMarshal.Decode(getProjectName());
+			set => setProjectName(value);
 		}
 
 		/// <summary>
@@ -2506,9 +3332,6 @@ namespace UnrealEngine.Framework {
 	/// Functionality for management of engine systems
 	/// </summary>
 	public static partial class Engine {
-		[ThreadStatic]
-		private static StringBuilder stringBuffer = new StringBuilder(8192);
-
 		/// <summary>
 		/// Returns <c>true</c> if the game is running in split screen mode
 		/// </summary>
@@ -2569,15 +3392,7 @@ namespace UnrealEngine.Framework {
 		/// <summary>
 		/// Returns the current engine version
 		/// </summary>
-		public static string Version {
-			get {
-				stringBuffer.Clear();
-
-				getVersion(stringBuffer);
-
-				return stringBuffer.ToString();
-			}
-		}
+		public static string Version => StringMarshal.Decode(getVersion());
 
 		/// <summary>
 		/// Gets or sets max frames per second, overrides console variable
@@ -2637,9 +3452,6 @@ namespace UnrealEngine.Framework {
 	/// Functionality for access to the head mounted display
 	/// </summary>
 	public static partial class HeadMountedDisplay {
-		[ThreadStatic]
-		private static StringBuilder stringBuffer = new StringBuilder(8192);
-
 		/// <summary>
 		/// Returns <c>true</c> if the head mounted display is enabled
 		/// </summary>
@@ -2648,15 +3460,7 @@ namespace UnrealEngine.Framework {
 		/// <summary>
 		/// Retrieves the name of the device
 		/// </summary>
-		public static string DeviceName {
-			get {
-				stringBuffer.Clear();
-
-				getDeviceName(stringBuffer);
-
-				return stringBuffer.ToString();
-			}
-		}
+		public static string DeviceName => StringMarshal.Decode(getDeviceName());
 	}
 
 	/// <summary>
@@ -2692,7 +3496,7 @@ namespace UnrealEngine.Framework {
 		}
 
 		/// <summary>
-		/// Returns the first actor in the world of the specified class, optionally with the specified name, this operation is slow and should be used with caution
+		/// Returns the first actor in the world of the specified class, optionally with the specified name, lookups by name are served from an index while a search without a name iterates all actors
 		/// </summary>
 		/// <param name="name">The name of the actor, may differ from the label in the editor</param>
 		/// <typeparam name="T">The type of the actor</typeparam>
@@ -2711,7 +3515,7 @@ namespace UnrealEngine.Framework {
 		}
 
 		/// <summary>
-		/// Returns the first actor in the world of the specified class and tag, this operation is slow and should be used with caution
+		/// Returns the first actor in the world of the specified class and tag, lookups are served from an index and fall back to iterating all actors if the tag is not indexed
 		/// </summary>
 		/// <param name="tag">The tag of the actor</param>
 		/// <typeparam name="T">The type of the actor</typeparam>
@@ -2759,15 +3563,1529 @@ namespace UnrealEngine.Framework {
 	}
 
 	/// <summary>
-	/// Interface for engine objects
+	/// Distributes pure managed computations across worker threads with per-worker queues and work stealing, engine functions can't be called from jobs and are accessible only on the game thread after completion of the job handles
 	/// </summary>
-	public interface IObject {
-		/// <summary/>
-		string Name { get; }
-		/// <summary/>
-		bool GetBool(string name, ref bool value);
-		/// <summary/>
-		bool GetByte(string name, ref byte value);
+	public static class Jobs {
+		/// <summary>
+		/// Returns the number of worker threads
+		/// </summary>
+		public static int WorkerCount => JobScheduler.WorkerCount;
+
+		/// <summary>
+		/// Returns <c>true</c> if called from a job on a worker thread
+		/// </summary>
+		public static bool IsWorkerThread => JobScheduler.IsWorkerThread;
+
+		/// <summary>
+		/// Schedules a job for execution on worker threads
+		/// </summary>
+		/// <param name="job">The job to execute</param>
+		/// <param name="dependency">The job which should be completed before the execution</param>
+		/// <returns>A handle to the scheduled job</returns>
+		public static JobHandle Schedule(Action job, JobHandle dependency = default(JobHandle)) {
+			if (job == null)
+				throw new ArgumentNullException(nameof(job));
+
+			JobScheduler.ActionJob scheduled = new JobScheduler.ActionJob(job);
+
+			scheduled.DependOn(dependency.job);
+			scheduled.Submit();
+
+			return new JobHandle(scheduled);
+		}
+
+		/// <summary>
+		/// Schedules a job for execution on worker threads in batches over a range of indices
+		/// </summary>
+		/// <param name="length">The number of indices to process</param>
+		/// <param name="batchSize">The number of indices processed by a single batch</param>
+		/// <param name="job">The job to execute for each batch</param>
+		/// <param name="dependency">The job which should be completed before the execution</param>
+		/// <returns>A handle which is completed when all batches are completed</returns>
+		public static JobHandle ScheduleParallelFor(int length, int batchSize, ParallelForDelegate job, JobHandle dependency = default(JobHandle)) {
+			if (length < 0)
+				throw new ArgumentOutOfRangeException(nameof(length));
+
+			if (batchSize <= 0)
+				throw new ArgumentOutOfRangeException(nameof(batchSize));
+
+			if (job == null)
+				throw new ArgumentNullException(nameof(job));
+
+			JobScheduler.EmptyJob completion = new JobScheduler.EmptyJob();
+
+			for (int start = 0; start < length; start += batchSize) {
+				JobScheduler.BatchJob batch = new JobScheduler.BatchJob(job, start, Math.Min(start + batchSize, length));
+
+				batch.DependOn(dependency.job);
+				completion.DependOn(batch);
+				batch.Submit();
+			}
+
+			completion.DependOn(dependency.job);
+			completion.Submit();
+
+			return new JobHandle(completion);
+		}
+
+		/// <summary>
+		/// Executes a job in batches over a range of indices on worker threads and the calling thread, returns when all batches are completed
+		/// </summary>
+		/// <param name="length">The number of indices to process</param>
+		/// <param name="batchSize">The number of indices processed by a single batch</param>
+		/// <param name="job">The job to execute for each batch</param>
+		public static void ParallelFor(int length, int batchSize, ParallelForDelegate job) {
+			if (length <= batchSize && length >= 0 && job != null) {
+				if (length > 0)
+					job(0, length);
+
+				return;
+			}
+
+			ScheduleParallelFor(length, batchSize, job).Complete();
+		}
+
+		/// <summary>
+		/// Executes a job in batches over the elements of a span on worker threads and the calling thread, returns when all batches are completed
+		/// </summary>
+		/// <param name="items">The elements to process</param>
+		/// <param name="batchSize">The number of elements processed by a single batch</param>
+		/// <param name="job">The job to execute for each batch</param>
+		public static unsafe void ParallelFor<T>(Span<T> items, int batchSize, ParallelForSpanDelegate<T> job) where T : unmanaged {
+			if (job == null)
+				throw new ArgumentNullException(nameof(job));
+
+			if (items.Length <= batchSize && batchSize > 0) {
+				job(items, 0);
+
+				return;
+			}
+
+			// The span remains pinned until all batches are completed
+			fixed (T* pointer = items) {
+				IntPtr buffer = (IntPtr)pointer;
+
+				ScheduleParallelFor(items.Length, batchSize, (start, end) => job(new Span<T>((T*)buffer + start, end - start), start)).Complete();
+			}
+		}
+
+		/// <summary>
+		/// Combines job handles into a single handle which is completed when all of them are completed
+		/// </summary>
+		public static JobHandle CombineDependencies(params JobHandle[] dependencies) {
+			if (dependencies == null)
+				throw new ArgumentNullException(nameof(dependencies));
+
+			JobScheduler.EmptyJob combined = new JobScheduler.EmptyJob();
+
+			foreach (JobHandle dependency in dependencies) {
+				combined.DependOn(dependency.job);
+			}
+
+			combined.Submit();
+
+			return new JobHandle(combined);
+		}
+	}
+
+	/// <summary>
+	/// Dispatches work posted from any thread to the game thread, where engine functions can be called safely, posted work is executed at the start of each frame in the order of posting
+	/// </summary>
+	public static partial class GameThread {
+		private static readonly IntPtr dispatcher = typeof(GameThread).GetMethod(nameof(Dispatch), BindingFlags.NonPublic | BindingFlags.Static).MethodHandle.GetFunctionPointer();
+		private static Node head = new Node();
+		private static Node tail = head;
+		private static int threadId;
+
+		private sealed class Node {
+			internal Action action;
+			internal Node next;
+		}
+
+		/// <summary>
+		/// Returns <c>true</c> if called from the game thread
+		/// </summary>
+		public static bool IsCurrent => Environment.CurrentManagedThreadId == threadId;
+
+		/// <summary>
+		/// Posts an action for execution on the game thread, exceptions are reported to the engine
+		/// </summary>
+		public static void Post(Action action) {
+			if (action == null)
+				throw new ArgumentNullException(nameof(action));
+
+			Node node = new Node { action = action };
+
+			// Producers only swap the head, the previous node is linked afterwards and the consumer stops at an unlinked node until the next frame
+			Volatile.Write(ref Interlocked.Exchange(ref head, node).next, node);
+		}
+
+		/// <summary>
+		/// Posts an action for execution on the game thread
+		/// </summary>
+		/// <returns>A task which is completed after the execution</returns>
+		public static Task InvokeAsync(Action action) {
+			if (action == null)
+				throw new ArgumentNullException(nameof(action));
+
+			TaskCompletionSource<bool> source = new TaskCompletionSource<bool>(TaskCreationOptions.RunContinuationsAsynchronously);
+
+			Post(() => {
+				try {
+					action();
+					source.SetResult(true);
+				}
+
+				catch (Exception exception) {
+					source.SetException(exception);
+				}
+			});
+
+			return source.Task;
+		}
+
+		/// <summary>
+		/// Posts a function for execution on the game thread
+		/// </summary>
+		/// <returns>A task with the result of the function which is completed after the execution</returns>
+		public static Task<T> InvokeAsync<T>(Func<T> function) {
+			if (function == null)
+				throw new ArgumentNullException(nameof(function));
+
+			TaskCompletionSource<T> source = new TaskCompletionSource<T>(TaskCreationOptions.RunContinuationsAsynchronously);
+
+			Post(() => {
+				try {
+					source.SetResult(function());
+				}
+
+				catch (Exception exception) {
+					source.SetException(exception);
+				}
+			});
+
+			return source.Task;
+		}
+
+		internal static void Initialize() {
+			threadId = Environment.CurrentManagedThreadId;
+			setDispatcher(dispatcher);
+		}
+
+		internal static void VerifyAccess() {
+			if (Environment.CurrentManagedThreadId != threadId)
+				throw new InvalidOperationException("Engine functions can be called only from the game thread, use " + nameof(GameThread) + "." + nameof(Post) + " to dispatch the call");
+		}
+
+		private static void Dispatch() {
+			Node last = Volatile.Read(ref head);
+
+			// Work posted during the dispatch is deferred to the next frame
+			while (tail != last) {
+				Node next = Volatile.Read(ref tail.next);
+
+				if (next == null)
+					break;
+
+				Action action = next.action;
+
+				next.action = null;
+				tail = next;
+
+				try {
+					action();
+				}
+
+				catch (Exception exception) {
+					Debug.Exception(exception);
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// Provides call counters and cumulative time of engine functions grouped by table, counters are collected only when the framework is compiled with interop statistics
+	/// </summary>
+	public static unsafe partial class InteropStatistics {
+		private static readonly List<Entry> entries = new List<Entry>();
+		private static readonly double ticksToTimeSpan = (double)TimeSpan.TicksPerSecond / Stopwatch.Frequency;
+
+		[StructLayout(LayoutKind.Sequential)]
+		internal struct Counter {
+			internal long calls;
+			internal long ticks;
+		}
+
+		private readonly struct Entry {
+			internal readonly string table;
+			internal readonly string function;
+			internal readonly Counter* counter;
+
+			internal Entry(string table, string function, Counter* counter) {
+				this.table = table;
+				this.function = function;
+				this.counter = counter;
+			}
+		}
+
+		/// <summary>
+		/// Returns <c>true</c> if the framework is compiled with interop statistics
+		/// </summary>
+		public static bool IsEnabled => Shared.interopStatistics;
+
+		/// <summary>
+		/// Returns the number of instrumented functions
+		/// </summary>
+		public static int Count => entries.Count;
+
+		/// <summary>
+		/// Returns the counter of the function at the specified index
+		/// </summary>
+		public static InteropCounter GetCounter(int index) {
+			if ((uint)index >= (uint)entries.Count)
+				throw new ArgumentOutOfRangeException(nameof(index));
+
+			Entry entry = entries[index];
+
+			return new InteropCounter(entry.table, entry.function, Interlocked.Read(ref entry.counter->calls), ToTimeSpan(Interlocked.Read(ref entry.counter->ticks)));
+		}
+
+		/// <summary>
+		/// Returns the accumulated counter of all functions of the table
+		/// </summary>
+		public static InteropCounter GetTable(string table) {
+			if (table == null)
+				throw new ArgumentNullException(nameof(table));
+
+			long calls = 0;
+			long ticks = 0;
+
+			foreach (Entry entry in entries) {
+				if (entry.table == table) {
+					calls += Interlocked.Read(ref entry.counter->calls);
+					ticks += Interlocked.Read(ref entry.counter->ticks);
+				}
+			}
+
+			return new InteropCounter(table, null, calls, ToTimeSpan(ticks));
+		}
+
+		internal static IntPtr Allocate(Type function) {
+			Counter* counter = (Counter*)Marshal.AllocHGlobal(sizeof(Counter));
+			string name = function.Name;
+
+			*counter = default(Counter);
+			entries.Add(new Entry(function.DeclaringType.Name, name.EndsWith("Function", StringComparison.Ordinal) ? name.Substring(0, name.Length - 8) : name, counter));
+
+			return (IntPtr)counter;
+		}
+
+		internal static void Record(Counter* counter, long timestamp) {
+			Interlocked.Increment(ref counter->calls);
+			Interlocked.Add(ref counter->ticks, Stopwatch.GetTimestamp() - timestamp);
+		}
+
+		// The plugin copies the names and publishes the counters as stats at the start of each frame until the world is cleaned up
+		internal static void Initialize() {
+			int count = entries.Count;
+			IntPtr[] tables = new IntPtr[count];
+			IntPtr[] functions = new IntPtr[count];
+			IntPtr[] counters = new IntPtr[count];
+
+			try {
+				for (int i = 0; i < count; i++) {
+					tables[i] = Marshal.StringToCoTaskMemUTF8(entries[i].table);
+					functions[i] = Marshal.StringToCoTaskMemUTF8(entries[i].function);
+					counters[i] = (IntPtr)entries[i].counter;
+				}
+
+				fixed (IntPtr* tablesPointer = tables, functionsPointer = functions, countersPointer = counters) {
+					register((IntPtr)tablesPointer, (IntPtr)functionsPointer, (IntPtr)countersPointer, count, Stopwatch.Frequency);
+				}
+			}
+
+			finally {
+				for (int i = 0; i < count; i++) {
+					Marshal.FreeCoTaskMem(tables[i]);
+					Marshal.FreeCoTaskMem(functions[i]);
+				}
+			}
+
+			AssemblyLoadContext.GetLoadContext(typeof(InteropStatistics).Assembly).Unloading += context => {
+				foreach (Entry entry in entries) {
+					Marshal.FreeHGlobal((IntPtr)entry.counter);
+				}
+
+				entries.Clear();
+			};
+		}
+
+		private static TimeSpan ToTimeSpan(long ticks) => new TimeSpan((long)(ticks * ticksToTimeSpan));
+	}
+
+	/// <summary>
+	/// Records calls of engine functions with their arguments into a binary trace which can be replayed with <see cref="InteropTrace"/>, calls are recorded only when the framework is compiled with interop recording
+	/// </summary>
+	public static unsafe partial class InteropRecorder {
+		internal const int magic = 0x54524355;
+		internal const int version = 1;
+		private const int bufferSize = 64 * 1024;
+		private static readonly List<Type> functions = new List<Type>();
+		private static FileStream stream;
+		private static byte[] buffer;
+		private static int position;
+		private static bool[] defined;
+		private static Dictionary<string, int> strings;
+		private static Dictionary<IntPtr, int> objects;
+		private static int objectCount;
+		private static int calls;
+		private static int depth;
+		private static int threadId;
+		private static ulong frame;
+		private static long timestamp;
+
+		internal enum Record : byte {
+			Function,
+			Frame,
+			Call,
+			NestedCall,
+			Result
+		}
+
+		internal enum Argument : byte {
+			Int32,
+			UInt32,
+			Int64,
+			UInt64,
+			Single,
+			Double,
+			Byte,
+			Pointer,
+			String,
+			Value
+		}
+
+		/// <summary>
+		/// Returns <c>true</c> if the framework is compiled with interop recording
+		/// </summary>
+		public static bool IsEnabled => Shared.interopRecording;
+
+		/// <summary>
+		/// Returns <c>true</c> if the calls are recorded
+		/// </summary>
+		public static bool IsRecording => stream != null;
+
+		/// <summary>
+		/// Starts recording of the calls made from the current thread to the file
+		/// </summary>
+		public static void Start(string path) {
+			if (path == null)
+				throw new ArgumentNullException(nameof(path));
+
+			if (!IsEnabled)
+				throw new InvalidOperationException("The framework is compiled without interop recording");
+
+			if (stream != null)
+				throw new InvalidOperationException("Recording is already started");
+
+			Directory.CreateDirectory(System.IO.Path.GetDirectoryName(System.IO.Path.GetFullPath(path)));
+
+			stream = File.Create(path);
+			buffer = new byte[bufferSize];
+			position = 0;
+			defined = new bool[functions.Count];
+			strings = new Dictionary<string, int>();
+			objects = new Dictionary<IntPtr, int>();
+			objectCount = 0;
+			calls = 0;
+			depth = 0;
+			threadId = Environment.CurrentManagedThreadId;
+			frame = Logger.Frame;
+			timestamp = Stopwatch.GetTimestamp();
+
+			Unsafe.WriteUnaligned(ref buffer[0], magic);
+			Unsafe.WriteUnaligned(ref buffer[4], version);
+			Unsafe.WriteUnaligned(ref buffer[8], Stopwatch.Frequency);
+			position = 16;
+			buffer[position++] = (byte)Record.Frame;
+			WriteVarint(frame);
+		}
+
+		/// <summary>
+		/// Stops recording and closes the file
+		/// </summary>
+		public static void Stop() {
+			if (stream == null)
+				return;
+
+			try {
+				Flush();
+			}
+
+			finally {
+				stream.Dispose();
+				stream = null;
+				buffer = null;
+				strings = null;
+				objects = null;
+			}
+		}
+
+		internal static int Register(Type function) {
+			functions.Add(function);
+
+			return functions.Count - 1;
+		}
+
+		internal static void Initialize() => AssemblyLoadContext.GetLoadContext(typeof(InteropRecorder).Assembly).Unloading += context => Stop();
+
+		internal static Argument GetArgument(Type type, out int size) {
+			size = 0;
+
+			if (type.IsByRef) {
+				size = (int)typeof(Unsafe).GetMethod(nameof(Unsafe.SizeOf)).MakeGenericMethod(type.GetElementType()).Invoke(null, null);
+
+				return Argument.Value;
+			}
+
+			if (type.IsEnum)
+				type = Enum.GetUnderlyingType(type);
+
+			if (type == typeof(string))
+				return Argument.String;
+
+			if (type == typeof(IntPtr))
+				return Argument.Pointer;
+
+			if (type == typeof(Bool) || type == typeof(bool) || type == typeof(byte) || type == typeof(sbyte))
+				return Argument.Byte;
+
+			if (type == typeof(short) || type == typeof(ushort) || type == typeof(int))
+				return Argument.Int32;
+
+			if (type == typeof(uint))
+				return Argument.UInt32;
+
+			if (type == typeof(long))
+				return Argument.Int64;
+
+			if (type == typeof(ulong))
+				return Argument.UInt64;
+
+			if (type == typeof(float))
+				return Argument.Single;
+
+			if (type == typeof(double))
+				return Argument.Double;
+
+			throw new NotSupportedException("Recording of " + type + " arguments is not supported");
+		}
+
+		// Returns the index of the call or -1 if the call is not recorded, calls which are made by the managed code invoked from another call are marked as nested
+		internal static int Begin(int function) {
+			if (stream == null || Environment.CurrentManagedThreadId != threadId)
+				return -1;
+
+			long current = Stopwatch.GetTimestamp();
+			ulong currentFrame = Logger.Frame;
+
+			if (!defined[function])
+				Define(function);
+
+			Ensure(32);
+
+			if (currentFrame != frame) {
+				frame = currentFrame;
+				buffer[position++] = (byte)Record.Frame;
+				WriteVarint(frame);
+			}
+
+			buffer[position++] = (byte)(depth++ == 0 ? Record.Call : Record.NestedCall);
+			WriteVarint((uint)function);
+			WriteVarint((ulong)(current - timestamp));
+			timestamp = current;
+
+			return calls++;
+		}
+
+		internal static void End() {
+			if (depth > 0)
+				depth--;
+		}
+
+		// Pointers returned by the functions are assigned to new objects, so the replay can bind them to the pointers returned at that time, functions which return strings are not recorded with their results
+		internal static void End(IntPtr result, int call) {
+			End();
+
+			if (stream == null || result == IntPtr.Zero)
+				return;
+
+			int id = ++objectCount;
+
+			objects[result] = id;
+			Ensure(21);
+			buffer[position++] = (byte)Record.Result;
+			WriteVarint((uint)(calls - 1 - call));
+			WriteVarint((uint)id);
+		}
+
+		internal static void WriteInt32(int value) {
+			Ensure(5);
+			WriteVarint((uint)((value << 1) ^ (value >> 31)));
+		}
+
+		internal static void WriteUInt32(uint value) {
+			Ensure(5);
+			WriteVarint(value);
+		}
+
+		internal static void WriteInt64(long value) {
+			Ensure(10);
+			WriteVarint((ulong)((value << 1) ^ (value >> 63)));
+		}
+
+		internal static void WriteUInt64(ulong value) {
+			Ensure(10);
+			WriteVarint(value);
+		}
+
+		internal static void WriteSingle(float value) => WriteValue(ref value);
+
+		internal static void WriteDouble(double value) => WriteValue(ref value);
+
+		internal static void WriteByte(byte value) {
+			Ensure(1);
+			buffer[position++] = value;
+		}
+
+		// Objects are identified by the first appearance of their pointers in the trace
+		internal static void WritePointer(IntPtr value) {
+			Ensure(5);
+
+			if (value == IntPtr.Zero) {
+				buffer[position++] = 0;
+
+				return;
+			}
+
+			if (!objects.TryGetValue(value, out int id)) {
+				id = ++objectCount;
+				objects.Add(value, id);
+			}
+
+			WriteVarint((uint)id);
+		}
+
+		// Strings are identified by the first appearance of their values in the trace which is followed by the value in UTF-8
+		internal static void WriteString(string value) {
+			Ensure(5);
+
+			if (value == null) {
+				buffer[position++] = 0;
+
+				return;
+			}
+
+			if (strings.TryGetValue(value, out int id)) {
+				WriteVarint((uint)id);
+
+				return;
+			}
+
+			id = strings.Count + 1;
+			strings.Add(value, id);
+			WriteVarint((uint)id);
+			WriteText(value);
+		}
+
+		internal static void WriteValue<T>(ref T value) where T : unmanaged {
+			Ensure(sizeof(T));
+			Unsafe.WriteUnaligned(ref buffer[position], value);
+			position += sizeof(T);
+		}
+
+		private static void Define(int function) {
+			Type type = functions[function];
+			ParameterInfo[] parameters = type.GetMethod("Invoke").GetParameters();
+
+			defined[function] = true;
+			Ensure(6 + parameters.Length * 6);
+			buffer[position++] = (byte)Record.Function;
+			WriteVarint((uint)function);
+			WriteVarint((uint)parameters.Length);
+
+			foreach (ParameterInfo parameter in parameters) {
+				Argument argument = GetArgument(parameter.ParameterType, out int size);
+
+				buffer[position++] = (byte)argument;
+
+				if (argument == Argument.Value)
+					WriteVarint((uint)size);
+			}
+
+			WriteText(type.FullName);
+		}
+
+		private static void WriteText(string value) {
+			int length = System.Text.Encoding.UTF8.GetByteCount(value);
+
+			Ensure(length + 5);
+			WriteVarint((uint)length);
+			position += System.Text.Encoding.UTF8.GetBytes(value, 0, value.Length, buffer, position);
+		}
+
+		private static void WriteVarint(ulong value) {
+			while (value >= 0x80) {
+				buffer[position++] = (byte)(value | 0x80);
+				value >>= 7;
+			}
+
+			buffer[position++] = (byte)value;
+		}
+
+		private static void Ensure(int size) {
+			if (position + size <= buffer.Length)
+				return;
+
+			Flush();
+
+			if (size > buffer.Length)
+				buffer = new byte[size];
+		}
+
+		private static void Flush() {
+			stream.Write(buffer, 0, position);
+			position = 0;
+		}
+	}
+
+	/// <summary>
+	/// A trace of engine function calls recorded by <see cref="InteropRecorder"/>, the calls of each recorded frame are replayed through the same functions against the current engine or backend
+	/// </summary>
+	public sealed unsafe partial class InteropTrace {
+		private readonly ReplayFunction[] functions;
+		private readonly string[] strings;
+		private readonly Call[] calls;
+		private readonly Frame[] frames;
+		private readonly byte[] arguments;
+		private readonly IntPtr[] objects;
+		private readonly List<Actor> actors = new List<Actor>();
+		private readonly List<ActorComponent> components = new List<ActorComponent>();
+		private readonly double ticksToMilliseconds;
+		private int position;
+		private int result;
+		private bool resolved;
+
+		private struct Call {
+			internal int function;
+			internal int arguments;
+			internal int result;
+		}
+
+		private struct Frame {
+			internal ulong number;
+			internal int first;
+			internal int count;
+			internal long ticks;
+		}
+
+		private InteropTrace(ReplayFunction[] functions, string[] strings, Call[] calls, Frame[] frames, byte[] arguments, int objects, long frequency) {
+			this.functions = functions;
+			this.strings = strings;
+			this.calls = calls;
+			this.frames = frames;
+			this.arguments = arguments;
+			this.objects = new IntPtr[objects + 1];
+			ticksToMilliseconds = 1000.0 / frequency;
+		}
+
+		/// <summary>
+		/// Returns the number of recorded frames
+		/// </summary>
+		public int FrameCount => frames.Length;
+
+		/// <summary>
+		/// Returns the number of recorded calls excluding nested calls
+		/// </summary>
+		public int CallCount => calls.Length;
+
+		/// <summary>
+		/// Returns the engine frame number of the recorded frame at the specified index
+		/// </summary>
+		public ulong GetFrameNumber(int frame) => GetFrame(frame).number;
+
+		/// <summary>
+		/// Returns the number of calls in the recorded frame at the specified index
+		/// </summary>
+		public int GetCallCount(int frame) => GetFrame(frame).count;
+
+		/// <summary>
+		/// Returns the time in milliseconds between the first and the last call in the recorded frame at the specified index
+		/// </summary>
+		public double GetRecordedTime(int frame) => GetFrame(frame).ticks * ticksToMilliseconds;
+
+		/// <summary>
+		/// Loads the trace from the file, the framework should be the same as the recording one
+		/// </summary>
+		public static InteropTrace Load(string path) {
+			if (path == null)
+				throw new ArgumentNullException(nameof(path));
+
+			Reader reader = new Reader(File.ReadAllBytes(path));
+
+			if (reader.data.Length < 16 || Unsafe.ReadUnaligned<int>(ref reader.data[0]) != InteropRecorder.magic || Unsafe.ReadUnaligned<int>(ref reader.data[4]) != InteropRecorder.version)
+				throw new InvalidDataException("The file is not an interop trace or its version is not supported");
+
+			long frequency = Unsafe.ReadUnaligned<long>(ref reader.data[8]);
+			List<ReplayFunction> functions = new List<ReplayFunction>();
+			List<InteropRecorder.Argument[]> signatures = new List<InteropRecorder.Argument[]>();
+			List<int[]> sizes = new List<int[]>();
+			List<string> strings = new List<string>();
+			List<Call> calls = new List<Call>();
+			List<int> recordedCalls = new List<int>();
+			List<Frame> frames = new List<Frame>();
+			Writer arguments = new Writer();
+			Frame frame = default(Frame);
+			long frameTimestamp = 0;
+			long timestamp = 0;
+			int objects = 0;
+
+			reader.position = 16;
+
+			while (reader.position < reader.data.Length) {
+				InteropRecorder.Record record = (InteropRecorder.Record)reader.data[reader.position++];
+
+				switch (record) {
+					case InteropRecorder.Record.Function: {
+						int id = (int)reader.ReadVarint();
+						int count = (int)reader.ReadVarint();
+						InteropRecorder.Argument[] functionArguments = new InteropRecorder.Argument[count];
+						int[] functionSizes = new int[count];
+
+						for (int i = 0; i < count; i++) {
+							functionArguments[i] = (InteropRecorder.Argument)reader.data[reader.position++];
+
+							if (functionArguments[i] == InteropRecorder.Argument.Value)
+								functionSizes[i] = (int)reader.ReadVarint();
+						}
+
+						string name = reader.ReadText();
+
+						while (functions.Count <= id) {
+							functions.Add(null);
+							signatures.Add(null);
+							sizes.Add(null);
+						}
+
+						functions[id] = GenerateReplayFunction(name, functionArguments, functionSizes);
+						signatures[id] = functionArguments;
+						sizes[id] = functionSizes;
+
+						break;
+					}
+
+					case InteropRecorder.Record.Frame: {
+						if (frame.count > 0)
+							frames.Add(frame);
+
+						frame = new Frame { number = reader.ReadVarint(), first = calls.Count };
+
+						break;
+					}
+
+					case InteropRecorder.Record.Call:
+					case InteropRecorder.Record.NestedCall: {
+						int function = (int)reader.ReadVarint();
+						int offset = arguments.position;
+
+						timestamp += (long)reader.ReadVarint();
+
+						for (int i = 0; i < signatures[function].Length; i++) {
+							switch (signatures[function][i]) {
+								case InteropRecorder.Argument.Int32:
+								case InteropRecorder.Argument.UInt32:
+								case InteropRecorder.Argument.Int64:
+								case InteropRecorder.Argument.UInt64:
+									arguments.WriteVarint(reader.ReadVarint());
+
+									break;
+
+								case InteropRecorder.Argument.Pointer: {
+									ulong id = reader.ReadVarint();
+
+									objects = Math.Max(objects, (int)id);
+									arguments.WriteVarint(id);
+
+									break;
+								}
+
+								case InteropRecorder.Argument.String: {
+									ulong id = reader.ReadVarint();
+
+									if (id > (ulong)strings.Count)
+										strings.Add(reader.ReadText());
+
+									arguments.WriteVarint(id);
+
+									break;
+								}
+
+								case InteropRecorder.Argument.Single:
+									arguments.WriteBytes(reader.ReadBytes(4));
+
+									break;
+
+								case InteropRecorder.Argument.Double:
+									arguments.WriteBytes(reader.ReadBytes(8));
+
+									break;
+
+								case InteropRecorder.Argument.Byte:
+									arguments.WriteBytes(reader.ReadBytes(1));
+
+									break;
+
+								case InteropRecorder.Argument.Value:
+									arguments.WriteBytes(reader.ReadBytes(sizes[function][i]));
+
+									break;
+							}
+						}
+
+						// Nested calls are made again by the managed code which is invoked during the replay of the outer call
+						if (record == InteropRecorder.Record.NestedCall) {
+							recordedCalls.Add(-1);
+							arguments.position = offset;
+
+							break;
+						}
+
+						if (frame.count++ == 0)
+							frameTimestamp = timestamp;
+
+						frame.ticks = timestamp - frameTimestamp;
+						recordedCalls.Add(calls.Count);
+						calls.Add(new Call { function = function, arguments = offset });
+
+						break;
+					}
+
+					case InteropRecorder.Record.Result: {
+						int call = recordedCalls[recordedCalls.Count - 1 - (int)reader.ReadVarint()];
+						int id = (int)reader.ReadVarint();
+
+						objects = Math.Max(objects, id);
+
+						if (call >= 0)
+							calls[call] = new Call { function = calls[call].function, arguments = calls[call].arguments, result = id };
+
+						break;
+					}
+
+					default:
+						throw new InvalidDataException("The trace is corrupted");
+				}
+			}
+
+			if (frame.count > 0)
+				frames.Add(frame);
+
+			return new InteropTrace(functions.ToArray(), strings.ToArray(), calls.ToArray(), frames.ToArray(), arguments.ToArray(), objects, frequency);
+		}
+
+		/// <summary>
+		/// Replays the calls of the recorded frame at the specified index
+		/// </summary>
+		/// <returns>The number of skipped calls with arguments of objects which are not created by the replayed calls, or of the functions which are not present in the framework</returns>
+		public int Replay(int frame) {
+			Frame replay = GetFrame(frame);
+			int skipped = 0;
+
+			for (int i = replay.first; i < replay.first + replay.count; i++) {
+				Call call = calls[i];
+				ReplayFunction function = functions[call.function];
+
+				position = call.arguments;
+				result = call.result;
+				resolved = true;
+
+				if (function == null || !function(this))
+					skipped++;
+			}
+
+			return skipped;
+		}
+
+		/// <summary>
+		/// Destroys the actors and components created by the replayed calls and clears the objects, should be called before the trace is replayed again from the first frame
+		/// </summary>
+		public void Reset() {
+			foreach (ActorComponent component in components) {
+				if (component.IsCreated)
+					component.Destroy();
+			}
+
+			foreach (Actor actor in actors) {
+				if (actor.IsSpawned)
+					actor.Destroy();
+			}
+
+			components.Clear();
+			actors.Clear();
+			Array.Clear(objects, 0, objects.Length);
+		}
+
+		private Frame GetFrame(int frame) {
+			if ((uint)frame >= (uint)frames.Length)
+				throw new ArgumentOutOfRangeException(nameof(frame));
+
+			return frames[frame];
+		}
+
+		private void Bind(IntPtr value) {
+			if (result != 0)
+				objects[result] = value;
+		}
+
+		// Spawned actors and created components are referenced by their serial numbers, so they can be destroyed on reset even if the replayed calls destroyed them before
+		private void BindActor(IntPtr value) {
+			Bind(value);
+
+			if (value != IntPtr.Zero)
+				actors.Add(new Actor(value));
+		}
+
+		private void BindComponent(IntPtr value) {
+			Bind(value);
+
+			if (value != IntPtr.Zero)
+				components.Add(new ActorComponent(value));
+		}
+
+		private ulong ReadVarint() {
+			ulong value = 0;
+			int shift = 0;
+			byte current;
+
+			do {
+				current = arguments[position++];
+				value |= (ulong)(current & 0x7F) << shift;
+				shift += 7;
+			} while ((current & 0x80) != 0);
+
+			return value;
+		}
+
+		private int ReadInt32() {
+			uint value = (uint)ReadVarint();
+
+			return (int)(value >> 1) ^ -(int)(value & 1);
+		}
+
+		private uint ReadUInt32() => (uint)ReadVarint();
+
+		private long ReadInt64() {
+			ulong value = ReadVarint();
+
+			return (long)(value >> 1) ^ -(long)(value & 1);
+		}
+
+		private ulong ReadUInt64() => ReadVarint();
+
+		private float ReadSingle() {
+			float value = default(float);
+
+			ReadValue(ref value);
+
+			return value;
+		}
+
+		private double ReadDouble() {
+			double value = default(double);
+
+			ReadValue(ref value);
+
+			return value;
+		}
+
+		private byte ReadByte() => arguments[position++];
+
+		private IntPtr ReadPointer() {
+			int id = (int)ReadVarint();
+
+			if (id == 0)
+				return IntPtr.Zero;
+
+			IntPtr value = objects[id];
+
+			if (value == IntPtr.Zero)
+				resolved = false;
+
+			return value;
+		}
+
+		private string ReadString() {
+			int id = (int)ReadVarint();
+
+			return id != 0 ? strings[id - 1] : null;
+		}
+
+		private void ReadValue<T>(ref T value) where T : unmanaged {
+			value = Unsafe.ReadUnaligned<T>(ref arguments[position]);
+			position += sizeof(T);
+		}
+
+		private sealed class Reader {
+			internal readonly byte[] data;
+			internal int position;
+
+			internal Reader(byte[] data) => this.data = data;
+
+			internal ulong ReadVarint() {
+				ulong value = 0;
+				int shift = 0;
+				byte current;
+
+				do {
+					current = data[position++];
+					value |= (ulong)(current & 0x7F) << shift;
+					shift += 7;
+				} while ((current & 0x80) != 0);
+
+				return value;
+			}
+
+			internal ReadOnlySpan<byte> ReadBytes(int count) {
+				ReadOnlySpan<byte> bytes = new ReadOnlySpan<byte>(data, position, count);
+
+				position += count;
+
+				return bytes;
+			}
+
+			internal string ReadText() {
+				int length = (int)ReadVarint();
+
+				return System.Text.Encoding.UTF8.GetString(ReadBytes(length));
+			}
+		}
+
+		private sealed class Writer {
+			private byte[] data = new byte[4096];
+			internal int position;
+
+			internal void WriteVarint(ulong value) {
+				Ensure(10);
+
+				while (value >= 0x80) {
+					data[position++] = (byte)(value | 0x80);
+					value >>= 7;
+				}
+
+				data[position++] = (byte)value;
+			}
+
+			internal void WriteBytes(ReadOnlySpan<byte> bytes) {
+				Ensure(bytes.Length);
+				bytes.CopyTo(new Span<byte>(data, position, bytes.Length));
+				position += bytes.Length;
+			}
+
+			internal byte[] ToArray() => new ReadOnlySpan<byte>(data, 0, position).ToArray();
+
+			private void Ensure(int size) {
+				if (position + size > data.Length)
+					Array.Resize(ref data, Math.Max(data.Length * 2, position + size));
+			}
+		}
+	}
+
+	/// <summary>
+	/// Records scene mutations into a native buffer and applies them in a single call to the engine, the buffer is flushed automatically when full
+	/// </summary>
+	public sealed unsafe partial class CommandBuffer : IDisposable {
+		private Command* commands;
+		private int capacity;
+		private int count;
+
+		/// <summary>
+		/// Creates the command buffer
+		/// </summary>
+		/// <param name="capacity">The maximum number of commands to record before the buffer is flushed automatically</param>
+		public CommandBuffer(int capacity = 1024) {
+			if (capacity <= 0)
+				throw new ArgumentOutOfRangeException(nameof(capacity));
+
+			commands = (Command*)Marshal.AllocHGlobal(capacity * sizeof(Command));
+			this.capacity = capacity;
+		}
+
+		/// <summary/>
+		~CommandBuffer() => Release();
+
+		/// <summary>
+		/// Returns the number of recorded commands which are not yet applied
+		/// </summary>
+		public int Count => count;
+
+		/// <summary>
+		/// Returns the maximum number of commands which can be recorded before the buffer is flushed automatically
+		/// </summary>
+		public int Capacity => capacity;
+
+		/// <summary>
+		/// Applies all recorded commands in the order of recording and clears the buffer, commands of objects destroyed after recording are skipped
+		/// </summary>
+		public void Flush() {
+			if (commands == null)
+				throw new ObjectDisposedException(nameof(CommandBuffer));
+
+			if (count > 0) {
+				execute((IntPtr)commands, count);
+				count = 0;
+			}
+		}
+
+		/// <summary>
+		/// Discards all recorded commands
+		/// </summary>
+		public void Clear() => count = 0;
+
+		/// <summary>
+		/// Releases the native memory of the buffer, recorded commands which are not flushed are discarded
+		/// </summary>
+		public void Dispose() {
+			Release();
+			GC.SuppressFinalize(this);
+		}
+
+		/// <summary>
+		/// Records a delta to the location of the component in its local reference frame
+		/// </summary>
+		public void AddLocalOffset(SceneComponent sceneComponent, in Vector3 deltaLocation) {
+			if (sceneComponent == null)
+				throw new ArgumentNullException(nameof(sceneComponent));
+
+			Record(CommandType.AddLocalOffset, sceneComponent.Reference)->vector = deltaLocation;
+		}
+
+		/// <summary>
+		/// Records a delta to the rotation of the component in its local reference frame
+		/// </summary>
+		public void AddLocalRotation(SceneComponent sceneComponent, in Quaternion deltaRotation) {
+			if (sceneComponent == null)
+				throw new ArgumentNullException(nameof(sceneComponent));
+
+			Record(CommandType.AddLocalRotation, sceneComponent.Reference)->rotation = deltaRotation;
+		}
+
+		/// <summary>
+		/// Records a delta to the translation of the component relative to its parent
+		/// </summary>
+		public void AddRelativeLocation(SceneComponent sceneComponent, in Vector3 deltaLocation) {
+			if (sceneComponent == null)
+				throw new ArgumentNullException(nameof(sceneComponent));
+
+			Record(CommandType.AddRelativeLocation, sceneComponent.Reference)->vector = deltaLocation;
+		}
+
+		/// <summary>
+		/// Records a delta to the rotation of the component relative to its parent
+		/// </summary>
+		public void AddRelativeRotation(SceneComponent sceneComponent, in Quaternion deltaRotation) {
+			if (sceneComponent == null)
+				throw new ArgumentNullException(nameof(sceneComponent));
+
+			Record(CommandType.AddRelativeRotation, sceneComponent.Reference)->rotation = deltaRotation;
+		}
+
+		/// <summary>
+		/// Records a delta to the transform of the component in its local reference frame, scale is unchanged
+		/// </summary>
+		public void AddLocalTransform(SceneComponent sceneComponent, in Transform deltaTransform) {
+			if (sceneComponent == null)
+				throw new ArgumentNullException(nameof(sceneComponent));
+
+			Record(CommandType.AddLocalTransform, sceneComponent.Reference)->transform = deltaTransform;
+		}
+
+		/// <summary>
+		/// Records a delta to the location of the component in world space
+		/// </summary>
+		public void AddWorldOffset(SceneComponent sceneComponent, in Vector3 deltaLocation) {
+			if (sceneComponent == null)
+				throw new ArgumentNullException(nameof(sceneComponent));
+
+			Record(CommandType.AddWorldOffset, sceneComponent.Reference)->vector = deltaLocation;
+		}
+
+		/// <summary>
+		/// Records a delta to the rotation of the component in world space
+		/// </summary>
+		public void AddWorldRotation(SceneComponent sceneComponent, in Quaternion deltaRotation) {
+			if (sceneComponent == null)
+				throw new ArgumentNullException(nameof(sceneComponent));
+
+			Record(CommandType.AddWorldRotation, sceneComponent.Reference)->rotation = deltaRotation;
+		}
+
+		/// <summary>
+		/// Records a delta to the transform of the component in world space, scale is unchanged
+		/// </summary>
+		public void AddWorldTransform(SceneComponent sceneComponent, in Transform deltaTransform) {
+			if (sceneComponent == null)
+				throw new ArgumentNullException(nameof(sceneComponent));
+
+			Record(CommandType.AddWorldTransform, sceneComponent.Reference)->transform = deltaTransform;
+		}
+
+		/// <summary>
+		/// Records the location of the component relative to its parent
+		/// </summary>
+		public void SetRelativeLocation(SceneComponent sceneComponent, in Vector3 location) {
+			if (sceneComponent == null)
+				throw new ArgumentNullException(nameof(sceneComponent));
+
+			Record(CommandType.SetRelativeLocation, sceneComponent.Reference)->vector = location;
+		}
+
+		/// <summary>
+		/// Records the rotation of the component relative to its parent
+		/// </summary>
+		public void SetRelativeRotation(SceneComponent sceneComponent, in Quaternion rotation) {
+			if (sceneComponent == null)
+				throw new ArgumentNullException(nameof(sceneComponent));
+
+			Record(CommandType.SetRelativeRotation, sceneComponent.Reference)->rotation = rotation;
+		}
+
+		/// <summary>
+		/// Records the transform of the component relative to its parent
+		/// </summary>
+		public void SetRelativeTransform(SceneComponent sceneComponent, in Transform transform) {
+			if (sceneComponent == null)
+				throw new ArgumentNullException(nameof(sceneComponent));
+
+			Record(CommandType.SetRelativeTransform, sceneComponent.Reference)->transform = transform;
+		}
+
+		/// <summary>
+		/// Records the location of the component in world space
+		/// </summary>
+		public void SetWorldLocation(SceneComponent sceneComponent, in Vector3 location) {
+			if (sceneComponent == null)
+				throw new ArgumentNullException(nameof(sceneComponent));
+
+			Record(CommandType.SetWorldLocation, sceneComponent.Reference)->vector = location;
+		}
+
+		/// <summary>
+		/// Records the rotation of the component in world space
+		/// </summary>
+		public void SetWorldRotation(SceneComponent sceneComponent, in Quaternion rotation) {
+			if (sceneComponent == null)
+				throw new ArgumentNullException(nameof(sceneComponent));
+
+			Record(CommandType.SetWorldRotation, sceneComponent.Reference)->rotation = rotation;
+		}
+
+		/// <summary>
+		/// Records the transform of the component in world space
+		/// </summary>
+		public void SetWorldTransform(SceneComponent sceneComponent, in Transform transform) {
+			if (sceneComponent == null)
+				throw new ArgumentNullException(nameof(sceneComponent));
+
+			Record(CommandType.SetWorldTransform, sceneComponent.Reference)->transform = transform;
+		}
+
+		/// <summary>
+		/// Records an angular impulse in degrees to a rigid body
+		/// </summary>
+		public void AddAngularImpulseInDegrees(PrimitiveComponent primitiveComponent, in Vector3 impulse, Name boneName = default(Name), bool velocityChange = false) {
+			if (primitiveComponent == null)
+				throw new ArgumentNullException(nameof(primitiveComponent));
+
+			Command* command = Record(CommandType.AddAngularImpulseInDegrees, primitiveComponent.Reference);
+
+			command->vector = impulse;
+			command->boneName = boneName;
+			command->flags = velocityChange ? 1 : 0;
+		}
+
+		/// <summary>
+		/// Records an angular impulse in radians to a rigid body
+		/// </summary>
+		public void AddAngularImpulseInRadians(PrimitiveComponent primitiveComponent, in Vector3 impulse, Name boneName = default(Name), bool velocityChange = false) {
+			if (primitiveComponent == null)
+				throw new ArgumentNullException(nameof(primitiveComponent));
+
+			Command* command = Record(CommandType.AddAngularImpulseInRadians, primitiveComponent.Reference);
+
+			command->vector = impulse;
+			command->boneName = boneName;
+			command->flags = velocityChange ? 1 : 0;
+		}
+
+		/// <summary>
+		/// Records a force to a rigid body
+		/// </summary>
+		public void AddForce(PrimitiveComponent primitiveComponent, in Vector3 force, Name boneName = default(Name), bool accelerationChange = false) {
+			if (primitiveComponent == null)
+				throw new ArgumentNullException(nameof(primitiveComponent));
+
+			Command* command = Record(CommandType.AddForce, primitiveComponent.Reference);
+
+			command->vector = force;
+			command->boneName = boneName;
+			command->flags = accelerationChange ? 1 : 0;
+		}
+
+		/// <summary>
+		/// Records a force to a rigid body at a specific location, optionally in local space
+		/// </summary>
+		public void AddForceAtLocation(PrimitiveComponent primitiveComponent, in Vector3 force, in Vector3 location, Name boneName = default(Name), bool localSpace = false) {
+			if (primitiveComponent == null)
+				throw new ArgumentNullException(nameof(primitiveComponent));
+
+			Command* command = Record(CommandType.AddForceAtLocation, primitiveComponent.Reference);
+
+			command->vector = force;
+			command->location = location;
+			command->boneName = boneName;
+			command->flags = localSpace ? 1 : 0;
+		}
+
+		/// <summary>
+		/// Records an impulse to a rigid body
+		/// </summary>
+		public void AddImpulse(PrimitiveComponent primitiveComponent, in Vector3 impulse, Name boneName = default(Name), bool velocityChange = false) {
+			if (primitiveComponent == null)
+				throw new ArgumentNullException(nameof(primitiveComponent));
+
+			Command* command = Record(CommandType.AddImpulse, primitiveComponent.Reference);
+
+			command->vector = impulse;
+			command->boneName = boneName;
+			command->flags = velocityChange ? 1 : 0;
+		}
+
+		/// <summary>
+		/// Records an impulse to a rigid body at a specific location
+		/// </summary>
+		public void AddImpulseAtLocation(PrimitiveComponent primitiveComponent, in Vector3 impulse, in Vector3 location, Name boneName = default(Name)) {
+			if (primitiveComponent == null)
+				throw new ArgumentNullException(nameof(primitiveComponent));
+
+			Command* command = Record(CommandType.AddImpulseAtLocation, primitiveComponent.Reference);
+
+			command->vector = impulse;
+			command->location = location;
+			command->boneName = boneName;
+		}
+
+		/// <summary>
+		/// Records a torque in degrees to a rigid body
+		/// </summary>
+		public void AddTorqueInDegrees(PrimitiveComponent primitiveComponent, in Vector3 torque, Name boneName = default(Name), bool accelerationChange = false) {
+			if (primitiveComponent == null)
+				throw new ArgumentNullException(nameof(primitiveComponent));
+
+			Command* command = Record(CommandType.AddTorqueInDegrees, primitiveComponent.Reference);
+
+			command->vector = torque;
+			command->boneName = boneName;
+			command->flags = accelerationChange ? 1 : 0;
+		}
+
+		/// <summary>
+		/// Records a torque in radians to a rigid body
+		/// </summary>
+		public void AddTorqueInRadians(PrimitiveComponent primitiveComponent, in Vector3 torque, Name boneName = default(Name), bool accelerationChange = false) {
+			if (primitiveComponent == null)
+				throw new ArgumentNullException(nameof(primitiveComponent));
+
+			Command* command = Record(CommandType.AddTorqueInRadians, primitiveComponent.Reference);
+
+			command->vector = torque;
+			command->boneName = boneName;
+			command->flags = accelerationChange ? 1 : 0;
+		}
+
+		/// <summary>
+		/// Records the actor to be hidden
+		/// </summary>
+		public void Hide(Actor actor, bool value) {
+			if (actor == null)
+				throw new ArgumentNullException(nameof(actor));
+
+			Record(CommandType.Hide, actor.Reference)->flags = value ? 1 : 0;
+		}
+
+		/// <summary>
+		/// Records the collision detection of the actor
+		/// </summary>
+		public void SetEnableCollision(Actor actor, bool value) {
+			if (actor == null)
+				throw new ArgumentNullException(nameof(actor));
+
+			Record(CommandType.SetEnableCollision, actor.Reference)->flags = value ? 1 : 0;
+		}
+
+		/// <summary>
+		/// Records a teleport of an actor to a new location
+		/// </summary>
+		/// <param name="actor">The actor to teleport</param>
+		/// <param name="destinationLocation">The target destination point</param>
+		/// <param name="destinationRotation">The target rotation at the destination</param>
+		/// <param name="noCheck">If <c>true</c>, should skip checking for positioning in the world or relative to other actors trying to slightly move the actor out</param>
+		public void TeleportTo(Actor actor, in Vector3 destinationLocation, in Quaternion destinationRotation, bool noCheck = false) {
+			if (actor == null)
+				throw new ArgumentNullException(nameof(actor));
+
+			Command* command = Record(CommandType.TeleportTo, actor.Reference);
+
+			command->vector = destinationLocation;
+			command->destinationRotation = destinationRotation;
+			command->flags = noCheck ? 1 : 0;
+		}
+
+		private Command* Record(CommandType type, in ObjectReference reference) {
+			if (commands == null)
+				throw new ObjectDisposedException(nameof(CommandBuffer));
+
+			if (count == capacity)
+				Flush();
+
+			Command* command = &commands[count++];
+
+			command->type = type;
+			command->flags = 0;
+			command->objectIndex = reference.Index;
+			command->serialNumber = reference.SerialNumber;
+
+			return command;
+		}
+
+		private void Release() {
+			if (commands != null) {
+				Marshal.FreeHGlobal((IntPtr)commands);
+				commands = null;
+				count = 0;
+			}
+		}
+	}
+
+	/// <summary>
+	/// Interface for engine objects
+	/// </summary>
+	public interface IObject {
+		/// <summary/>
+		string Name { get; }
+		/// <summary/>
+		bool GetBool(string name, ref bool value);
+		/// <summary/>
+		bool GetByte(string name, ref byte value);
 		/// <summary/>
 		bool GetShort(string name, ref short value);
 		/// <summary/>
@@ -2810,6 +5128,165 @@ namespace UnrealEngine.Framework {
 		bool SetText(string name, string value);
 	}
 
+	/// <summary>
+	/// A static function that is called directly by the tick task manager of the engine on every frame or at the specified interval, remains registered until unregistered or the world is torn down
+	/// </summary>
+	public partial class TickFunction : IEquatable<TickFunction> {
+		private delegate void InvokeFunction(IntPtr function, float deltaTime);
+
+		private static readonly IntPtr execute = typeof(TickFunction).GetMethod(nameof(Execute), BindingFlags.NonPublic | BindingFlags.Static).MethodHandle.GetFunctionPointer();
+		private static readonly InvokeFunction invoke = Shared.GenerateManagedFunction<InvokeFunction>();
+
+		private IntPtr pointer;
+
+		internal IntPtr Pointer {
+			get {
+				if (!IsCreated)
+					throw new InvalidOperationException();
+
+				return pointer;
+			}
+
+			set {
+				if (value == IntPtr.Zero)
+					throw new InvalidOperationException();
+
+				pointer = value;
+			}
+		}
+
+		private TickFunction(IntPtr pointer) => Pointer = pointer;
+
+		/// <summary>
+		/// Returns <c>true</c> if the tick function is registered
+		/// </summary>
+		public bool IsCreated => pointer != IntPtr.Zero && isRegistered(pointer);
+
+		/// <summary>
+		/// Gets or sets whether the tick function is enabled
+		/// </summary>
+		public bool Enabled {
+			get => isEnabled(Pointer);
+			set => setEnabled(Pointer, value);
+		}
+
+		/// <summary>
+		/// Gets or sets the interval in seconds between calls, zero means every frame
+		/// </summary>
+		public float Interval {
+			get => getInterval(Pointer);
+			set => setInterval(Pointer, value);
+		}
+
+		/// <summary>
+		/// Indicates equality of objects
+		/// </summary>
+		public bool Equals(TickFunction other) => IsCreated && pointer == other?.pointer;
+
+		/// <summary>
+		/// Returns a hash code for the object
+		/// </summary>
+		public override int GetHashCode() => pointer.GetHashCode();
+
+		/// <summary>
+		/// Registers a static tick function in the current world
+		/// </summary>
+		/// <param name="action">The static function to call on tick</param>
+		/// <param name="group">The group of a frame in which the function is called</param>
+		/// <param name="interval">The interval in seconds between calls, zero means every frame</param>
+		/// <param name="tickEvenWhenPaused">If <c>true</c>, the function is called while the game is paused</param>
+		/// <exception cref="System.ArgumentException">Thrown if <paramref name="action"/> is not static</exception>
+		/// <exception cref="System.InvalidOperationException">Thrown if the world has no persistent level</exception>
+		public static TickFunction Register(TickDelegate action, TickGroup group = TickGroup.PrePhysics, float interval = 0.0f, bool tickEvenWhenPaused = false) {
+			if (action == null)
+				throw new ArgumentNullException(nameof(action));
+
+			if (!action.Method.IsStatic)
+				throw new ArgumentException(nameof(action) + " should be static");
+
+			return new TickFunction(register(execute, action.Method.MethodHandle.GetFunctionPointer(), group, interval, tickEvenWhenPaused));
+		}
+
+		/// <summary>
+		/// Unregisters the tick function and removes it from prerequisites of other tick functions
+		/// </summary>
+		public void Unregister() {
+			unregister(Pointer);
+			pointer = IntPtr.Zero;
+		}
+
+		/// <summary>
+		/// Adds a tick function that should be called before this one
+		/// </summary>
+		public void AddPrerequisite(TickFunction prerequisite) {
+			if (prerequisite == null)
+				throw new ArgumentNullException(nameof(prerequisite));
+
+			addPrerequisite(Pointer, prerequisite.Pointer);
+		}
+
+		/// <summary>
+		/// Adds an actor that should be ticked before this tick function
+		/// </summary>
+		public void AddPrerequisite(Actor prerequisite) {
+			if (prerequisite == null)
+				throw new ArgumentNullException(nameof(prerequisite));
+
+			addActorPrerequisite(Pointer, prerequisite.Pointer);
+		}
+
+		/// <summary>
+		/// Adds a component that should be ticked before this tick function
+		/// </summary>
+		public void AddPrerequisite(ActorComponent prerequisite) {
+			if (prerequisite == null)
+				throw new ArgumentNullException(nameof(prerequisite));
+
+			addComponentPrerequisite(Pointer, prerequisite.Pointer);
+		}
+
+		/// <summary>
+		/// Removes a tick function from prerequisites
+		/// </summary>
+		public void RemovePrerequisite(TickFunction prerequisite) {
+			if (prerequisite == null)
+				throw new ArgumentNullException(nameof(prerequisite));
+
+			removePrerequisite(Pointer, prerequisite.Pointer);
+		}
+
+		/// <summary>
+		/// Removes an actor from prerequisites
+		/// </summary>
+		public void RemovePrerequisite(Actor prerequisite) {
+			if (prerequisite == null)
+				throw new ArgumentNullException(nameof(prerequisite));
+
+			removeActorPrerequisite(Pointer, prerequisite.Pointer);
+		}
+
+		/// <summary>
+		/// Removes a component from prerequisites
+		/// </summary>
+		public void RemovePrerequisite(ActorComponent prerequisite) {
+			if (prerequisite == null)
+				throw new ArgumentNullException(nameof(prerequisite));
+
+			removeComponentPrerequisite(Pointer, prerequisite.Pointer);
+		}
+
+		// Called by the engine in place of the function, an exception is reported instead of unwinding through the tick task manager
+		private static void Execute(IntPtr function, float deltaTime) {
+			try {
+				invoke(function, deltaTime);
+			}
+
+			catch (Exception exception) {
+				Debug.Exception(exception);
+			}
+		}
+	}
+
 	/// <summary>
 	/// Interface for console objects
 	/// </summary>
@@ -2882,11 +5359,8 @@ namespace UnrealEngine.Framework {
 
 	/// <summary>
 	/// Interface for console variables
-	/// </summary>
-	public partial class ConsoleVariable : ConsoleObject {
-		[ThreadStatic]
-		private static StringBuilder stringBuffer = new StringBuilder(8192);
-
+	/// </summary>
+	public partial class ConsoleVariable : ConsoleObject {
 		private protected ConsoleVariable() { }
 
 		internal ConsoleVariable(string name) => Name = name;
@@ -2909,12 +5383,16 @@ namespace UnrealEngine.Framework {
 		/// <summary>
 		/// Returns the value as a string, works on all types
 		/// </summary>
-		public string GetString() {
-			stringBuffer.Clear();
+		public string GetString() => StringMarshal.Decode(getString(Pointer));
 
-			getString(Pointer, stringBuffer);
+		/// <summary>
+		/// Writes the value as a string to the buffer without allocations, works on all types
+		/// </summary>
+		public void GetString(IBufferWriter<char> value) {
+			if (value == null)
+				throw new ArgumentNullException(nameof(value));
 
-			return stringBuffer.ToString();
+			StringMarshal.Decode(getString(Pointer), value);
 		}
 
 		/// <summary>
@@ -2962,10 +5440,10 @@ namespace UnrealEngine.Framework {
 	/// The base class of an object that can be placed or spawned in a level
 	/// </summary>
 	public partial class Actor : IObject, IEquatable<Actor> {
-		[ThreadStatic]
-		private static StringBuilder stringBuffer = new StringBuilder(8192);
+		private const int componentsStackLimit = 256;
 
 		private IntPtr pointer;
+		private ObjectReference reference;
 
 		internal IntPtr Pointer {
 			get {
@@ -2980,6 +5458,16 @@ namespace UnrealEngine.Framework {
 					throw new InvalidOperationException();
 
 				pointer = value;
+				reference = new ObjectReference(value);
+			}
+		}
+
+		internal ref readonly ObjectReference Reference {
+			get {
+				if (!IsSpawned)
+					throw new InvalidOperationException();
+
+				return ref reference;
 			}
 		}
 
@@ -3004,7 +5492,7 @@ namespace UnrealEngine.Framework {
 		/// <summary>
 		/// Returns <c>true</c> if the actor is spawned
 		/// </summary>
-		public bool IsSpawned => pointer != IntPtr.Zero && !isPendingKill(pointer);
+		public bool IsSpawned => reference.IsAlive(pointer);
 
 		/// <summary>
 		/// Returns <c>true</c> if the root component is <see cref="ComponentMobility.Movable"/>
@@ -3024,14 +5512,38 @@ namespace UnrealEngine.Framework {
 		/// <summary>
 		/// Returns the name of the actor
 		/// </summary>
-		public string Name {
-			get {
-				stringBuffer.Clear();
+		public string Name => StringMarshal.Decode(Object.getName(Pointer));
 
-				Object.getName(Pointer, stringBuffer);
+		/// <summary>
+		/// Copies the name of the actor to the span without allocations
+		/// </summary>
+		/// <returns><c>true</c> on success or <c>false</c> if the span is too small</returns>
+		public bool TryGetName(Span<char> name, out int length) => StringMarshal.Decode(Object.getName(Pointer), name, out length);
 
-				return stringBuffer.ToString();
-			}
+		/// <summary>
+		/// Writes the name of the actor to the buffer without allocations
+		/// </summary>
+		public void GetName(IBufferWriter<char> name) {
+			if (name == null)
+				throw new ArgumentNullException(nameof(name));
+
+			StringMarshal.Decode(Object.getName(Pointer), name);
+		}
+
+		/// <summary>
+		/// Resolves a property of the actor class for repeated access through <see cref="PropertyHandle"/> overloads
+		/// </summary>
+		/// <returns>The resolved property, or an invalid handle if the property is not found or its type is not supported</returns>
+		public PropertyHandle GetPropertyHandle(string name) {
+			if (name == null)
+				throw new ArgumentNullException(nameof(name));
+
+			PropertyHandle property = default(PropertyHandle);
+
+			if (!Object.getPropertyHandle(Pointer, name, ref property))
+				return default(PropertyHandle);
+
+			return property;
 		}
 
 		/// <summary>
@@ -3044,6 +5556,16 @@ namespace UnrealEngine.Framework {
 			return Object.getBool(Pointer, name, ref value);
 		}
 
+		/// <summary>
+		/// Retrieves the value of the bool property
+		/// </summary>
+		public bool GetBool(Name name, ref bool value) => Object.getBoolInterned(Pointer, name, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the bool property
+		/// </summary>
+		public bool GetBool(PropertyHandle property, ref bool value) => property.Get(Pointer, reference.Class, PropertyType.Bool, ref value);
+
 		/// <summary>
 		/// Retrieves the value of the byte property
 		/// </summary>
@@ -3055,6 +5577,18 @@ namespace UnrealEngine.Framework {
 			return Object.getByte(Pointer, name, ref value);
 		}
 
+		/// <summary>
+		/// Retrieves the value of the byte property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetByte(Name name, ref byte value) => Object.getByteInterned(Pointer, name, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the byte property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetByte(PropertyHandle property, ref byte value) => property.Get(Pointer, reference.Class, PropertyType.Byte, ref value);
+
 		/// <summary>
 		/// Retrieves the value of the short property
 		/// </summary>
@@ -3066,6 +5600,18 @@ namespace UnrealEngine.Framework {
 			return Object.getShort(Pointer, name, ref value);
 		}
 
+		/// <summary>
+		/// Retrieves the value of the short property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetShort(Name name, ref short value) => Object.getShortInterned(Pointer, name, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the short property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetShort(PropertyHandle property, ref short value) => property.Get(Pointer, reference.Class, PropertyType.Short, ref value);
+
 		/// <summary>
 		/// Retrieves the value of the integer property
 		/// </summary>
@@ -3077,6 +5623,18 @@ namespace UnrealEngine.Framework {
 			return Object.getInt(Pointer, name, ref value);
 		}
 
+		/// <summary>
+		/// Retrieves the value of the integer property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetInt(Name name, ref int value) => Object.getIntInterned(Pointer, name, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the integer property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetInt(PropertyHandle property, ref int value) => property.Get(Pointer, reference.Class, PropertyType.Int, ref value);
+
 		/// <summary>
 		/// Retrieves the value of the long property
 		/// </summary>
@@ -3088,6 +5646,18 @@ namespace UnrealEngine.Framework {
 			return Object.getLong(Pointer, name, ref value);
 		}
 
+		/// <summary>
+		/// Retrieves the value of the long property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetLong(Name name, ref long value) => Object.getLongInterned(Pointer, name, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the long property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetLong(PropertyHandle property, ref long value) => property.Get(Pointer, reference.Class, PropertyType.Long, ref value);
+
 		/// <summary>
 		/// Retrieves the value of the unsigned short property
 		/// </summary>
@@ -3132,6 +5702,18 @@ namespace UnrealEngine.Framework {
 			return Object.getFloat(Pointer, name, ref value);
 		}
 
+		/// <summary>
+		/// Retrieves the value of the float property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetFloat(Name name, ref float value) => Object.getFloatInterned(Pointer, name, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the float property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetFloat(PropertyHandle property, ref float value) => property.Get(Pointer, reference.Class, PropertyType.Float, ref value);
+
 		/// <summary>
 		/// Retrieves the value of the double property
 		/// </summary>
@@ -3143,6 +5725,18 @@ namespace UnrealEngine.Framework {
 			return Object.getDouble(Pointer, name, ref value);
 		}
 
+		/// <summary>
+		/// Retrieves the value of the double property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetDouble(Name name, ref double value) => Object.getDoubleInterned(Pointer, name, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the double property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetDouble(PropertyHandle property, ref double value) => property.Get(Pointer, reference.Class, PropertyType.Double, ref value);
+
 		/// <summary>
 		/// Retrieves the value of the text property
 		/// </summary>
@@ -3151,10 +5745,82 @@ namespace UnrealEngine.Framework {
 			if (name == null)
 				throw new ArgumentNullException(nameof(name));
 
-			stringBuffer.Clear();
+			IntPtr text = Object.getText(Pointer, name);
+
+			if (text != IntPtr.Zero) {
+				value = StringMarshal.Decode(text);
+
+				return true;
+			}
+
+			return false;
+		}
+
+		/// <summary>
+		/// Retrieves the value of the text property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetText(Name name, ref string value) {
+			IntPtr text = Object.getTextInterned(Pointer, name);
+
+			if (text != IntPtr.Zero) {
+				value = StringMarshal.Decode(text);
+
+				return true;
+			}
+
+			return false;
+		}
+
+		/// <summary>
+		/// Retrieves the value of the text property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetText(PropertyHandle property, ref string value) {
+			IntPtr pointer = Pointer;
+
+			if (!property.Matches(reference.Class, PropertyType.Text))
+				return false;
+
+			value = StringMarshal.Decode(Object.getTextByHandle(pointer, property.property));
+
+			return true;
+		}
+
+		/// <summary>
+		/// Writes the value of the text property to the buffer without allocations
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetText(string name, IBufferWriter<char> value) {
+			if (name == null)
+				throw new ArgumentNullException(nameof(name));
+
+			if (value == null)
+				throw new ArgumentNullException(nameof(value));
+
+			IntPtr text = Object.getText(Pointer, name);
+
+			if (text != IntPtr.Zero) {
+				StringMarshal.Decode(text, value);
+
+				return true;
+			}
+
+			return false;
+		}
+
+		/// <summary>
+		/// Writes the value of the text property to the buffer without allocations
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetText(Name name, IBufferWriter<char> value) {
+			if (value == null)
+				throw new ArgumentNullException(nameof(value));
+
+			IntPtr text = Object.getTextInterned(Pointer, name);
 
-			if (Object.getText(Pointer, name, stringBuffer)) {
-				value = stringBuffer.ToString();
+			if (text != IntPtr.Zero) {
+				StringMarshal.Decode(text, value);
 
 				return true;
 			}
@@ -3162,6 +5828,24 @@ namespace UnrealEngine.Framework {
 			return false;
 		}
 
+		/// <summary>
+		/// Writes the value of the text property to the buffer without allocations
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetText(PropertyHandle property, IBufferWriter<char> value) {
+			if (value == null)
+				throw new ArgumentNullException(nameof(value));
+
+			IntPtr pointer = Pointer;
+
+			if (!property.Matches(reference.Class, PropertyType.Text))
+				return false;
+
+			StringMarshal.Decode(Object.getTextByHandle(pointer, property.property), value);
+
+			return true;
+		}
+
 		/// <summary>
 		/// Sets the value of the bool property
 		/// </summary>
@@ -3172,6 +5856,16 @@ namespace UnrealEngine.Framework {
 			return Object.setBool(Pointer, name, value);
 		}
 
+		/// <summary>
+		/// Sets the value of the bool property
+		/// </summary>
+		public bool SetBool(Name name, bool value) => Object.setBoolInterned(Pointer, name, value);
+
+		/// <summary>
+		/// Sets the value of the bool property
+		/// </summary>
+		public bool SetBool(PropertyHandle property, bool value) => property.Set(Pointer, reference.Class, PropertyType.Bool, value);
+
 		/// <summary>
 		/// Sets the value of the byte property
 		/// </summary>
@@ -3183,6 +5877,18 @@ namespace UnrealEngine.Framework {
 			return Object.setByte(Pointer, name, value);
 		}
 
+		/// <summary>
+		/// Sets the value of the byte property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetByte(Name name, byte value) => Object.setByteInterned(Pointer, name, value);
+
+		/// <summary>
+		/// Sets the value of the byte property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetByte(PropertyHandle property, byte value) => property.Set(Pointer, reference.Class, PropertyType.Byte, value);
+
 		/// <summary>
 		/// Sets the value of the short property
 		/// </summary>
@@ -3194,6 +5900,18 @@ namespace UnrealEngine.Framework {
 			return Object.setShort(Pointer, name, value);
 		}
 
+		/// <summary>
+		/// Sets the value of the short property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetShort(Name name, short value) => Object.setShortInterned(Pointer, name, value);
+
+		/// <summary>
+		/// Sets the value of the short property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetShort(PropertyHandle property, short value) => property.Set(Pointer, reference.Class, PropertyType.Short, value);
+
 		/// <summary>
 		/// Sets the value of the integer property
 		/// </summary>
@@ -3205,6 +5923,18 @@ namespace UnrealEngine.Framework {
 			return Object.setInt(Pointer, name, value);
 		}
 
+		/// <summary>
+		/// Sets the value of the integer property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetInt(Name name, int value) => Object.setIntInterned(Pointer, name, value);
+
+		/// <summary>
+		/// Sets the value of the integer property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetInt(PropertyHandle property, int value) => property.Set(Pointer, reference.Class, PropertyType.Int, value);
+
 		/// <summary>
 		/// Sets the value of the long property
 		/// </summary>
@@ -3216,6 +5946,18 @@ namespace UnrealEngine.Framework {
 			return Object.setLong(Pointer, name, value);
 		}
 
+		/// <summary>
+		/// Sets the value of the long property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetLong(Name name, long value) => Object.setLongInterned(Pointer, name, value);
+
+		/// <summary>
+		/// Sets the value of the long property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetLong(PropertyHandle property, long value) => property.Set(Pointer, reference.Class, PropertyType.Long, value);
+
 		/// <summary>
 		/// Sets the value of the unsigned short property
 		/// </summary>
@@ -3235,54 +5977,107 @@ namespace UnrealEngine.Framework {
 			if (name == null)
 				throw new ArgumentNullException(nameof(name));
 
-			return Object.setUInt(Pointer, name, value);
+			return Object.setUInt(Pointer, name, value);
+		}
+
+		/// <summary>
+		/// Sets the value of the unsigned long property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetULong(string name, ulong value) {
+			if (name == null)
+				throw new ArgumentNullException(nameof(name));
+
+			return Object.setULong(Pointer, name, value);
+		}
+
+		/// <summary>
+		/// Sets the value of the float property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetFloat(string name, float value) {
+			if (name == null)
+				throw new ArgumentNullException(nameof(name));
+
+			return Object.setFloat(Pointer, name, value);
+		}
+
+		/// <summary>
+		/// Sets the value of the float property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetFloat(Name name, float value) => Object.setFloatInterned(Pointer, name, value);
+
+		/// <summary>
+		/// Sets the value of the float property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetFloat(PropertyHandle property, float value) => property.Set(Pointer, reference.Class, PropertyType.Float, value);
+
+		/// <summary>
+		/// Sets the value of the double property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetDouble(string name, double value) {
+			if (name == null)
+				throw new ArgumentNullException(nameof(name));
+
+			return Object.setDouble(Pointer, name, value);
 		}
 
 		/// <summary>
-		/// Sets the value of the unsigned long property
+		/// Sets the value of the double property
 		/// </summary>
 		/// <returns><c>true</c> on success</returns>
-		public bool SetULong(string name, ulong value) {
-			if (name == null)
-				throw new ArgumentNullException(nameof(name));
+		public bool SetDouble(Name name, double value) => Object.setDoubleInterned(Pointer, name, value);
 
-			return Object.setULong(Pointer, name, value);
-		}
+		/// <summary>
+		/// Sets the value of the double property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetDouble(PropertyHandle property, double value) => property.Set(Pointer, reference.Class, PropertyType.Double, value);
 
 		/// <summary>
-		/// Sets the value of the float property
+		/// Sets the value of the text property
 		/// </summary>
 		/// <returns><c>true</c> on success</returns>
-		public bool SetFloat(string name, float value) {
+		public bool SetText(string name, string value) {
 			if (name == null)
 				throw new ArgumentNullException(nameof(name));
 
-			return Object.setFloat(Pointer, name, value);
+			if (value == null)
+				throw new ArgumentNullException(nameof(value));
+
+			return Object.setText(Pointer, name, value);
 		}
 
 		/// <summary>
-		/// Sets the value of the double property
+		/// Sets the value of the text property
 		/// </summary>
 		/// <returns><c>true</c> on success</returns>
-		public bool SetDouble(string name, double value) {
-			if (name == null)
-				throw new ArgumentNullException(nameof(name));
+		public bool SetText(Name name, string value) {
+			if (value == null)
+				throw new ArgumentNullException(nameof(value));
 
-			return Object.setDouble(Pointer, name, value);
+			return Object.setTextInterned(Pointer, name, value);
 		}
 
 		/// <summary>
 		/// Sets the value of the text property
 		/// </summary>
 		/// <returns><c>true</c> on success</returns>
-		public bool SetText(string name, string value) {
-			if (name == null)
-				throw new ArgumentNullException(nameof(name));
-
+		public bool SetText(PropertyHandle property, string value) {
 			if (value == null)
 				throw new ArgumentNullException(nameof(value));
 
-			return Object.setText(Pointer, name, value);
+			IntPtr pointer = Pointer;
+
+			if (!property.Matches(reference.Class, PropertyType.Text))
+				return false;
+
+			Object.setTextByHandle(pointer, property.property, value);
+
+			return true;
 		}
 
 		/// <summary>
@@ -3389,6 +6184,46 @@ namespace UnrealEngine.Framework {
 			return null;
 		}
 
+		/// <summary>
+		/// Retrieves all components of the actor which match the specified type, components already present in the buffer are reused if they refer to the same engine objects
+		/// </summary>
+		/// <param name="components">The buffer to fill</param>
+		/// <returns>The total number of matching components, might be greater than the length of <paramref name="components"/></returns>
+		public unsafe int GetComponents<T>(Span<T> components) where T : ActorComponent {
+			int capacity = components.Length;
+			IntPtr[] pool = null;
+			Span<IntPtr> pointers = capacity <= componentsStackLimit ? stackalloc IntPtr[capacity] : (pool = ArrayPool<IntPtr>.Shared.Rent(capacity));
+
+			try {
+				int count = 0;
+
+				fixed (IntPtr* componentsPointer = pointers) {
+					count = getComponents(Pointer, ComponentTypeOf<T>.type, (IntPtr)componentsPointer, capacity);
+				}
+
+				for (int i = 0; i < count && i < capacity; i++) {
+					T component = components[i];
+
+					if (component == null || !component.IsCreated || component.Pointer != pointers[i]) {
+						component = FormatterServices.GetUninitializedObject(typeof(T)) as T;
+						component.Pointer = pointers[i];
+						components[i] = component;
+					}
+				}
+
+				return count;
+			}
+
+			finally {
+				if (pool != null)
+					ArrayPool<IntPtr>.Shared.Return(pool);
+			}
+		}
+
+		private static class ComponentTypeOf<T> where T : ActorComponent {
+			internal static readonly ComponentType type = (FormatterServices.GetUninitializedObject(typeof(T)) as T).Type;
+		}
+
 		/// <summary>
 		/// Returns the root component of the actor if matches the specified type
 		/// </summary>
@@ -3442,6 +6277,11 @@ namespace UnrealEngine.Framework {
 		/// Indicates whether the actor has a tag
 		/// </summary>
 		public bool HasTag(string tag) => hasTag(Pointer, tag);
+
+		/// <summary>
+		/// Indicates whether the actor has a tag
+		/// </summary>
+		public bool HasTag(Name tag) => hasTagInterned(Pointer, tag);
 	}
 
 	/// <summary>
@@ -3968,6 +6808,18 @@ namespace UnrealEngine.Framework {
 			return null;
 		}
 
+		/// <summary>
+		/// Finds and loads a sound wave by name asynchronously, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with a sound wave or <c>null</c> on failure</returns>
+		public static Task<SoundWave> LoadAsync(string name, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.SoundWave, name, pointer => new SoundWave(pointer), cancellationToken);
+
+		/// <summary>
+		/// Finds and loads sound waves by names asynchronously in a single request, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with sound waves in the order of names where failed ones are <c>null</c></returns>
+		public static Task<SoundWave[]> LoadAsync(string[] names, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.SoundWave, names, pointer => new SoundWave(pointer), cancellationToken);
+
 		/// <summary>
 		/// Gets or sets whether the sound wave will be looped if played directly
 		/// </summary>
@@ -4049,6 +6901,18 @@ namespace UnrealEngine.Framework {
 
 			return null;
 		}
+
+		/// <summary>
+		/// Finds and loads an animation sequence by name asynchronously, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with an animation sequence or <c>null</c> on failure</returns>
+		public static Task<AnimationSequence> LoadAsync(string name, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.AnimationSequence, name, pointer => new AnimationSequence(pointer), cancellationToken);
+
+		/// <summary>
+		/// Finds and loads animation sequences by names asynchronously in a single request, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with animation sequences in the order of names where failed ones are <c>null</c></returns>
+		public static Task<AnimationSequence[]> LoadAsync(string[] names, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.AnimationSequence, names, pointer => new AnimationSequence(pointer), cancellationToken);
 	}
 
 	/// <summary>
@@ -4081,6 +6945,18 @@ namespace UnrealEngine.Framework {
 
 			return null;
 		}
+
+		/// <summary>
+		/// Finds and loads an animation montage by name asynchronously, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with an animation montage or <c>null</c> on failure</returns>
+		public static Task<AnimationMontage> LoadAsync(string name, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.AnimationMontage, name, pointer => new AnimationMontage(pointer), cancellationToken);
+
+		/// <summary>
+		/// Finds and loads animation montages by names asynchronously in a single request, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with animation montages in the order of names where failed ones are <c>null</c></returns>
+		public static Task<AnimationMontage[]> LoadAsync(string[] names, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.AnimationMontage, names, pointer => new AnimationMontage(pointer), cancellationToken);
 	}
 
 	/// <summary>
@@ -4261,6 +7137,11 @@ namespace UnrealEngine.Framework {
 			return isKeyPressed(Pointer, key);
 		}
 
+		/// <summary>
+		/// Returns <c>true</c> if a key is pressed
+		/// </summary>
+		public bool IsKeyPressed(Name key) => isKeyPressedInterned(Pointer, key);
+
 		/// <summary>
 		/// Returns the time a key was pressed
 		/// </summary>
@@ -4271,6 +7152,11 @@ namespace UnrealEngine.Framework {
 			return getTimeKeyPressed(Pointer, key);
 		}
 
+		/// <summary>
+		/// Returns the time a key was pressed
+		/// </summary>
+		public float GetTimeKeyPressed(Name key) => getTimeKeyPressedInterned(Pointer, key);
+
 		/// <summary>
 		/// Retrieves mouse sensitivity
 		/// </summary>
@@ -4338,6 +7224,18 @@ namespace UnrealEngine.Framework {
 
 			return null;
 		}
+
+		/// <summary>
+		/// Finds and loads a blueprint by name asynchronously, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with a blueprint or <c>null</c> on failure</returns>
+		public static Task<Blueprint> LoadAsync(string name, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.Blueprint, name, pointer => new Blueprint(pointer), cancellationToken);
+
+		/// <summary>
+		/// Finds and loads blueprints by names asynchronously in a single request, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with blueprints in the order of names where failed ones are <c>null</c></returns>
+		public static Task<Blueprint[]> LoadAsync(string[] names, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.Blueprint, names, pointer => new Blueprint(pointer), cancellationToken);
 	}
 
 	/// <summary>
@@ -4428,6 +7326,18 @@ namespace UnrealEngine.Framework {
 
 			return null;
 		}
+
+		/// <summary>
+		/// Finds and loads a static mesh by name asynchronously, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with a static mesh or <c>null</c> on failure</returns>
+		public static Task<StaticMesh> LoadAsync(string name, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.StaticMesh, name, pointer => new StaticMesh(pointer), cancellationToken);
+
+		/// <summary>
+		/// Finds and loads static meshes by names asynchronously in a single request, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with static meshes in the order of names where failed ones are <c>null</c></returns>
+		public static Task<StaticMesh[]> LoadAsync(string[] names, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.StaticMesh, names, pointer => new StaticMesh(pointer), cancellationToken);
 	}
 
 	/// <summary>
@@ -4453,6 +7363,18 @@ namespace UnrealEngine.Framework {
 
 			return null;
 		}
+
+		/// <summary>
+		/// Finds and loads a skeletal mesh by name asynchronously, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with a skeletal mesh or <c>null</c> on failure</returns>
+		public static Task<SkeletalMesh> LoadAsync(string name, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.SkeletalMesh, name, pointer => new SkeletalMesh(pointer), cancellationToken);
+
+		/// <summary>
+		/// Finds and loads skeletal meshes by names asynchronously in a single request, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with skeletal meshes in the order of names where failed ones are <c>null</c></returns>
+		public static Task<SkeletalMesh[]> LoadAsync(string[] names, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.SkeletalMesh, names, pointer => new SkeletalMesh(pointer), cancellationToken);
 	}
 
 	/// <summary>
@@ -4486,6 +7408,18 @@ namespace UnrealEngine.Framework {
 			return null;
 		}
 
+		/// <summary>
+		/// Finds and loads a texture by name asynchronously, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with a texture or <c>null</c> on failure</returns>
+		public static Task<Texture2D> LoadAsync(string name, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.Texture2D, name, pointer => new Texture2D(pointer), cancellationToken);
+
+		/// <summary>
+		/// Finds and loads textures by names asynchronously in a single request, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with textures in the order of names where failed ones are <c>null</c></returns>
+		public static Task<Texture2D[]> LoadAsync(string[] names, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.Texture2D, names, pointer => new Texture2D(pointer), cancellationToken);
+
 		/// <summary>
 		/// Retrieves size of the texture
 		/// </summary>
@@ -4496,10 +7430,8 @@ namespace UnrealEngine.Framework {
 	/// The base class of components that define reusable behavior and can be added to different types of actors
 	/// </summary>
 	public partial class ActorComponent : IObject, IEquatable<ActorComponent> {
-		[ThreadStatic]
-		private static StringBuilder stringBuffer = new StringBuilder(8192);
-
 		private IntPtr pointer;
+		private ObjectReference reference;
 
 		internal IntPtr Pointer {
 			get {
@@ -4514,6 +7446,16 @@ namespace UnrealEngine.Framework {
 					throw new InvalidOperationException();
 
 				pointer = value;
+				reference = new ObjectReference(value);
+			}
+		}
+
+		internal ref readonly ObjectReference Reference {
+			get {
+				if (!IsCreated)
+					throw new InvalidOperationException();
+
+				return ref reference;
 			}
 		}
 
@@ -4526,19 +7468,43 @@ namespace UnrealEngine.Framework {
 		/// <summary>
 		/// Returns <c>true</c> if the object is created
 		/// </summary>
-		public bool IsCreated => pointer != IntPtr.Zero && !Object.isPendingKill(pointer);
+		public bool IsCreated => reference.IsAlive(pointer);
 
 		/// <summary>
 		/// Returns the name of the component
 		/// </summary>
-		public string Name {
-			get {
-				stringBuffer.Clear();
+		public string Name => StringMarshal.Decode(Object.getName(Pointer));
 
-				Object.getName(Pointer, stringBuffer);
+		/// <summary>
+		/// Copies the name of the component to the span without allocations
+		/// </summary>
+		/// <returns><c>true</c> on success or <c>false</c> if the span is too small</returns>
+		public bool TryGetName(Span<char> name, out int length) => StringMarshal.Decode(Object.getName(Pointer), name, out length);
 
-				return stringBuffer.ToString();
-			}
+		/// <summary>
+		/// Writes the name of the component to the buffer without allocations
+		/// </summary>
+		public void GetName(IBufferWriter<char> name) {
+			if (name == null)
+				throw new ArgumentNullException(nameof(name));
+
+			StringMarshal.Decode(Object.getName(Pointer), name);
+		}
+
+		/// <summary>
+		/// Resolves a property of the component class for repeated access through <see cref="PropertyHandle"/> overloads
+		/// </summary>
+		/// <returns>The resolved property, or an invalid handle if the property is not found or its type is not supported</returns>
+		public PropertyHandle GetPropertyHandle(string name) {
+			if (name == null)
+				throw new ArgumentNullException(nameof(name));
+
+			PropertyHandle property = default(PropertyHandle);
+
+			if (!Object.getPropertyHandle(Pointer, name, ref property))
+				return default(PropertyHandle);
+
+			return property;
 		}
 
 		/// <summary>
@@ -4551,6 +7517,16 @@ namespace UnrealEngine.Framework {
 			return Object.getBool(Pointer, name, ref value);
 		}
 
+		/// <summary>
+		/// Retrieves the value of the bool property
+		/// </summary>
+		public bool GetBool(Name name, ref bool value) => Object.getBoolInterned(Pointer, name, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the bool property
+		/// </summary>
+		public bool GetBool(PropertyHandle property, ref bool value) => property.Get(Pointer, reference.Class, PropertyType.Bool, ref value);
+
 		/// <summary>
 		/// Retrieves the value of the byte property
 		/// </summary>
@@ -4562,6 +7538,18 @@ namespace UnrealEngine.Framework {
 			return Object.getByte(Pointer, name, ref value);
 		}
 
+		/// <summary>
+		/// Retrieves the value of the byte property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetByte(Name name, ref byte value) => Object.getByteInterned(Pointer, name, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the byte property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetByte(PropertyHandle property, ref byte value) => property.Get(Pointer, reference.Class, PropertyType.Byte, ref value);
+
 		/// <summary>
 		/// Retrieves the value of the short property
 		/// </summary>
@@ -4573,6 +7561,18 @@ namespace UnrealEngine.Framework {
 			return Object.getShort(Pointer, name, ref value);
 		}
 
+		/// <summary>
+		/// Retrieves the value of the short property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetShort(Name name, ref short value) => Object.getShortInterned(Pointer, name, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the short property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetShort(PropertyHandle property, ref short value) => property.Get(Pointer, reference.Class, PropertyType.Short, ref value);
+
 		/// <summary>
 		/// Retrieves the value of the integer property
 		/// </summary>
@@ -4584,6 +7584,18 @@ namespace UnrealEngine.Framework {
 			return Object.getInt(Pointer, name, ref value);
 		}
 
+		/// <summary>
+		/// Retrieves the value of the integer property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetInt(Name name, ref int value) => Object.getIntInterned(Pointer, name, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the integer property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetInt(PropertyHandle property, ref int value) => property.Get(Pointer, reference.Class, PropertyType.Int, ref value);
+
 		/// <summary>
 		/// Retrieves the value of the long property
 		/// </summary>
@@ -4595,6 +7607,18 @@ namespace UnrealEngine.Framework {
 			return Object.getLong(Pointer, name, ref value);
 		}
 
+		/// <summary>
+		/// Retrieves the value of the long property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetLong(Name name, ref long value) => Object.getLongInterned(Pointer, name, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the long property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetLong(PropertyHandle property, ref long value) => property.Get(Pointer, reference.Class, PropertyType.Long, ref value);
+
 		/// <summary>
 		/// Retrieves the value of the unsigned short property
 		/// </summary>
@@ -4636,32 +7660,128 @@ namespace UnrealEngine.Framework {
 			if (name == null)
 				throw new ArgumentNullException(nameof(name));
 
-			return Object.getFloat(Pointer, name, ref value);
+			return Object.getFloat(Pointer, name, ref value);
+		}
+
+		/// <summary>
+		/// Retrieves the value of the float property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetFloat(Name name, ref float value) => Object.getFloatInterned(Pointer, name, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the float property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetFloat(PropertyHandle property, ref float value) => property.Get(Pointer, reference.Class, PropertyType.Float, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the double property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetDouble(string name, ref double value) {
+			if (name == null)
+				throw new ArgumentNullException(nameof(name));
+
+			return Object.getDouble(Pointer, name, ref value);
+		}
+
+		/// <summary>
+		/// Retrieves the value of the double property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetDouble(Name name, ref double value) => Object.getDoubleInterned(Pointer, name, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the double property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetDouble(PropertyHandle property, ref double value) => property.Get(Pointer, reference.Class, PropertyType.Double, ref value);
+
+		/// <summary>
+		/// Retrieves the value of the text property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetText(string name, ref string value) {
+			if (name == null)
+				throw new ArgumentNullException(nameof(name));
+
+			IntPtr text = Object.getText(Pointer, name);
+
+			if (text != IntPtr.Zero) {
+				value = StringMarshal.Decode(text);
+
+				return true;
+			}
+
+			return false;
+		}
+
+		/// <summary>
+		/// Retrieves the value of the text property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetText(Name name, ref string value) {
+			IntPtr text = Object.getTextInterned(Pointer, name);
+
+			if (text != IntPtr.Zero) {
+				value = StringMarshal.Decode(text);
+
+				return true;
+			}
+
+			return false;
+		}
+
+		/// <summary>
+		/// Retrieves the value of the text property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetText(PropertyHandle property, ref string value) {
+			IntPtr pointer = Pointer;
+
+			if (!property.Matches(reference.Class, PropertyType.Text))
+				return false;
+
+			value = StringMarshal.Decode(Object.getTextByHandle(pointer, property.property));
+
+			return true;
 		}
 
 		/// <summary>
-		/// Retrieves the value of the double property
+		/// Writes the value of the text property to the buffer without allocations
 		/// </summary>
 		/// <returns><c>true</c> on success</returns>
-		public bool GetDouble(string name, ref double value) {
+		public bool GetText(string name, IBufferWriter<char> value) {
 			if (name == null)
 				throw new ArgumentNullException(nameof(name));
 
-			return Object.getDouble(Pointer, name, ref value);
+			if (value == null)
+				throw new ArgumentNullException(nameof(value));
+
+			IntPtr text = Object.getText(Pointer, name);
+
+			if (text != IntPtr.Zero) {
+				StringMarshal.Decode(text, value);
+
+				return true;
+			}
+
+			return false;
 		}
 
 		/// <summary>
-		/// Retrieves the value of the text property
+		/// Writes the value of the text property to the buffer without allocations
 		/// </summary>
 		/// <returns><c>true</c> on success</returns>
-		public bool GetText(string name, ref string value) {
-			if (name == null)
-				throw new ArgumentNullException(nameof(name));
+		public bool GetText(Name name, IBufferWriter<char> value) {
+			if (value == null)
+				throw new ArgumentNullException(nameof(value));
 
-			stringBuffer.Clear();
+			IntPtr text = Object.getTextInterned(Pointer, name);
 
-			if (Object.getText(Pointer, name, stringBuffer)) {
-				value = stringBuffer.ToString();
+			if (text != IntPtr.Zero) {
+				StringMarshal.Decode(text, value);
 
 				return true;
 			}
@@ -4669,6 +7789,24 @@ namespace UnrealEngine.Framework {
 			return false;
 		}
 
+		/// <summary>
+		/// Writes the value of the text property to the buffer without allocations
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool GetText(PropertyHandle property, IBufferWriter<char> value) {
+			if (value == null)
+				throw new ArgumentNullException(nameof(value));
+
+			IntPtr pointer = Pointer;
+
+			if (!property.Matches(reference.Class, PropertyType.Text))
+				return false;
+
+			StringMarshal.Decode(Object.getTextByHandle(pointer, property.property), value);
+
+			return true;
+		}
+
 		/// <summary>
 		/// Sets the value of the bool property
 		/// </summary>
@@ -4679,6 +7817,16 @@ namespace UnrealEngine.Framework {
 			return Object.setBool(Pointer, name, value);
 		}
 
+		/// <summary>
+		/// Sets the value of the bool property
+		/// </summary>
+		public bool SetBool(Name name, bool value) => Object.setBoolInterned(Pointer, name, value);
+
+		/// <summary>
+		/// Sets the value of the bool property
+		/// </summary>
+		public bool SetBool(PropertyHandle property, bool value) => property.Set(Pointer, reference.Class, PropertyType.Bool, value);
+
 		/// <summary>
 		/// Sets the value of the byte property
 		/// </summary>
@@ -4690,6 +7838,18 @@ namespace UnrealEngine.Framework {
 			return Object.setByte(Pointer, name, value);
 		}
 
+		/// <summary>
+		/// Sets the value of the byte property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetByte(Name name, byte value) => Object.setByteInterned(Pointer, name, value);
+
+		/// <summary>
+		/// Sets the value of the byte property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetByte(PropertyHandle property, byte value) => property.Set(Pointer, reference.Class, PropertyType.Byte, value);
+
 		/// <summary>
 		/// Sets the value of the short property
 		/// </summary>
@@ -4701,6 +7861,18 @@ namespace UnrealEngine.Framework {
 			return Object.setShort(Pointer, name, value);
 		}
 
+		/// <summary>
+		/// Sets the value of the short property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetShort(Name name, short value) => Object.setShortInterned(Pointer, name, value);
+
+		/// <summary>
+		/// Sets the value of the short property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetShort(PropertyHandle property, short value) => property.Set(Pointer, reference.Class, PropertyType.Short, value);
+
 		/// <summary>
 		/// Sets the value of the integer property
 		/// </summary>
@@ -4712,6 +7884,18 @@ namespace UnrealEngine.Framework {
 			return Object.setInt(Pointer, name, value);
 		}
 
+		/// <summary>
+		/// Sets the value of the integer property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetInt(Name name, int value) => Object.setIntInterned(Pointer, name, value);
+
+		/// <summary>
+		/// Sets the value of the integer property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetInt(PropertyHandle property, int value) => property.Set(Pointer, reference.Class, PropertyType.Int, value);
+
 		/// <summary>
 		/// Sets the value of the long property
 		/// </summary>
@@ -4723,6 +7907,18 @@ namespace UnrealEngine.Framework {
 			return Object.setLong(Pointer, name, value);
 		}
 
+		/// <summary>
+		/// Sets the value of the long property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetLong(Name name, long value) => Object.setLongInterned(Pointer, name, value);
+
+		/// <summary>
+		/// Sets the value of the long property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetLong(PropertyHandle property, long value) => property.Set(Pointer, reference.Class, PropertyType.Long, value);
+
 		/// <summary>
 		/// Sets the value of the unsigned short property
 		/// </summary>
@@ -4767,6 +7963,18 @@ namespace UnrealEngine.Framework {
 			return Object.setFloat(Pointer, name, value);
 		}
 
+		/// <summary>
+		/// Sets the value of the float property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetFloat(Name name, float value) => Object.setFloatInterned(Pointer, name, value);
+
+		/// <summary>
+		/// Sets the value of the float property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetFloat(PropertyHandle property, float value) => property.Set(Pointer, reference.Class, PropertyType.Float, value);
+
 		/// <summary>
 		/// Sets the value of the double property
 		/// </summary>
@@ -4778,6 +7986,18 @@ namespace UnrealEngine.Framework {
 			return Object.setDouble(Pointer, name, value);
 		}
 
+		/// <summary>
+		/// Sets the value of the double property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetDouble(Name name, double value) => Object.setDoubleInterned(Pointer, name, value);
+
+		/// <summary>
+		/// Sets the value of the double property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetDouble(PropertyHandle property, double value) => property.Set(Pointer, reference.Class, PropertyType.Double, value);
+
 		/// <summary>
 		/// Sets the value of the text property
 		/// </summary>
@@ -4792,6 +8012,35 @@ namespace UnrealEngine.Framework {
 			return Object.setText(Pointer, name, value);
 		}
 
+		/// <summary>
+		/// Sets the value of the text property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetText(Name name, string value) {
+			if (value == null)
+				throw new ArgumentNullException(nameof(value));
+
+			return Object.setTextInterned(Pointer, name, value);
+		}
+
+		/// <summary>
+		/// Sets the value of the text property
+		/// </summary>
+		/// <returns><c>true</c> on success</returns>
+		public bool SetText(PropertyHandle property, string value) {
+			if (value == null)
+				throw new ArgumentNullException(nameof(value));
+
+			IntPtr pointer = Pointer;
+
+			if (!property.Matches(reference.Class, PropertyType.Text))
+				return false;
+
+			Object.setTextByHandle(pointer, property.property, value);
+
+			return true;
+		}
+
 		/// <summary>
 		/// Indicates equality of objects
 		/// </summary>
@@ -4849,6 +8098,11 @@ namespace UnrealEngine.Framework {
 		/// Indicates whether the component has a tag
 		/// </summary>
 		public bool HasTag(string tag) => hasTag(Pointer, tag);
+
+		/// <summary>
+		/// Indicates whether the component has a tag
+		/// </summary>
+		public bool HasTag(Name tag) => hasTagInterned(Pointer, tag);
 	}
 
 	/// <summary>
@@ -4943,6 +8197,8 @@ namespace UnrealEngine.Framework {
 	/// The base class of components that can be transformed or attached, but has no rendering or collision capabilities
 	/// </summary>
 	public partial class SceneComponent : ActorComponent {
+		private const int bulkStackLimit = 256;
+
 		internal override ComponentType Type => ComponentType.Scene;
 
 		private protected SceneComponent() { }
@@ -5067,6 +8323,102 @@ namespace UnrealEngine.Framework {
 		/// </summary>
 		public void GetTransform(ref Transform value) => SceneComponent.getComponentTransform(Pointer, ref value);
 
+		/// <summary>
+		/// Retrieves locations of the components in world space, with a single call to the engine
+		/// </summary>
+		/// <param name="sceneComponents">The components to read from</param>
+		/// <param name="values">The buffer to fill, should be at least as long as <paramref name="sceneComponents"/></param>
+		public static unsafe void GetLocations(ReadOnlySpan<SceneComponent> sceneComponents, Span<Vector3> values) {
+			if (values.Length < sceneComponents.Length)
+				throw new ArgumentOutOfRangeException(nameof(values));
+
+			int count = sceneComponents.Length;
+			IntPtr[] pool = null;
+			Span<IntPtr> pointers = count <= bulkStackLimit ? stackalloc IntPtr[count] : (pool = ArrayPool<IntPtr>.Shared.Rent(count));
+
+			try {
+				GetPointers(sceneComponents, pointers);
+
+				fixed (IntPtr* sceneComponentsPointer = pointers) {
+					fixed (Vector3* valuesPointer = values) {
+						getComponentsLocations((IntPtr)sceneComponentsPointer, count, (IntPtr)valuesPointer);
+					}
+				}
+			}
+
+			finally {
+				if (pool != null)
+					ArrayPool<IntPtr>.Shared.Return(pool);
+			}
+		}
+
+		/// <summary>
+		/// Retrieves rotations of the components in world space, with a single call to the engine
+		/// </summary>
+		/// <param name="sceneComponents">The components to read from</param>
+		/// <param name="values">The buffer to fill, should be at least as long as <paramref name="sceneComponents"/></param>
+		public static unsafe void GetRotations(ReadOnlySpan<SceneComponent> sceneComponents, Span<Quaternion> values) {
+			if (values.Length < sceneComponents.Length)
+				throw new ArgumentOutOfRangeException(nameof(values));
+
+			int count = sceneComponents.Length;
+			IntPtr[] pool = null;
+			Span<IntPtr> pointers = count <= bulkStackLimit ? stackalloc IntPtr[count] : (pool = ArrayPool<IntPtr>.Shared.Rent(count));
+
+			try {
+				GetPointers(sceneComponents, pointers);
+
+				fixed (IntPtr* sceneComponentsPointer = pointers) {
+					fixed (Quaternion* valuesPointer = values) {
+						getComponentsRotations((IntPtr)sceneComponentsPointer, count, (IntPtr)valuesPointer);
+					}
+				}
+			}
+
+			finally {
+				if (pool != null)
+					ArrayPool<IntPtr>.Shared.Return(pool);
+			}
+		}
+
+		/// <summary>
+		/// Retrieves the transforms which assigned to the components, with a single call to the engine
+		/// </summary>
+		/// <param name="sceneComponents">The components to read from</param>
+		/// <param name="values">The buffer to fill, should be at least as long as <paramref name="sceneComponents"/></param>
+		public static unsafe void GetTransforms(ReadOnlySpan<SceneComponent> sceneComponents, Span<Transform> values) {
+			if (values.Length < sceneComponents.Length)
+				throw new ArgumentOutOfRangeException(nameof(values));
+
+			int count = sceneComponents.Length;
+			IntPtr[] pool = null;
+			Span<IntPtr> pointers = count <= bulkStackLimit ? stackalloc IntPtr[count] : (pool = ArrayPool<IntPtr>.Shared.Rent(count));
+
+			try {
+				GetPointers(sceneComponents, pointers);
+
+				fixed (IntPtr* sceneComponentsPointer = pointers) {
+					fixed (Transform* valuesPointer = values) {
+						getComponentsTransforms((IntPtr)sceneComponentsPointer, count, (IntPtr)valuesPointer);
+					}
+				}
+			}
+
+			finally {
+				if (pool != null)
+					ArrayPool<IntPtr>.Shared.Return(pool);
+			}
+		}
+
+		private static void GetPointers(ReadOnlySpan<SceneComponent> sceneComponents, Span<IntPtr> pointers) {
+			for (int i = 0; i < sceneComponents.Length; i++) {
+				if (sceneComponents[i] == null)
+					throw new ArgumentNullException(nameof(sceneComponents));
+
+				pointers[i] = sceneComponents[i].Pointer;
+			}
+		}
+
 		/// <summary>
 		/// Gets the forward (X) unit direction vector from the component in world space
 		/// </summary>
@@ -5332,6 +8684,14 @@ namespace UnrealEngine.Framework {
 		/// <param name="velocityChange">If <c>true</c>, <paramref name="impulse"/> is taken as a change in velocity instead of a physical force (the mass will have no effect)</param>
 		public void AddAngularImpulseInDegrees(in Vector3 impulse, string boneName = null, bool velocityChange = false) => addAngularImpulseInDegrees(Pointer, impulse, boneName, velocityChange);
 
+		/// <summary>
+		/// Adds an angular impulse in degrees to a rigid body
+		/// </summary>
+		/// <param name="impulse">Magnitude and direction of the impulse to apply, the direction is the axis of rotation</param>
+		/// <param name="boneName">If applied to <see cref="SkeletalMeshComponent"/>, the name of the body to apply an angular impulse to, or <see cref="Name.None"/> to indicate the root body</param>
+		/// <param name="velocityChange">If <c>true</c>, <paramref name="impulse"/> is taken as a change in velocity instead of a physical force (the mass will have no effect)</param>
+		public void AddAngularImpulseInDegrees(in Vector3 impulse, Name boneName, bool velocityChange = false) => addAngularImpulseInDegreesInterned(Pointer, impulse, boneName, velocityChange);
+
 		/// <summary>
 		/// Adds an angular impulse in radians to a rigid body
 		/// </summary>
@@ -5340,6 +8700,14 @@ namespace UnrealEngine.Framework {
 		/// <param name="velocityChange">If <c>true</c>, <paramref name="impulse"/> is taken as a change in velocity instead of a physical force (the mass will have no effect)</param>
 		public void AddAngularImpulseInRadians(in Vector3 impulse, string boneName = null, bool velocityChange = false) => addAngularImpulseInRadians(Pointer, impulse, boneName, velocityChange);
 
+		/// <summary>
+		/// Adds an angular impulse in radians to a rigid body
+		/// </summary>
+		/// <param name="impulse">Magnitude and direction of the impulse to apply, the direction is the axis of rotation</param>
+		/// <param name="boneName">If applied to <see cref="SkeletalMeshComponent"/>, the name of the body to apply an angular impulse to, or <see cref="Name.None"/> to indicate the root body</param>
+		/// <param name="velocityChange">If <c>true</c>, <paramref name="impulse"/> is taken as a change in velocity instead of a physical force (the mass will have no effect)</param>
+		public void AddAngularImpulseInRadians(in Vector3 impulse, Name boneName, bool velocityChange = false) => addAngularImpulseInRadiansInterned(Pointer, impulse, boneName, velocityChange);
+
 		/// <summary>
 		/// Adds a force to a rigid body
 		/// </summary>
@@ -5348,6 +8716,14 @@ namespace UnrealEngine.Framework {
 		/// <param name="accelerationChange">If <c>true</c>, <paramref name="force"/> is taken as a change in acceleration instead of a physical force (the mass will have no effect)</param>
 		public void AddForce(in Vector3 force, string boneName = null, bool accelerationChange = false) => addForce(Pointer, force, boneName, accelerationChange);
 
+		/// <summary>
+		/// Adds a force to a rigid body
+		/// </summary>
+		/// <param name="force">Force vector to apply, magnitude indicates strength of force</param>
+		/// <param name="boneName">If applied to <see cref="SkeletalMeshComponent"/>, the name of the body to apply an angular impulse to, or <see cref="Name.None"/> to indicate the root body</param>
+		/// <param name="accelerationChange">If <c>true</c>, <paramref name="force"/> is taken as a change in acceleration instead of a physical force (the mass will have no effect)</param>
+		public void AddForce(in Vector3 force, Name boneName, bool accelerationChange = false) => addForceInterned(Pointer, force, boneName, accelerationChange);
+
 		/// <summary>
 		/// Adds a force to a rigid body at a specific location, optionally in local space
 		/// </summary>
@@ -5357,6 +8733,15 @@ namespace UnrealEngine.Framework {
 		/// <param name="localSpace">If <c>true</c>, applies force in local space instead of world space</param>
 		public void AddForceAtLocation(in Vector3 force, in Vector3 location, string boneName = null, bool localSpace = false) => addForceAtLocation(Pointer, force, location, boneName, localSpace);
 
+		/// <summary>
+		/// Adds a force to a rigid body at a specific location, optionally in local space
+		/// </summary>
+		/// <param name="force">Force vector to apply, magnitude indicates strength of force</param>
+		/// <param name="location">A point in world or local space to apply the force at</param>
+		/// <param name="boneName">If applied to <see cref="SkeletalMeshComponent"/>, the name of the body to apply an angular impulse to, or <see cref="Name.None"/> to indicate the root body</param>
+		/// <param name="localSpace">If <c>true</c>, applies force in local space instead of world space</param>
+		public void AddForceAtLocation(in Vector3 force, in Vector3 location, Name boneName, bool localSpace = false) => addForceAtLocationInterned(Pointer, force, location, boneName, localSpace);
+
 		/// <summary>
 		/// Adds an impulse to a rigid body
 		/// </summary>
@@ -5365,6 +8750,14 @@ namespace UnrealEngine.Framework {
 		/// <param name="velocityChange">If <c>true</c>, <paramref name="impulse"/> is taken as a change in velocity instead of a physical force (the mass will have no effect)</param>
 		public void AddImpulse(in Vector3 impulse, string boneName = null, bool velocityChange = false) => addImpulse(Pointer, impulse, boneName, velocityChange);
 
+		/// <summary>
+		/// Adds an impulse to a rigid body
+		/// </summary>
+		/// <param name="impulse">Magnitude and direction of the impulse to apply</param>
+		/// <param name="boneName">If applied to <see cref="SkeletalMeshComponent"/>, the name of the body to apply an angular impulse to, or <see cref="Name.None"/> to indicate the root body</param>
+		/// <param name="velocityChange">If <c>true</c>, <paramref name="impulse"/> is taken as a change in velocity instead of a physical force (the mass will have no effect)</param>
+		public void AddImpulse(in Vector3 impulse, Name boneName, bool velocityChange = false) => addImpulseInterned(Pointer, impulse, boneName, velocityChange);
+
 		/// <summary>
 		/// Adds an impulse to a rigid body at a specific location
 		/// </summary>
@@ -5373,6 +8766,14 @@ namespace UnrealEngine.Framework {
 		/// <param name="boneName">If applied to <see cref="SkeletalMeshComponent"/>, the name of the body to apply an angular impulse to, or <c>null</c> to indicate the root body</param>
 		public void AddImpulseAtLocation(in Vector3 impulse, in Vector3 location, string boneName = null) => addImpulseAtLocation(Pointer, impulse, location, boneName);
 
+		/// <summary>
+		/// Adds an impulse to a rigid body at a specific location
+		/// </summary>
+		/// <param name="impulse">Magnitude and direction of the impulse to apply</param>
+		/// <param name="location">A point in world space to apply the impulse at</param>
+		/// <param name="boneName">If applied to <see cref="SkeletalMeshComponent"/>, the name of the body to apply an angular impulse to, or <see cref="Name.None"/> to indicate the root body</param>
+		public void AddImpulseAtLocation(in Vector3 impulse, in Vector3 location, Name boneName) => addImpulseAtLocationInterned(Pointer, impulse, location, boneName);
+
 		/// <summary>
 		/// Adds a force to all rigid bodies in the component, originating from the supplied world-space location
 		/// </summary>
@@ -5401,6 +8802,14 @@ namespace UnrealEngine.Framework {
 		/// <param name="accelerationChange">If <c>true</c>, <paramref name="torque"/> is taken as a change in acceleration instead of a physical force (the mass will have no effect)</param>
 		public void AddTorqueInDegrees(in Vector3 torque, string boneName = null, bool accelerationChange = false) => addTorqueInDegrees(Pointer, torque, boneName, accelerationChange);
 
+		/// <summary>
+		/// Adds a torque in degrees to a rigid body
+		/// </summary>
+		/// <param name="torque">Torque to apply, direction is axis of rotation and magnitude is strength of the torque</param>
+		/// <param name="boneName">If applied to <see cref="SkeletalMeshComponent"/>, the name of the body to apply an angular impulse to, or <see cref="Name.None"/> to indicate the root body</param>
+		/// <param name="accelerationChange">If <c>true</c>, <paramref name="torque"/> is taken as a change in acceleration instead of a physical force (the mass will have no effect)</param>
+		public void AddTorqueInDegrees(in Vector3 torque, Name boneName, bool accelerationChange = false) => addTorqueInDegreesInterned(Pointer, torque, boneName, accelerationChange);
+
 		/// <summary>
 		/// Adds a torque in radians to a rigid body
 		/// </summary>
@@ -5409,6 +8818,14 @@ namespace UnrealEngine.Framework {
 		/// <param name="accelerationChange">If <c>true</c>, <paramref name="torque"/> is taken as a change in acceleration instead of a physical force (the mass will have no effect)</param>
 		public void AddTorqueInRadians(in Vector3 torque, string boneName = null, bool accelerationChange = false) => addTorqueInRadians(Pointer, torque, boneName, accelerationChange);
 
+		/// <summary>
+		/// Adds a torque in radians to a rigid body
+		/// </summary>
+		/// <param name="torque">Torque to apply, direction is axis of rotation and magnitude is strength of the torque</param>
+		/// <param name="boneName">If applied to <see cref="SkeletalMeshComponent"/>, the name of the body to apply an angular impulse to, or <see cref="Name.None"/> to indicate the root body</param>
+		/// <param name="accelerationChange">If <c>true</c>, <paramref name="torque"/> is taken as a change in acceleration instead of a physical force (the mass will have no effect)</param>
+		public void AddTorqueInRadians(in Vector3 torque, Name boneName, bool accelerationChange = false) => addTorqueInRadiansInterned(Pointer, torque, boneName, accelerationChange);
+
 		/// <summary>
 		/// Returns the material at the specified element index
 		/// </summary>
@@ -5448,6 +8865,11 @@ namespace UnrealEngine.Framework {
 		/// </summary>
 		public void SetMass(float mass, string boneName = null) => setMass(Pointer, mass, boneName);
 
+		/// <summary>
+		/// Sets the mass in kilograms of a rigid body
+		/// </summary>
+		public void SetMass(float mass, Name boneName) => setMassInterned(Pointer, mass, boneName);
+
 		/// <summary>
 		/// Sets whether or not a single body should use physics simulation, or should be kinematic, if the component is currently attached to something, beginning simulation will detach it
 		/// </summary>
@@ -5859,6 +9281,16 @@ namespace UnrealEngine.Framework {
 		/// </summary>
 		public int AddInstance(in Transform instanceTransform) => addInstance(Pointer, instanceTransform);
 
+		/// <summary>
+		/// Adds instances to the component using the transforms that will be applied at instantiation
+		/// </summary>
+		/// <returns>The index of the first added instance, the rest follow it contiguously</returns>
+		public unsafe int AddInstances(ReadOnlySpan<Transform> instanceTransforms) {
+			fixed (Transform* instanceTransformsPointer = instanceTransforms) {
+				return addInstances(Pointer, (IntPtr)instanceTransformsPointer, instanceTransforms.Length);
+			}
+		}
+
 		/// <summary>
 		/// Updates the transform for the specified instance
 		/// </summary>
@@ -5870,6 +9302,30 @@ namespace UnrealEngine.Framework {
 		/// <returns><c>true</c> if successful</returns>
 		public bool UpdateInstanceTransform(int instanceIndex, in Transform instanceTransform, bool worldSpace = false, bool markRenderStateDirty = false, bool teleport = false) => updateInstanceTransform(Pointer, instanceIndex, instanceTransform, worldSpace, markRenderStateDirty, teleport);
 
+		/// <summary>
+		/// Updates the transforms for a contiguous range of instances and marks the render state as dirty once
+		/// </summary>
+		/// <param name="startIndex">The index of the first instance to update</param>
+		/// <param name="instanceTransforms">The new transforms to apply</param>
+		/// <param name="worldSpace">If <c>true</c>, the new transforms are interpreted as world space transforms, otherwise they are interpreted as local space</param>
+		/// <param name="teleport">Whether or not the instances' physics should be moved normally, or teleported (moved instantly, ignoring velocity)</param>
+		/// <returns><c>true</c> if all instances are updated successfully</returns>
+		public unsafe bool UpdateInstanceTransforms(int startIndex, ReadOnlySpan<Transform> instanceTransforms, bool worldSpace = false, bool teleport = false) {
+			fixed (Transform* instanceTransformsPointer = instanceTransforms) {
+				return updateInstanceTransforms(Pointer, startIndex, (IntPtr)instanceTransformsPointer, instanceTransforms.Length, worldSpace, teleport);
+			}
+		}
+
+		/// <summary>
+		/// Removes the specified instances, repeated indices are removed once and the indices of the remaining instances might change
+		/// </summary>
+		/// <returns><c>true</c> if all instances are removed successfully</returns>
+		public unsafe bool RemoveInstances(ReadOnlySpan<int> instanceIndices) {
+			fixed (int* instanceIndicesPointer = instanceIndices) {
+				return removeInstances(Pointer, (IntPtr)instanceIndicesPointer, instanceIndices.Length);
+			}
+		}
+
 		/// <summary>
 		/// Clears all instances being rendered by the component
 		/// </summary>
@@ -6047,6 +9503,18 @@ namespace UnrealEngine.Framework {
 			return null;
 		}
 
+		/// <summary>
+		/// Finds and loads a material by name asynchronously, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with a material or <c>null</c> on failure</returns>
+		public static Task<Material> LoadAsync(string name, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.Material, name, pointer => new Material(pointer), cancellationToken);
+
+		/// <summary>
+		/// Finds and loads materials by names asynchronously in a single request, the task is completed on the game thread
+		/// </summary>
+		/// <returns>A task with materials in the order of names where failed ones are <c>null</c></returns>
+		public static Task<Material[]> LoadAsync(string[] names, CancellationToken cancellationToken = default) => AssetLoader.Load(ObjectType.Material, names, pointer => new Material(pointer), cancellationToken);
+
 		/// <summary>
 		/// Returns <c>true</c> if the material is one of the default materials
 		/// </summary>
@@ -6096,6 +9564,16 @@ namespace UnrealEngine.Framework {
 			setTextureParameterValue(Pointer, parameterName, value.Pointer);
 		}
 
+		/// <summary>
+		/// Sets the texture parameter value
+		/// </summary>
+		public void SetTextureParameterValue(Name parameterName, Texture value) {
+			if (value == null)
+				throw new ArgumentNullException(nameof(value));
+
+			setTextureParameterValueInterned(Pointer, parameterName, value.Pointer);
+		}
+
 		/// <summary>
 		/// Sets the vector parameter value
 		/// </summary>
@@ -6106,6 +9584,11 @@ namespace UnrealEngine.Framework {
 			setVectorParameterValue(Pointer, parameterName, value);
 		}
 
+		/// <summary>
+		/// Sets the vector parameter value
+		/// </summary>
+		public void SetVectorParameterValue(Name parameterName, in LinearColor value) => setVectorParameterValueInterned(Pointer, parameterName, value);
+
 		/// <summary>
 		/// Sets the scalar parameter value
 		/// </summary>
@@ -6115,5 +9598,10 @@ namespace UnrealEngine.Framework {
 
 			setScalarParameterValue(Pointer, parameterName, value);
 		}
+
+		/// <summary>
+		/// Sets the scalar parameter value
+		/// </summary>
+		public void SetScalarParameterValue(Name parameterName, float value) => setScalarParameterValueInterned(Pointer, parameterName, value);
 	}
 }
@@ -0,0 +1,10 @@
+using System;
+using UnrealEngine.Framework;
+
+namespace UnrealEngine.Harness {
+	public static class Probe {
+		public static void Empty() { }
+
+		public static void Interop() => _ = Engine.FrameNumber;
+	}
+}
\ No newline at end of file
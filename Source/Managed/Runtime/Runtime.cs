@@ -14,11 +14,14 @@
 
 using System;
 using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
 using System.Reflection;
 using System.Reflection.Emit;
 using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 using System.Runtime.Loader;
+using System.Text;
 using System.Threading;
 using UnrealEngine.Plugins;
 
@@ -61,103 +64,237 @@ namespace UnrealEngine.Runtime {
 
 		[MethodImpl(MethodImplOptions.NoInlining)]
 		internal static IntPtr LoadAssemblyFunction(IntPtr assemblyPathPointer, IntPtr typeNamePointer, IntPtr methodNamePointer, bool optional) {
-			Type type = null;
-			MethodInfo method = null;
-			PluginLoader pluginLoader = null;
 			string assemblyPath = Marshal.PtrToStringAuto(assemblyPathPointer);
 			string typeName = Marshal.PtrToStringAuto(typeNamePointer);
 			string methodName = Marshal.PtrToStringAuto(methodNamePointer);
 
-			try {
-				int assemblyHash = assemblyPath.GetHashCode();
+			return ResolveAssemblyFunction(assemblyPath, typeName, methodName, optional);
+		}
 
-				if (!pluginLoaders.TryGetValue(assemblyHash, out pluginLoader)) {
-					pluginLoader = PluginLoader.CreateFromAssemblyFile(assemblyPath, config => { config.DefaultContext = assembliesContextManager.assembliesContext; config.IsUnloadable = true; });
-					pluginLoaders.Add(assemblyHash, pluginLoader);
-				}
+		[MethodImpl(MethodImplOptions.NoInlining)]
+		internal static unsafe void LoadAssemblyFunctions(IntPtr assemblyPathPointer, IntPtr functionNamesPointer, int count, IntPtr functionsPointer, bool optional) {
+			string assemblyPath = Marshal.PtrToStringAuto(assemblyPathPointer);
+			IntPtr* functionNames = (IntPtr*)functionNamesPointer;
+			IntPtr* functions = (IntPtr*)functionsPointer;
 
-				type = pluginLoader.LoadDefaultAssembly().GetType(typeName);
-				method = type.GetMethod(methodName, BindingFlags.Public | BindingFlags.Static);
-			}
+			for (int i = 0; i < count; i++) {
+				string functionName = Marshal.PtrToStringAuto(functionNames[i]);
+				int separator = functionName.LastIndexOf('.');
 
-			catch (Exception exception) {
-				if (!optional) {
-					if (typeName.Length == 0 || methodName.Length == 0) {
-						Core.Exception("Type or method names can not be empty to load assembly function from \"" + assemblyPath + "\"\r\n" + exception.ToString());
+				if (separator <= 0 || separator == functionName.Length - 1) {
+					if (!optional)
+						Core.Log(LogLevel.Error, "Function name \"" + functionName + "\" in \"" + assemblyPath + "\" should be specified as a full type name followed by a method name");
 
-						return IntPtr.Zero;
-					}
+					functions[i] = IntPtr.Zero;
 
-					Core.Exception("Unable to load assembly function in \"" + assemblyPath + "\" of type name \"" + typeName + "\" with method name \"" + methodName + "\"\r\n" + exception.ToString());
+					continue;
 				}
 
-				return IntPtr.Zero;
+				functions[i] = ResolveAssemblyFunction(assemblyPath, functionName.Substring(0, separator), functionName.Substring(separator + 1), optional);
 			}
+		}
 
-			if (method == null) {
-				if (!optional)
-					Core.Log(LogLevel.Error, "Unable to find assembly function in \"" + assemblyPath + "\" of type name \"" + typeName + "\" with method name \"" + methodName + "\"");
+		[MethodImpl(MethodImplOptions.NoInlining)]
+		internal static void UnloadAssemblies() {
+			try {
+				foreach (PluginLoader pluginLoader in pluginLoaders) {
+					pluginLoader.Dispose();
+				}
 
-				return IntPtr.Zero;
-			}
+				pluginLoaders.Clear();
+				assemblies.Clear();
+				assemblyFunctions.Clear();
 
-			foreach (AssemblyName referencedAssembly in Assembly.GetAssembly(type).GetReferencedAssemblies()) {
-				if (referencedAssembly.Name == "UnrealEngine.Framework") {
-					Assembly frameworkAssembly = pluginLoader.LoadAssembly(referencedAssembly);
+				WeakReference unloadingContextWeakReference = assembliesContextWeakReference;
 
-					using (assembliesContextManager.assembliesContext.EnterContextualReflection()) {
-						Type sharedClass = frameworkAssembly.GetType("UnrealEngine.Framework.Shared");
+				assembliesContextManager.UnloadAssembliesContext();
+				assembliesContextManager = new AssembliesContextManager();
+				assembliesContextManager.CreateAssembliesContext();
 
-						if ((bool)sharedClass.GetField("loaded", BindingFlags.NonPublic | BindingFlags.Static).GetValue(null) == false)
-							sharedClass.GetMethod("Load", BindingFlags.NonPublic | BindingFlags.Static).Invoke(null, new object[] { sharedFunctions });
-					}
+				Thread unloadThread = new Thread(() => WaitForUnload(unloadingContextWeakReference)) {
+					Name = "UnrealCLR Unload",
+					IsBackground = true
+				};
 
-					break;
-				}
+				unloadThread.Start();
 			}
 
-			return method.MethodHandle.GetFunctionPointer();
+			catch (Exception exception) {
+				Core.Exception("Unloading of assemblies was finished incorrectly\r\n" + exception.ToString());
+			}
 		}
 
-		[MethodImpl(MethodImplOptions.NoInlining)]
-		internal static void UnloadAssemblies() {
+		// Managed functionality
+
+		private static readonly TimeSpan unloadTimeout = TimeSpan.FromSeconds(10.0);
+		private static readonly TimeSpan unloadInterval = TimeSpan.FromMilliseconds(10.0);
+		private static readonly TimeSpan unloadMaximumInterval = TimeSpan.FromSeconds(1.0);
+
+		// Collects the unloading context off the game thread, the new context is already available at this point
+		// The interval between blocking collections is doubled after each attempt to not stall the next play session if the context is kept alive
+		private static void WaitForUnload(WeakReference contextWeakReference) {
 			try {
-				foreach (KeyValuePair<int, PluginLoader> pluginLoader in pluginLoaders) {
-					pluginLoader.Value.Dispose();
-				}
+				Stopwatch stopwatch = Stopwatch.StartNew();
+				bool warned = false;
+				int unloadAttempts = 0;
+				TimeSpan interval = unloadInterval;
 
-				pluginLoaders.Clear();
+				while (contextWeakReference.IsAlive) {
+					if (stopwatch.Elapsed >= unloadTimeout) {
+						Core.Log(LogLevel.Error, "Unloading of assemblies was failed after " + unloadAttempts + " attempts! This might be caused by running threads, strong GC handles, or by other sources that prevent cooperative unloading.");
 
-				assembliesContextManager.UnloadAssembliesContext();
-				assembliesContextManager = null;
+						if (AppContext.TryGetSwitch("UnrealEngine.Runtime.UnloadDiagnostics", out bool diagnostics) && diagnostics)
+							ReportStaticFields(contextWeakReference);
+
+						return;
+					}
+
+					if (!warned && stopwatch.Elapsed >= unloadTimeout / 2) {
+						Core.Log(LogLevel.Warning, "Unloading of assemblies took more time than expected. Collection attempts are continued in the background...");
 
-				uint unloadAttempts = 0;
+						warned = true;
+					}
 
-				while (assembliesContextWeakReference.IsAlive) {
 					GC.Collect(GC.MaxGeneration, GCCollectionMode.Forced);
 					GC.WaitForPendingFinalizers();
 
 					unloadAttempts++;
 
-					if (unloadAttempts == 5000) {
-						Core.Log(LogLevel.Warning, "Unloading of assemblies took more time than expected. Trying to unload assemblies to the next breakpoint...");
-					} else if (unloadAttempts == 10000) {
-						Core.Log(LogLevel.Error, "Unloading of assemblies was failed! This might be caused by running threads, strong GC handles, or by other sources that prevent cooperative unloading.");
+					if (contextWeakReference.IsAlive) {
+						Thread.Sleep(interval);
 
-						break;
+						interval = interval < unloadMaximumInterval / 2 ? interval * 2 : unloadMaximumInterval;
 					}
 				}
 
-				assembliesContextManager = new AssembliesContextManager();
-				assembliesContextManager.CreateAssembliesContext();
+				Core.Log(LogLevel.Display, "Assemblies unloaded in " + stopwatch.Elapsed.TotalMilliseconds.ToString("F1", CultureInfo.InvariantCulture) + " ms after " + unloadAttempts + " attempts");
 			}
 
 			catch (Exception exception) {
-				Core.Exception("Unloading of assemblies was finished incorrectly\r\n" + exception.ToString());
+				Core.Log(LogLevel.Error, "Unloading of assemblies was finished incorrectly\r\n" + exception.ToString());
 			}
 		}
 
-		// Managed functionality
+		// Dumps static fields in the unloading context that hold objects, fields of types with static constructors are not evaluated to avoid running initializers
+		// This isn't a root analysis, GC handles, running threads, and delegates registered outside of the context are not detected
+		[MethodImpl(MethodImplOptions.NoInlining)]
+		private static void ReportStaticFields(WeakReference contextWeakReference) {
+			if (!(contextWeakReference.Target is AssemblyLoadContext context))
+				return;
+
+			StringBuilder report = new StringBuilder("Static fields that hold objects in the assemblies context, GC handles, running threads, and external delegates are not listed:");
+
+			foreach (Assembly assembly in context.Assemblies) {
+				Type[] types;
+
+				try {
+					types = assembly.GetTypes();
+				}
+
+				catch (ReflectionTypeLoadException exception) {
+					types = exception.Types;
+				}
+
+				report.Append("\r\n  Assembly " + assembly.FullName);
+
+				foreach (Type type in types) {
+					if (type == null || type.ContainsGenericParameters)
+						continue;
+
+					bool initializer = type.TypeInitializer != null;
+
+					foreach (FieldInfo field in type.GetFields(BindingFlags.Static | BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.DeclaredOnly)) {
+						if (field.IsLiteral || field.FieldType.IsPrimitive || field.FieldType.IsEnum)
+							continue;
+
+						if (initializer) {
+							if (typeof(Delegate).IsAssignableFrom(field.FieldType) || typeof(Thread).IsAssignableFrom(field.FieldType))
+								report.Append("\r\n    " + type.FullName + "." + field.Name + " (" + field.FieldType.Name + ", not evaluated)");
+
+							continue;
+						}
+
+						object value = field.GetValue(null);
+
+						if (value != null && !(value is string))
+							report.Append("\r\n    " + type.FullName + "." + field.Name + " (" + value.GetType().Name + ")");
+					}
+				}
+			}
+
+			context = null;
+
+			Core.Log(LogLevel.Warning, report.ToString());
+		}
+
+		private static IntPtr ResolveAssemblyFunction(string assemblyPath, string typeName, string methodName, bool optional) {
+			(string, string, string) key = (assemblyPath, typeName, methodName);
+
+			if (assemblyFunctions.TryGetValue(key, out IntPtr function))
+				return function;
+
+			Type type = null;
+			MethodInfo method = null;
+			PluginLoader pluginLoader = null;
+
+			try {
+				if (!assemblies.TryGetValue(assemblyPath, out Assembly assembly)) {
+					pluginLoader = PluginLoader.CreateFromAssemblyFile(assemblyPath, config => { config.DefaultContext = assembliesContextManager.assembliesContext; config.IsUnloadable = true; });
+					assembly = pluginLoader.LoadDefaultAssembly();
+
+					foreach (AssemblyName referencedAssembly in assembly.GetReferencedAssemblies()) {
+						if (referencedAssembly.Name == "UnrealEngine.Framework") {
+							Assembly frameworkAssembly = pluginLoader.LoadAssembly(referencedAssembly);
+
+							using (assembliesContextManager.assembliesContext.EnterContextualReflection()) {
+								Type sharedClass = frameworkAssembly.GetType("UnrealEngine.Framework.Shared");
+
+								if ((bool)sharedClass.GetField("loaded", BindingFlags.NonPublic | BindingFlags.Static).GetValue(null) == false)
+									sharedClass.GetMethod("Load", BindingFlags.NonPublic | BindingFlags.Static).Invoke(null, new object[] { sharedFunctions });
+							}
+
+							break;
+						}
+					}
+
+					pluginLoaders.Add(pluginLoader);
+					assemblies.Add(assemblyPath, assembly);
+					pluginLoader = null;
+				}
+
+				type = assembly.GetType(typeName);
+				method = type.GetMethod(methodName, BindingFlags.Public | BindingFlags.Static);
+			}
+
+			catch (Exception exception) {
+				// The loader of an assembly which failed to load is released instead of being kept until the next unloading
+				pluginLoader?.Dispose();
+
+				if (!optional) {
+					if (typeName.Length == 0 || methodName.Length == 0) {
+						Core.Exception("Type or method names can not be empty to load assembly function from \"" + assemblyPath + "\"\r\n" + exception.ToString());
+
+						return IntPtr.Zero;
+					}
+
+					Core.Exception("Unable to load assembly function in \"" + assemblyPath + "\" of type name \"" + typeName + "\" with method name \"" + methodName + "\"\r\n" + exception.ToString());
+				}
+
+				return IntPtr.Zero;
+			}
+
+			if (method == null) {
+				if (!optional)
+					Core.Log(LogLevel.Error, "Unable to find assembly function in \"" + assemblyPath + "\" of type name \"" + typeName + "\" with method name \"" + methodName + "\"");
+
+				return IntPtr.Zero;
+			}
+
+			function = method.MethodHandle.GetFunctionPointer();
+			assemblyFunctions.Add(key, function);
+
+			return function;
+		}
 
 		internal delegate void InvokeDelegate(IntPtr managedFunction);
 		internal delegate void ExceptionDelegate(string message);
@@ -165,7 +302,9 @@ namespace UnrealEngine.Runtime {
 
 		internal static AssembliesContextManager assembliesContextManager;
 		internal static WeakReference assembliesContextWeakReference;
-		internal static Dictionary<int, PluginLoader> pluginLoaders;
+		internal static List<PluginLoader> pluginLoaders;
+		internal static Dictionary<string, Assembly> assemblies;
+		internal static Dictionary<(string, string, string), IntPtr> assemblyFunctions;
 		internal static IntPtr sharedFunctions;
 
 		internal static InvokeDelegate Invoke;
@@ -177,7 +316,9 @@ namespace UnrealEngine.Runtime {
 			assembliesContextManager = new AssembliesContextManager();
 			assembliesContextManager.CreateAssembliesContext();
 
-			pluginLoaders = new Dictionary<int, PluginLoader>();
+			pluginLoaders = new List<PluginLoader>();
+			assemblies = new Dictionary<string, Assembly>(StringComparer.Ordinal);
+			assemblyFunctions = new Dictionary<(string, string, string), IntPtr>();
 
 			int position = 0;
 			IntPtr* buffer = (IntPtr*)functions;
@@ -198,6 +339,7 @@ namespace UnrealEngine.Runtime {
 				nativeFunctions[head++] = typeof(Core).GetMethod("ExecuteAssemblyFunction", BindingFlags.NonPublic | BindingFlags.Static).MethodHandle.GetFunctionPointer();
 				nativeFunctions[head++] = typeof(Core).GetMethod("LoadAssemblyFunction", BindingFlags.NonPublic | BindingFlags.Static).MethodHandle.GetFunctionPointer();
 				nativeFunctions[head++] = typeof(Core).GetMethod("UnloadAssemblies", BindingFlags.NonPublic | BindingFlags.Static).MethodHandle.GetFunctionPointer();
+				nativeFunctions[head++] = typeof(Core).GetMethod("LoadAssemblyFunctions", BindingFlags.NonPublic | BindingFlags.Static).MethodHandle.GetFunctionPointer();
 			}
 
 			sharedFunctions = buffer[position++];
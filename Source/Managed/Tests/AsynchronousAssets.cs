@@ -0,0 +1,145 @@
+using System;
+using System.Drawing;
+using System.Numerics;
+using System.Reflection;
+using System.Threading;
+using System.Threading.Tasks;
+using UnrealEngine.Framework;
+
+namespace UnrealEngine.Tests {
+	public static class AsynchronousAssets {
+		private static CancellationTokenSource pendingLoads;
+
+		public static void OnBeginPlay() {
+			Debug.Log(LogLevel.Display, "Hello, Unreal Engine!");
+			Debug.AddOnScreenMessage(-1, 3.0f, Color.LightGreen, MethodBase.GetCurrentMethod().DeclaringType + " system started!");
+
+			World.GetFirstPlayerController().SetViewTarget(World.GetActor<Camera>("MainCamera"));
+
+			pendingLoads = new CancellationTokenSource();
+
+			Actor actor = new Actor();
+			StaticMeshComponent staticMeshComponent = new StaticMeshComponent(actor, setAsRoot: true);
+
+			staticMeshComponent.SetStaticMesh(StaticMesh.Plane);
+			staticMeshComponent.SetMaterial(0, Material.Load("/Game/Tests/TextureMaterial"));
+			staticMeshComponent.SetWorldLocation(new Vector3(0.0f, 0.0f, -800.0f));
+			staticMeshComponent.SetWorldRotation(Maths.Euler(0.0f, 90.0f, -90.0f));
+
+			LoadTest(staticMeshComponent.CreateAndSetMaterialInstanceDynamic(0));
+			LoadMultipleTest();
+			CanceledBeforeLoadTest();
+			CanceledDuringLoadTest();
+
+			Debug.AddOnScreenMessage(-1, 10.0f, Color.MediumTurquoise, "Verify " + MethodBase.GetCurrentMethod().DeclaringType + " results in output log!");
+		}
+
+		public static void OnEndPlay() {
+			pendingLoads.Cancel();
+			pendingLoads.Dispose();
+			pendingLoads = null;
+
+			Debug.Log(LogLevel.Display, "See you soon, Unreal Engine!");
+			Debug.ClearOnScreenMessages();
+		}
+
+		private static async void LoadTest(MaterialInstanceDynamic materialInstanceDynamic) {
+			Debug.Log(LogLevel.Display, "Starting " + MethodBase.GetCurrentMethod().Name + "...");
+
+			try {
+				Texture2D texture = await Texture2D.LoadAsync("/Game/Tests/BasicTexture", pendingLoads.Token);
+
+				if (texture == null) {
+					Debug.Log(LogLevel.Error, "Texture loading failed!");
+
+					return;
+				}
+
+				materialInstanceDynamic.SetTextureParameterValue("Texture", texture);
+
+				Vector2 textureSize = default(Vector2);
+
+				texture.GetSize(ref textureSize);
+
+				Debug.AddOnScreenMessage(-1, 5.0f, Color.PowderBlue, "Texture size: " + textureSize);
+				Debug.Log(LogLevel.Display, "Test passed successfully!");
+			}
+
+			catch (OperationCanceledException) {
+				Debug.Log(LogLevel.Display, "Loading of the texture was canceled by the end of play");
+			}
+		}
+
+		private static async void LoadMultipleTest() {
+			Debug.Log(LogLevel.Display, "Starting " + MethodBase.GetCurrentMethod().Name + "...");
+
+			try {
+				Texture2D[] textures = await Texture2D.LoadAsync(new string[] { "/Game/Tests/BasicTexture", "/Game/Tests/MissingTexture" }, pendingLoads.Token);
+
+				if (textures.Length != 2 || textures[0] == null || textures[1] != null) {
+					Debug.Log(LogLevel.Error, "Textures are not reported in the order of names!");
+
+					return;
+				}
+
+				Debug.Log(LogLevel.Display, "Test passed successfully!");
+			}
+
+			catch (OperationCanceledException) {
+				Debug.Log(LogLevel.Display, "Loading of the textures was canceled by the end of play");
+			}
+		}
+
+		private static async void CanceledBeforeLoadTest() {
+			Debug.Log(LogLevel.Display, "Starting " + MethodBase.GetCurrentMethod().Name + "...");
+
+			Task<Texture2D> task = Texture2D.LoadAsync("/Game/Tests/BasicTexture", new CancellationToken(true));
+
+			if (!task.IsCanceled) {
+				Debug.Log(LogLevel.Error, "Task is not canceled by the canceled token!");
+
+				return;
+			}
+
+			try {
+				await task;
+			}
+
+			catch (OperationCanceledException) {
+				Debug.Log(LogLevel.Display, "Test passed successfully!");
+
+				return;
+			}
+
+			Debug.Log(LogLevel.Error, "Test failed!");
+		}
+
+		private static async void CanceledDuringLoadTest() {
+			Debug.Log(LogLevel.Display, "Starting " + MethodBase.GetCurrentMethod().Name + "...");
+
+			using (CancellationTokenSource cancellationTokenSource = new CancellationTokenSource()) {
+				Task<Texture2D> task = Texture2D.LoadAsync("/Game/Tests/BasicTexture", cancellationTokenSource.Token);
+
+				if (task.IsCompleted) {
+					Debug.Log(LogLevel.Display, "The asset is already loaded, the request was completed before the cancellation");
+
+					return;
+				}
+
+				cancellationTokenSource.Cancel();
+
+				try {
+					await task;
+				}
+
+				catch (OperationCanceledException) {
+					Debug.Log(LogLevel.Display, "Test passed successfully!");
+
+					return;
+				}
+			}
+
+			Debug.Log(LogLevel.Error, "Test failed!");
+		}
+	}
+}
\ No newline at end of file
@@ -29,6 +29,8 @@ namespace UnrealEngine.Tests {
 			TestSceneComponentIntProperty();
 			TestSceneComponentFloatProperty();
 			TestSceneComponentTextProperty();
+			TestActorPropertyHandle();
+			TestSceneComponentPropertyHandle();
 		}
 
 		public static void OnEndPlay() {
@@ -145,6 +147,32 @@ namespace UnrealEngine.Tests {
 			else
 				Debug.AddOnScreenMessage(-1, 30.0f, Color.Red, value.GetType() + " scene component property value retrievement failed!");
 		}
+
+		private static void TestActorPropertyHandle() {
+			float value = 0;
+			PropertyHandle property = actor.GetPropertyHandle("Test Float");
+
+			Assert.IsTrue(property.IsValid);
+			Assert.IsTrue(actor.SetFloat(property, 125.25f));
+
+			if (actor.GetFloat(property, ref value))
+				Debug.AddOnScreenMessage(-1, 30.0f, Color.LimeGreen, value.GetType() + " actor property value retrieved through handle: " + value);
+			else
+				Debug.AddOnScreenMessage(-1, 30.0f, Color.Red, value.GetType() + " actor property value retrievement through handle failed!");
+		}
+
+		private static void TestSceneComponentPropertyHandle() {
+			string value = String.Empty;
+			PropertyHandle property = sceneComponent.GetPropertyHandle("Test Text");
+
+			Assert.IsTrue(property.IsValid);
+			Assert.IsTrue(sceneComponent.SetText(property, "Test message through handle from managed code"));
+
+			if (sceneComponent.GetText(property, ref value))
+				Debug.AddOnScreenMessage(-1, 30.0f, Color.LimeGreen, value.GetType() + " scene component property value retrieved through handle: " + value);
+			else
+				Debug.AddOnScreenMessage(-1, 30.0f, Color.Red, value.GetType() + " scene component property value retrievement through handle failed!");
+		}
 	}
 
 	public static class BlueprintActor {
@@ -11,7 +11,9 @@ namespace UnrealEngine.Tests {
 		private static SceneComponent[] sceneComponent = new SceneComponent[maxCubes];
 		private static InstancedStaticMeshComponent instancedStaticMeshComponent = new InstancedStaticMeshComponent(actor, setAsRoot: true);
 		private static Material material = Material.Load("/Game/Tests/BasicMaterial");
+		private static CommandBuffer commandBuffer = new CommandBuffer(maxCubes);
 		private static Transform transform = default(Transform);
+		private static Transform[] transforms = new Transform[maxCubes];
 		private static float rotationSpeed = 2.5f;
 
 		public static void OnBeginPlay() {
@@ -37,6 +39,8 @@ namespace UnrealEngine.Tests {
 		}
 
 		public static void OnEndPlay() {
+			commandBuffer.Dispose();
+
 			Debug.Log(LogLevel.Display, "See you soon, Unreal Engine!");
 			Debug.ClearOnScreenMessages();
 		}
@@ -48,10 +52,13 @@ namespace UnrealEngine.Tests {
 			Quaternion deltaRotation = Quaternion.CreateFromYawPitchRoll(rotationSpeed * deltaTime, rotationSpeed * deltaTime, rotationSpeed * deltaTime);
 
 			for (int i = 0; i < maxCubes; i++) {
-				sceneComponent[i].AddLocalRotation(deltaRotation);
-				sceneComponent[i].GetTransform(ref transform);
-				instancedStaticMeshComponent.UpdateInstanceTransform(i, transform, markRenderStateDirty: i == maxCubes - 1);
+				commandBuffer.AddLocalRotation(sceneComponent[i], deltaRotation);
 			}
+
+			commandBuffer.Flush();
+
+			SceneComponent.GetTransforms(sceneComponent, transforms);
+			instancedStaticMeshComponent.UpdateInstanceTransforms(0, transforms);
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,97 @@
+using System;
+using System.Diagnostics;
+using System.Drawing;
+using System.IO;
+using System.Numerics;
+using System.Reflection;
+using System.Reflection.PortableExecutable;
+using UnrealEngine.Framework;
+using Debug = UnrealEngine.Framework.Debug;
+
+namespace UnrealEngine.Tests {
+	public static class InteropPerformance {
+		private const int iterations = 100000;
+		private static Actor actor = new Actor("BenchmarkActor");
+		private static SceneComponent sceneComponent = new SceneComponent(actor, setAsRoot: true);
+		private static Stopwatch stopwatch = new Stopwatch();
+		private static Vector3 location = default(Vector3);
+		private static Name benchmarkTag = new Name("BenchmarkTag");
+		private static SceneComponent[] components = new SceneComponent[1];
+		private static char[] nameBuffer = new char[256];
+		private static string mode = (bool)typeof(Actor).Assembly.GetType("UnrealEngine.Framework.Shared").GetField("blittableFunctions", BindingFlags.NonPublic | BindingFlags.Static).GetValue(null) ? "blittable" : "marshalled";
+		private static string compilation = IsReadyToRun(typeof(Actor).Assembly) ? "ReadyToRun" : "JIT";
+
+		public static void OnBeginPlay() {
+			Debug.Log(LogLevel.Display, "Starting " + MethodBase.GetCurrentMethod().DeclaringType + " in " + mode + " functions mode with " + compilation + " framework code...");
+
+			Measure("Scalar getter", ScalarGetterTest);
+			Measure("String argument", StringArgumentTest);
+			Measure("Name argument", NameArgumentTest);
+			Measure("String buffer", StringBufferTest);
+			Measure("String span", StringSpanTest);
+			Measure("Vector reference", VectorReferenceTest);
+			Measure("Vector input", VectorInputTest);
+			Measure("Component lookup", ComponentLookupTest);
+
+			if (InteropStatistics.IsEnabled) {
+				for (int i = 0; i < InteropStatistics.Count; i++) {
+					InteropCounter counter = InteropStatistics.GetCounter(i);
+
+					if (counter.Calls > 0)
+						Debug.Log(LogLevel.Display, counter.ToString());
+				}
+			}
+
+			Debug.AddOnScreenMessage(-1, 10.0f, Color.MediumTurquoise, "Verify " + MethodBase.GetCurrentMethod().DeclaringType + " results in output log!");
+		}
+
+		public static void OnEndPlay() {
+			actor.Destroy();
+			Debug.ClearOnScreenMessages();
+		}
+
+		private static void Measure(string name, Action test) {
+			stopwatch.Restart();
+
+			test();
+
+			stopwatch.Stop();
+
+			Debug.Log(LogLevel.Display, name + " first call cost: " + (stopwatch.Elapsed.TotalMilliseconds * 1000.0).ToString("F1") + " us (" + compilation + ")");
+
+			stopwatch.Restart();
+
+			for (int i = 0; i < iterations; i++) {
+				test();
+			}
+
+			stopwatch.Stop();
+
+			double nanoseconds = (stopwatch.Elapsed.TotalMilliseconds * 1000000.0) / iterations;
+
+			Debug.Log(LogLevel.Display, name + " call cost: " + nanoseconds.ToString("F1") + " ns (" + mode + ")");
+		}
+
+		private static bool IsReadyToRun(Assembly assembly) {
+			using (PEReader reader = new PEReader(File.OpenRead(assembly.Location))) {
+				return reader.PEHeaders.CorHeader.ManagedNativeHeaderDirectory.Size > 0;
+			}
+		}
+
+		private static void ScalarGetterTest() => _ = Engine.FrameNumber;
+
+		private static void StringArgumentTest() => actor.HasTag("BenchmarkTag");
+
+		private static void NameArgumentTest() => actor.HasTag(benchmarkTag);
+
+		private static void StringBufferTest() => _ = actor.Name;
+
+		private static void StringSpanTest() => actor.TryGetName(nameBuffer, out _);
+
+		private static void VectorReferenceTest() => sceneComponent.GetLocation(ref location);
+
+		private static void VectorInputTest() => sceneComponent.SetRelativeLocation(location);
+
+		private static void ComponentLookupTest() => actor.GetComponents<SceneComponent>(components);
+	}
+}
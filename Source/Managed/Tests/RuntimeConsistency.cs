@@ -2,6 +2,8 @@ using System;
 using System.Drawing;
 using System.Numerics;
 using System.Reflection;
+using System.Threading;
+using System.Threading.Tasks;
 using UnrealEngine.Framework;
 
 namespace UnrealEngine.Tests {
@@ -12,6 +14,8 @@ namespace UnrealEngine.Tests {
 			DuplicateActorMemoryManagementTest();
 			DuplicateComponentMemoryManagementTest();
 			ConsoleVariablesMemoryManagementTest();
+			GameThreadDispatchTest();
+			BackgroundLoggingTest();
 
 			Debug.AddOnScreenMessage(-1, 10.0f, Color.MediumTurquoise, "Verify " + MethodBase.GetCurrentMethod().DeclaringType + " results in output log!");
 		}
@@ -153,5 +157,33 @@ namespace UnrealEngine.Tests {
 
 			Debug.Log(LogLevel.Error, "Test failed!");
 		}
+
+		private static void GameThreadDispatchTest() {
+			Debug.Log(LogLevel.Display, "Starting " + MethodBase.GetCurrentMethod().Name + "...");
+
+			Task.Run(async () => {
+				bool dispatched = await GameThread.InvokeAsync(() => GameThread.IsCurrent && Engine.FrameNumber > 0);
+
+				GameThread.Post(() => {
+					if (!dispatched || !GameThread.IsCurrent) {
+						Debug.Log(LogLevel.Error, "Test failed!");
+
+						return;
+					}
+
+					Debug.Log(LogLevel.Display, "Posted actions have successfully reached the game thread");
+				});
+			});
+		}
+
+		private static void BackgroundLoggingTest() {
+			Debug.Log(LogLevel.Display, "Starting " + MethodBase.GetCurrentMethod().Name + "...");
+
+			Jobs.ParallelFor(Jobs.WorkerCount + 1, 1, (start, end) => {
+				for (int i = start; i < end; i++) {
+					Debug.Log(LogLevel.Display, "RuntimeConsistency", "Message from the thread " + Thread.CurrentThread.ManagedThreadId + " has successfully reached the output log");
+				}
+			});
+		}
 	}
 }
\ No newline at end of file
@@ -18,8 +18,28 @@
 
 DEFINE_LOG_CATEGORY(LogUnrealCLR);
 
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Host library load (ms)"), STAT_HostLibraryLoad, STATGROUP_UnrealCLR);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Runtime initialization (ms)"), STAT_RuntimeInitialization, STATGROUP_UnrealCLR);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Runtime assembly load (ms)"), STAT_RuntimeAssemblyLoad, STATGROUP_UnrealCLR);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Table binding (ms)"), STAT_TableBinding, STATGROUP_UnrealCLR);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Runtime assembly initialization (ms)"), STAT_RuntimeAssemblyInitialization, STATGROUP_UnrealCLR);
+
 void UnrealCLR::Module::StartupModule() {
-	#define HOSTFXR_VERSION "3.1.5"
+	UnrealCLR::Status = UnrealCLR::StatusType::Stopped;
+	UnrealCLR::ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
+	UnrealCLR::UserAssembliesPath = UnrealCLR::ProjectPath + TEXT("Managed/");
+
+	OnPreWorldInitializationHandle = FWorldDelegates::OnPreWorldInitialization.AddRaw(this, &UnrealCLR::Module::OnPreWorldInitialization);
+	OnWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &UnrealCLR::Module::OnWorldCleanup);
+	OnWorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddRaw(this, &UnrealCLR::Module::OnWorldTickStart);
+
+	HostTask = Async(EAsyncExecution::Thread, [this]() {
+		LoadHost();
+	});
+}
+
+void UnrealCLR::Module::LoadHost() {
+	#define HOSTFXR_VERSION UNREALCLR_HOSTFXR_VERSION
 	#define HOSTFXR_WINDOWS "/hostfxr.dll"
 	#define HOSTFXR_MAC "/libhostfxr.dylib"
 	#define HOSTFXR_LINUX "/libhostfxr.so"
@@ -32,20 +52,25 @@ void UnrealCLR::Module::StartupModule() {
 		#define HOSTFXR_PATH "Plugins/UnrealCLR/Runtime/Linux/host/fxr/" HOSTFXR_VERSION HOSTFXR_LINUX
 	#endif
 
-	UnrealCLR::Status = UnrealCLR::StatusType::Stopped;
-	UnrealCLR::ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
-	UnrealCLR::UserAssembliesPath = UnrealCLR::ProjectPath + TEXT("Managed/");
-
 	FString hostfxrPath = UnrealCLR::ProjectPath + TEXT(HOSTFXR_PATH);
 	FString assembliesPath = UnrealCLR::ProjectPath + TEXT("Plugins/UnrealCLR/Managed/");
-	FString runtimeConfigPath = assembliesPath + TEXT("UnrealEngine.Runtime.runtimeconfig.json");
-	FString runtimeAssemblyPath = assembliesPath + TEXT("UnrealEngine.Runtime.dll");
-	FString runtimeTypeName = TEXT("UnrealEngine.Runtime.Core, UnrealEngine.Runtime");
-	FString runtimeMethodName = TEXT("Initialize");
-	FString runtimeMethodDelegateName = TEXT("UnrealEngine.Runtime.InitializeDelegate, UnrealEngine.Runtime");
+	FString runtimeConfigPath = assembliesPath + TEXT(UNREALCLR_RUNTIME_CONFIG);
+	FString runtimeAssemblyPath = assembliesPath + TEXT(UNREALCLR_RUNTIME_ASSEMBLY);
 
-	OnPreWorldInitializationHandle = FWorldDelegates::OnPreWorldInitialization.AddRaw(this, &UnrealCLR::Module::OnPreWorldInitialization);
-	OnWorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &UnrealCLR::Module::OnWorldCleanup);
+	auto now = []() {
+		return FPlatformTime::Seconds() * 1000.0;
+	};
+
+	double time = now();
+
+	auto measure = [&time, &now]() {
+		const double current = now();
+		const double elapsed = current - time;
+
+		time = current;
+
+		return elapsed;
+	};
 
 	UE_LOG(LogUnrealCLR, Display, TEXT("%s: Host path set to \"%s\""), ANSI_TO_TCHAR(__FUNCTION__), *hostfxrPath);
 
@@ -54,805 +79,806 @@ void UnrealCLR::Module::StartupModule() {
 	if (HostfxrLibrary) {
 		UE_LOG(LogUnrealCLR, Display, TEXT("%s: Host library loaded successfuly!"), ANSI_TO_TCHAR(__FUNCTION__));
 
-		hostfxr_set_error_writer_fn HostfxrSetErrorWriter = (hostfxr_set_error_writer_fn)FPlatformProcess::GetDllExport(HostfxrLibrary, TEXT("hostfxr_set_error_writer"));
+		auto getExport = [](void* Library, const char* Name) {
+			return FPlatformProcess::GetDllExport(Library, ANSI_TO_TCHAR(Name));
+		};
+
+		UnrealCLR::InitializeDelegate Initialize = nullptr;
+		UnrealCLR::HostTimings hostTimings = { };
 
-		if (!HostfxrSetErrorWriter) {
-			UE_LOG(LogUnrealCLR, Error, TEXT("%s: Unable to locate hostfxr_set_error_writer entry point!"), ANSI_TO_TCHAR(__FUNCTION__));
+		if (const char* error = UnrealCLR::LoadRuntime(HostfxrLibrary, getExport, now, time, HostError, *runtimeConfigPath, *runtimeAssemblyPath, &Initialize, &hostTimings)) {
+			UE_LOG(LogUnrealCLR, Error, TEXT("%s: %s"), ANSI_TO_TCHAR(__FUNCTION__), ANSI_TO_TCHAR(error));
 
 			return;
 		}
 
-		hostfxr_initialize_for_runtime_config_fn HostfxrInitializeForRuntimeConfig = (hostfxr_initialize_for_runtime_config_fn)FPlatformProcess::GetDllExport(HostfxrLibrary, TEXT("hostfxr_initialize_for_runtime_config"));
+		Timings.HostLibraryLoad = hostTimings.HostLibraryLoad;
+		Timings.RuntimeInitialization = hostTimings.RuntimeInitialization;
+		Timings.RuntimeAssemblyLoad = hostTimings.RuntimeAssemblyLoad;
 
-		if (!HostfxrInitializeForRuntimeConfig) {
-			UE_LOG(LogUnrealCLR, Error, TEXT("%s: Unable to locate hostfxr_initialize_for_runtime_config entry point!"), ANSI_TO_TCHAR(__FUNCTION__));
+		measure();
 
-			return;
-		}
+		UE_LOG(LogUnrealCLR, Display, TEXT("%s: Host runtime assembly loaded succesfuly!"), ANSI_TO_TCHAR(__FUNCTION__));
 
-		hostfxr_get_runtime_delegate_fn HostfxrGetRuntimeDelegate = (hostfxr_get_runtime_delegate_fn)FPlatformProcess::GetDllExport(HostfxrLibrary, TEXT("hostfxr_get_runtime_delegate"));
+		if (Initialize) {
+			// Framework pointers
 
-		if (!HostfxrGetRuntimeDelegate) {
-			UE_LOG(LogUnrealCLR, Error, TEXT("%s: Unable to locate hostfxr_get_runtime_delegate entry point!"), ANSI_TO_TCHAR(__FUNCTION__));
+			int32 position = 0;
 
-			return;
-		}
+			#define UNREALCLR_TABLE_BEGIN(Table) { int32 head = 0; Shared::Functions[position++] = Shared::Table##Functions;
+			#define UNREALCLR_TABLE_ENTRY(Table, Function) Shared::Table##Functions[head++] = &UnrealCLRFramework::Table::Function;
+			#define UNREALCLR_TABLE_END(Table) }
 
-		hostfxr_close_fn HostfxrClose = (hostfxr_close_fn)FPlatformProcess::GetDllExport(HostfxrLibrary, TEXT("hostfxr_close"));
+			#include "UnrealCLRTables.inl"
 
-		if (!HostfxrClose) {
-			UE_LOG(LogUnrealCLR, Error, TEXT("%s: Unable to locate hostfxr_close entry point!"), ANSI_TO_TCHAR(__FUNCTION__));
+			#undef UNREALCLR_TABLE_BEGIN
+			#undef UNREALCLR_TABLE_ENTRY
+			#undef UNREALCLR_TABLE_END
 
-			return;
-		}
+			Timings.TableBinding = measure();
 
-		HostfxrSetErrorWriter(HostError);
+			// Runtime pointers
 
-		hostfxr_handle HostfxrContext = nullptr;
+			Shared::ManagedFunctions[0] = &UnrealCLR::Module::Invoke;
+			Shared::ManagedFunctions[1] = &UnrealCLR::Module::Exception;
+			Shared::ManagedFunctions[2] = &UnrealCLR::Module::Log;
 
-		if (HostfxrInitializeForRuntimeConfig(*runtimeConfigPath, nullptr, &HostfxrContext) != 0 || !HostfxrContext) {
-			UE_LOG(LogUnrealCLR, Error, TEXT("%s: Unable to initialize the host! Please, try to restart the engine."), ANSI_TO_TCHAR(__FUNCTION__));
+			const bool initialized = UnrealCLR::InitializeRuntime(Initialize, Shared::ManagedFunctions, Shared::NativeFunctions, Shared::Functions);
 
-			HostfxrClose(HostfxrContext);
+			Timings.RuntimeAssemblyInitialization = measure();
 
-			return;
-		}
+			if (initialized) {
+				UnrealCLR::ExecuteAssemblyFunction = (UnrealCLR::ExecuteAssemblyFunctionDelegate)Shared::NativeFunctions[0];
+				UnrealCLR::LoadAssemblyFunction = (UnrealCLR::LoadAssemblyFunctionDelegate)Shared::NativeFunctions[1];
+				UnrealCLR::UnloadAssemblies = (UnrealCLR::UnloadAssembliesDelegate)Shared::NativeFunctions[2];
+				UnrealCLR::LoadAssemblyFunctions = (UnrealCLR::LoadAssemblyFunctionsDelegate)Shared::NativeFunctions[3];
 
-		void* hostfxrLoadAssemblyAndGetFunctionPointer = nullptr;
+				UE_LOG(LogUnrealCLR, Display, TEXT("%s: Host runtime assembly initialized succesfuly!"), ANSI_TO_TCHAR(__FUNCTION__));
+			} else {
+				UE_LOG(LogUnrealCLR, Error, TEXT("%s: Host runtime assembly initialization failed!"), ANSI_TO_TCHAR(__FUNCTION__));
 
-		if (HostfxrGetRuntimeDelegate(HostfxrContext, hdt_load_assembly_and_get_function_pointer, &hostfxrLoadAssemblyAndGetFunctionPointer) != 0 || !HostfxrGetRuntimeDelegate) {
-			UE_LOG(LogUnrealCLR, Error, TEXT("%s: Unable to get hdt_load_assembly_and_get_function_pointer runtime delegate!"), ANSI_TO_TCHAR(__FUNCTION__));
+				return;
+			}
 
-			HostfxrClose(HostfxrContext);
+			IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+			if (!platformFile.DirectoryExists(*UnrealCLR::UserAssembliesPath)) {
+				platformFile.CreateDirectory(*UnrealCLR::UserAssembliesPath);
+
+				if (!platformFile.DirectoryExists(*UnrealCLR::UserAssembliesPath))
+					UE_LOG(LogUnrealCLR, Error, TEXT("%s: Unable to create a folder for managed assemblies at %s."), ANSI_TO_TCHAR(__FUNCTION__), *UnrealCLR::UserAssembliesPath);
+			}
+
+			UnrealCLR::Status = UnrealCLR::StatusType::Idle;
+
+			UE_LOG(LogUnrealCLR, Display, TEXT("%s: Host loaded succesfuly!"), ANSI_TO_TCHAR(__FUNCTION__));
+			UE_LOG(LogUnrealCLR, Display, TEXT("%s: Host startup timings: library load %.2f ms, runtime initialization %.2f ms, runtime assembly load %.2f ms, table binding %.2f ms, runtime assembly initialization %.2f ms"), ANSI_TO_TCHAR(__FUNCTION__), Timings.HostLibraryLoad, Timings.RuntimeInitialization, Timings.RuntimeAssemblyLoad, Timings.TableBinding, Timings.RuntimeAssemblyInitialization);
+		} else {
+			UE_LOG(LogUnrealCLR, Error, TEXT("%s: Host runtime assembly unable to load the initialization function!"), ANSI_TO_TCHAR(__FUNCTION__));
 
 			return;
 		}
+	} else {
+		UE_LOG(LogUnrealCLR, Error, TEXT("%s: Host loading failed!"), ANSI_TO_TCHAR(__FUNCTION__));
+	}
+}
+
+void UnrealCLR::Module::ShutdownModule() {
+	WaitForHost();
+
+	UnrealCLR::Logger::Drain();
+
+	FWorldDelegates::OnPreWorldInitialization.Remove(OnPreWorldInitializationHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(OnWorldCleanupHandle);
+	FWorldDelegates::OnWorldTickStart.Remove(OnWorldTickStartHandle);
+
+	FPlatformProcess::FreeDllHandle(HostfxrLibrary);
+}
 
-		HostfxrClose(HostfxrContext);
+void UnrealCLR::Module::WaitForHost() {
+	if (HostTask.IsValid()) {
+		HostTask.Wait();
+		HostTask = TFuture<void>();
+	}
 
-		UE_LOG(LogUnrealCLR, Display, TEXT("%s: Host functions loaded successfuly!"), ANSI_TO_TCHAR(__FUNCTION__));
+	SET_FLOAT_STAT(STAT_HostLibraryLoad, Timings.HostLibraryLoad);
+	SET_FLOAT_STAT(STAT_RuntimeInitialization, Timings.RuntimeInitialization);
+	SET_FLOAT_STAT(STAT_RuntimeAssemblyLoad, Timings.RuntimeAssemblyLoad);
+	SET_FLOAT_STAT(STAT_TableBinding, Timings.TableBinding);
+	SET_FLOAT_STAT(STAT_RuntimeAssemblyInitialization, Timings.RuntimeAssemblyInitialization);
+}
+
+void UnrealCLR::Module::OnPreWorldInitialization(UWorld* World, const UWorld::InitializationValues InitializationValues) {
+	WaitForHost();
+
+	if (World->IsGameWorld() && !UnrealCLR::Engine::World) {
+		UnrealCLR::Engine::World = World;
 
-		load_assembly_and_get_function_pointer_fn HostfxrLoadAssemblyAndGetFunctionPointer = (load_assembly_and_get_function_pointer_fn)hostfxrLoadAssemblyAndGetFunctionPointer;
+		OnActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateRaw(this, &UnrealCLR::Module::OnActorSpawned));
+		OnActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(this, &UnrealCLR::Module::OnActorDeleted);
 
-		int32 (*Initialize)(void* Functions) = nullptr;
+		UnrealCLR::ComponentIndex::Start();
 
-		if (HostfxrLoadAssemblyAndGetFunctionPointer && HostfxrLoadAssemblyAndGetFunctionPointer(*runtimeAssemblyPath, *runtimeTypeName, *runtimeMethodName, *runtimeMethodDelegateName, nullptr, (void**)&Initialize) == 0) {
-			UE_LOG(LogUnrealCLR, Display, TEXT("%s: Host runtime assembly loaded succesfuly!"), ANSI_TO_TCHAR(__FUNCTION__));
+		if (UnrealCLR::Status != UnrealCLR::StatusType::Stopped) {
+			UnrealCLR::Status = UnrealCLR::StatusType::Running;
 		} else {
-			UE_LOG(LogUnrealCLR, Error, TEXT("%s: Host runtime assembly loading failed!"), ANSI_TO_TCHAR(__FUNCTION__));
+			#if WITH_EDITOR
+				FNotificationInfo notificationInfo(FText::FromString(TEXT("UnrealCLR host is not initialized! Please, check logs and try to restart the engine.")));
 
-			return;
+				notificationInfo.ExpireDuration = 5.0f;
+
+				FSlateNotificationManager::Get().AddNotification(notificationInfo);
+			#endif
 		}
+	}
+}
 
-		if (Initialize) {
-			// Framework pointers
+void UnrealCLR::Module::OnWorldCleanup(UWorld* World, bool SessionEnded, bool CleanupResources) {
+	if (World->IsGameWorld() && World->GetFullName() == UnrealCLR::Engine::World->GetFullName()) {
+		UnrealCLR::Logger::Drain();
 
-			int32 position = 0;
+		World->RemoveOnActorSpawnedHandler(OnActorSpawnedHandle);
+		GEngine->OnLevelActorDeleted().Remove(OnActorDeletedHandle);
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::AssertFunctions;
+		UnrealCLR::ActorIndex::Clear();
+		UnrealCLR::ComponentIndex::Clear();
+		UnrealCLR::AssetLoader::Clear();
+		UnrealCLR::TickFunctions::Clear();
+		UnrealCLR::GameThread::Clear();
+		UnrealCLR::Statistics::Clear();
+		UnrealCLR::Engine::World = nullptr;
 
-				Shared::AssertFunctions[head++] = &UnrealCLRFramework::Assert::OutputMessage;
-			}
+		if (UnrealCLR::Status != UnrealCLR::StatusType::Stopped) {
+			UnrealCLR::UnloadAssemblies();
+			UnrealCLR::Status = UnrealCLR::StatusType::Idle;
+		}
+	}
+}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::CommandLineFunctions;
+void UnrealCLR::Module::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaTime) {
+	if (World == UnrealCLR::Engine::World) {
+		UnrealCLR::TickFunctions::Release();
+		UnrealCLR::Logger::Drain();
+		UnrealCLR::GameThread::Drain();
+		UnrealCLR::Statistics::Publish();
+	}
+}
 
-				Shared::CommandLineFunctions[head++] = &UnrealCLRFramework::CommandLine::Get;
-				Shared::CommandLineFunctions[head++] = &UnrealCLRFramework::CommandLine::Set;
-				Shared::CommandLineFunctions[head++] = &UnrealCLRFramework::CommandLine::Append;
-			}
+void UnrealCLR::Module::OnActorSpawned(AActor* Actor) {
+	UnrealCLR::ActorIndex::Add(Actor);
+}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::DebugFunctions;
-
-				Shared::DebugFunctions[head++] = &UnrealCLRFramework::Debug::Log;
-				Shared::DebugFunctions[head++] = &UnrealCLRFramework::Debug::HandleException;
-				Shared::DebugFunctions[head++] = &UnrealCLRFramework::Debug::AddOnScreenMessage;
-				Shared::DebugFunctions[head++] = &UnrealCLRFramework::Debug::ClearOnScreenMessages;
-				Shared::DebugFunctions[head++] = &UnrealCLRFramework::Debug::DrawBox;
-				Shared::DebugFunctions[head++] = &UnrealCLRFramework::Debug::DrawCapsule;
-				Shared::DebugFunctions[head++] = &UnrealCLRFramework::Debug::DrawCone;
-				Shared::DebugFunctions[head++] = &UnrealCLRFramework::Debug::DrawCylinder;
-				Shared::DebugFunctions[head++] = &UnrealCLRFramework::Debug::DrawSphere;
-				Shared::DebugFunctions[head++] = &UnrealCLRFramework::Debug::DrawLine;
-				Shared::DebugFunctions[head++] = &UnrealCLRFramework::Debug::DrawPoint;
-				Shared::DebugFunctions[head++] = &UnrealCLRFramework::Debug::FlushPersistentLines;
-			}
+void UnrealCLR::Module::OnActorDeleted(AActor* Actor) {
+	UnrealCLR::ActorIndex::Remove(Actor);
+	UnrealCLR::ComponentIndex::Remove(Actor);
+}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::ObjectFunctions;
-
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::IsPendingKill;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::IsValid;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::Load;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::Rename;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::GetName;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::GetBool;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::GetByte;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::GetShort;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::GetInt;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::GetLong;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::GetUShort;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::GetUInt;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::GetULong;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::GetFloat;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::GetDouble;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::GetText;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::SetBool;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::SetByte;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::SetShort;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::SetInt;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::SetLong;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::SetUShort;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::SetUInt;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::SetULong;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::SetFloat;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::SetDouble;
-				Shared::ObjectFunctions[head++] = &UnrealCLRFramework::Object::SetText;
-			}
+void UnrealCLR::Module::HostError(const char_t* Message) {
+	UE_LOG(LogUnrealCLR, Error, TEXT("%s: %s"), ANSI_TO_TCHAR(__FUNCTION__), *FString(Message));
+}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::ApplicationFunctions;
-
-				Shared::ApplicationFunctions[head++] = &UnrealCLRFramework::Application::IsCanEverRender;
-				Shared::ApplicationFunctions[head++] = &UnrealCLRFramework::Application::IsPackagedForDistribution;
-				Shared::ApplicationFunctions[head++] = &UnrealCLRFramework::Application::IsPackagedForShipping;
-				Shared::ApplicationFunctions[head++] = &UnrealCLRFramework::Application::GetProjectDirectory;
-				Shared::ApplicationFunctions[head++] = &UnrealCLRFramework::Application::GetDefaultLanguage;
-				Shared::ApplicationFunctions[head++] = &UnrealCLRFramework::Application::GetProjectName;
-				Shared::ApplicationFunctions[head++] = &UnrealCLRFramework::Application::GetVolumeMultiplier;
-				Shared::ApplicationFunctions[head++] = &UnrealCLRFramework::Application::SetProjectName;
-				Shared::ApplicationFunctions[head++] = &UnrealCLRFramework::Application::SetVolumeMultiplier;
-			}
+void UnrealCLR::Module::Invoke(void(*ManagedFunction)()) {
+	ManagedFunction();
+}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::ConsoleManagerFunctions;
-
-				Shared::ConsoleManagerFunctions[head++] = &UnrealCLRFramework::ConsoleManager::IsRegisteredVariable;
-				Shared::ConsoleManagerFunctions[head++] = &UnrealCLRFramework::ConsoleManager::FindVariable;
-				Shared::ConsoleManagerFunctions[head++] = &UnrealCLRFramework::ConsoleManager::RegisterVariableBool;
-				Shared::ConsoleManagerFunctions[head++] = &UnrealCLRFramework::ConsoleManager::RegisterVariableInt;
-				Shared::ConsoleManagerFunctions[head++] = &UnrealCLRFramework::ConsoleManager::RegisterVariableFloat;
-				Shared::ConsoleManagerFunctions[head++] = &UnrealCLRFramework::ConsoleManager::RegisterVariableString;
-				Shared::ConsoleManagerFunctions[head++] = &UnrealCLRFramework::ConsoleManager::RegisterCommand;
-				Shared::ConsoleManagerFunctions[head++] = &UnrealCLRFramework::ConsoleManager::UnregisterObject;
-			}
+void UnrealCLR::Module::Exception(const char* Message) {
+	UE_LOG(LogUnrealCLR, Error, TEXT("%s: %s"), ANSI_TO_TCHAR(__FUNCTION__), *FString(ANSI_TO_TCHAR(Message)));
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::EngineFunctions;
-
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::IsSplitScreen;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::IsEditor;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::IsForegroundWindow;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::IsExitRequested;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::GetNetMode;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::GetFrameNumber;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::GetViewportSize;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::GetScreenResolution;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::GetWindowMode;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::GetVersion;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::GetMaxFPS;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::SetMaxFPS;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::SetTitle;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::AddActionMapping;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::AddAxisMapping;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::ForceGarbageCollection;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::DelayGarbageCollection;
-				Shared::EngineFunctions[head++] = &UnrealCLRFramework::Engine::RequestExit;
-			}
+	AddOnScreenMessage(FColor::Red, Message);
+}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::HeadMountedDisplayFunctions;
+void UnrealCLR::Module::Log(UnrealCLR::LogLevel Level, const char* Message) {
+	#define UNREALCLR_LOG(Verbosity) UE_LOG(LogUnrealCLR, Verbosity, TEXT("%s: %s"), ANSI_TO_TCHAR(__FUNCTION__), *FString(ANSI_TO_TCHAR(Message)));
 
-				Shared::HeadMountedDisplayFunctions[head++] = &UnrealCLRFramework::HeadMountedDisplay::IsEnabled;
-				Shared::HeadMountedDisplayFunctions[head++] = &UnrealCLRFramework::HeadMountedDisplay::GetDeviceName;
-			}
+	if (Level == UnrealCLR::LogLevel::Display) {
+		UNREALCLR_LOG(Display);
+	} else if (Level == UnrealCLR::LogLevel::Warning) {
+		UNREALCLR_LOG(Warning);
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::WorldFunctions;
-
-				Shared::WorldFunctions[head++] = &UnrealCLRFramework::World::GetSimulatePhysics;
-				Shared::WorldFunctions[head++] = &UnrealCLRFramework::World::GetActorCount;
-				Shared::WorldFunctions[head++] = &UnrealCLRFramework::World::GetDeltaSeconds;
-				Shared::WorldFunctions[head++] = &UnrealCLRFramework::World::GetRealTimeSeconds;
-				Shared::WorldFunctions[head++] = &UnrealCLRFramework::World::GetTimeSeconds;
-				Shared::WorldFunctions[head++] = &UnrealCLRFramework::World::GetWorldOrigin;
-				Shared::WorldFunctions[head++] = &UnrealCLRFramework::World::GetActor;
-				Shared::WorldFunctions[head++] = &UnrealCLRFramework::World::GetActorByTag;
-				Shared::WorldFunctions[head++] = &UnrealCLRFramework::World::GetFirstPlayerController;
-				Shared::WorldFunctions[head++] = &UnrealCLRFramework::World::SetSimulatePhysics;
-				Shared::WorldFunctions[head++] = &UnrealCLRFramework::World::SetGravity;
-				Shared::WorldFunctions[head++] = &UnrealCLRFramework::World::SetWorldOrigin;
-			}
+		AddOnScreenMessage(FColor::Yellow, Message);
+	} else if (Level == UnrealCLR::LogLevel::Error) {
+		UNREALCLR_LOG(Error);
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::ConsoleObjectFunctions;
+		AddOnScreenMessage(FColor::Red, Message);
+	}
+}
 
-				Shared::ConsoleObjectFunctions[head++] = &UnrealCLRFramework::ConsoleObject::IsBool;
-				Shared::ConsoleObjectFunctions[head++] = &UnrealCLRFramework::ConsoleObject::IsInt;
-				Shared::ConsoleObjectFunctions[head++] = &UnrealCLRFramework::ConsoleObject::IsFloat;
-				Shared::ConsoleObjectFunctions[head++] = &UnrealCLRFramework::ConsoleObject::IsString;
-			}
+// Messages might arrive from other threads, such as the unloading of assemblies in the background, the screen is accessible only from the game thread
+void UnrealCLR::Module::AddOnScreenMessage(const FColor& Color, const char* Message) {
+	FString message(ANSI_TO_TCHAR(Message));
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::ConsoleVariableFunctions;
-
-				Shared::ConsoleVariableFunctions[head++] = &UnrealCLRFramework::ConsoleVariable::GetBool;
-				Shared::ConsoleVariableFunctions[head++] = &UnrealCLRFramework::ConsoleVariable::GetInt;
-				Shared::ConsoleVariableFunctions[head++] = &UnrealCLRFramework::ConsoleVariable::GetFloat;
-				Shared::ConsoleVariableFunctions[head++] = &UnrealCLRFramework::ConsoleVariable::GetString;
-				Shared::ConsoleVariableFunctions[head++] = &UnrealCLRFramework::ConsoleVariable::SetBool;
-				Shared::ConsoleVariableFunctions[head++] = &UnrealCLRFramework::ConsoleVariable::SetInt;
-				Shared::ConsoleVariableFunctions[head++] = &UnrealCLRFramework::ConsoleVariable::SetFloat;
-				Shared::ConsoleVariableFunctions[head++] = &UnrealCLRFramework::ConsoleVariable::SetString;
-				Shared::ConsoleVariableFunctions[head++] = &UnrealCLRFramework::ConsoleVariable::SetOnChangedCallback;
-				Shared::ConsoleVariableFunctions[head++] = &UnrealCLRFramework::ConsoleVariable::ClearOnChangedCallback;
-			}
+	if (IsInGameThread()) {
+		GEngine->AddOnScreenDebugMessage((uint64)-1, 10.0f, Color, message);
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::ActorFunctions;
-
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::IsPendingKill;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::IsRootComponentMovable;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::IsOverlappingActor;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::Spawn;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::Destroy;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::Rename;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::Hide;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::TeleportTo;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::GetComponent;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::GetRootComponent;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::GetInputComponent;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::GetBlockInput;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::GetDistanceTo;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::GetBounds;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::SetRootComponent;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::SetInputComponent;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::SetBlockInput;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::SetLifeSpan;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::SetEnableCollision;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::AddTag;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::RemoveTag;
-				Shared::ActorFunctions[head++] = &UnrealCLRFramework::Actor::HasTag;
-			}
+		return;
+	}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::PawnFunctions;
+	AsyncTask(ENamedThreads::GameThread, [Color, message]() {
+		if (GEngine)
+			GEngine->AddOnScreenDebugMessage((uint64)-1, 10.0f, Color, message);
+	});
+}
 
-				Shared::PawnFunctions[head++] = &UnrealCLRFramework::Pawn::AddControllerYawInput;
-				Shared::PawnFunctions[head++] = &UnrealCLRFramework::Pawn::AddControllerPitchInput;
-				Shared::PawnFunctions[head++] = &UnrealCLRFramework::Pawn::AddControllerRollInput;
-				Shared::PawnFunctions[head++] = &UnrealCLRFramework::Pawn::AddMovementInput;
-				Shared::PawnFunctions[head++] = &UnrealCLRFramework::Pawn::GetGravityDirection;
-			}
+void UnrealCLR::ActorIndex::Build() {
+	if (Built || !UnrealCLR::Engine::World)
+		return;
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::ControllerFunctions;
-
-				Shared::ControllerFunctions[head++] = &UnrealCLRFramework::Controller::IsLookInputIgnored;
-				Shared::ControllerFunctions[head++] = &UnrealCLRFramework::Controller::IsMoveInputIgnored;
-				Shared::ControllerFunctions[head++] = &UnrealCLRFramework::Controller::IsPlayerController;
-				Shared::ControllerFunctions[head++] = &UnrealCLRFramework::Controller::GetPawn;
-				Shared::ControllerFunctions[head++] = &UnrealCLRFramework::Controller::LineOfSightTo;
-				Shared::ControllerFunctions[head++] = &UnrealCLRFramework::Controller::SetInitialLocationAndRotation;
-				Shared::ControllerFunctions[head++] = &UnrealCLRFramework::Controller::SetIgnoreLookInput;
-				Shared::ControllerFunctions[head++] = &UnrealCLRFramework::Controller::SetIgnoreMoveInput;
-				Shared::ControllerFunctions[head++] = &UnrealCLRFramework::Controller::ResetIgnoreLookInput;
-				Shared::ControllerFunctions[head++] = &UnrealCLRFramework::Controller::ResetIgnoreMoveInput;
-			}
+	Built = true;
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::AIControllerFunctions;
-
-				Shared::AIControllerFunctions[head++] = &UnrealCLRFramework::AIController::ClearFocus;
-				Shared::AIControllerFunctions[head++] = &UnrealCLRFramework::AIController::GetFocalPoint;
-				Shared::AIControllerFunctions[head++] = &UnrealCLRFramework::AIController::SetFocalPoint;
-				Shared::AIControllerFunctions[head++] = &UnrealCLRFramework::AIController::GetFocusActor;
-				Shared::AIControllerFunctions[head++] = &UnrealCLRFramework::AIController::GetAllowStrafe;
-				Shared::AIControllerFunctions[head++] = &UnrealCLRFramework::AIController::SetAllowStrafe;
-				Shared::AIControllerFunctions[head++] = &UnrealCLRFramework::AIController::SetFocus;
-			}
+	// Each actor is visited once, so the uniqueness checks are skipped
+	for (TActorIterator<AActor> currentActor(UnrealCLR::Engine::World); currentActor; ++currentActor) {
+		Add(*currentActor, false);
+	}
+}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::PlayerControllerFunctions;
-
-				Shared::PlayerControllerFunctions[head++] = &UnrealCLRFramework::PlayerController::IsPaused;
-				Shared::PlayerControllerFunctions[head++] = &UnrealCLRFramework::PlayerController::GetShowMouseCursor;
-				Shared::PlayerControllerFunctions[head++] = &UnrealCLRFramework::PlayerController::GetMousePosition;
-				Shared::PlayerControllerFunctions[head++] = &UnrealCLRFramework::PlayerController::GetPlayerViewPoint;
-				Shared::PlayerControllerFunctions[head++] = &UnrealCLRFramework::PlayerController::GetPlayerInput;
-				Shared::PlayerControllerFunctions[head++] = &UnrealCLRFramework::PlayerController::SetShowMouseCursor;
-				Shared::PlayerControllerFunctions[head++] = &UnrealCLRFramework::PlayerController::SetMousePosition;
-				Shared::PlayerControllerFunctions[head++] = &UnrealCLRFramework::PlayerController::ConsoleCommand;
-				Shared::PlayerControllerFunctions[head++] = &UnrealCLRFramework::PlayerController::SetPause;
-				Shared::PlayerControllerFunctions[head++] = &UnrealCLRFramework::PlayerController::SetViewTarget;
-				Shared::PlayerControllerFunctions[head++] = &UnrealCLRFramework::PlayerController::SetViewTargetWithBlend;
-				Shared::PlayerControllerFunctions[head++] = &UnrealCLRFramework::PlayerController::AddYawInput;
-				Shared::PlayerControllerFunctions[head++] = &UnrealCLRFramework::PlayerController::AddPitchInput;
-				Shared::PlayerControllerFunctions[head++] = &UnrealCLRFramework::PlayerController::AddRollInput;
-			}
+void UnrealCLR::ActorIndex::Clear() {
+	Built = false;
+	Names.Empty();
+	Tags.Empty();
+}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::VolumeFunctions;
+void UnrealCLR::ActorIndex::Add(AActor* Actor, bool Unique) {
+	if (!Built || !Actor)
+		return;
 
-				Shared::VolumeFunctions[head++] = &UnrealCLRFramework::Volume::EncompassesPoint;
-			}
+	UClass* type = Actor->GetClass();
+	TArray<TWeakObjectPtr<AActor>>& actors = Names.FindOrAdd(Actor->GetFName()).FindOrAdd(type);
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::SoundBaseFunctions;
+	if (Unique)
+		actors.AddUnique(Actor);
+	else
+		actors.Add(Actor);
 
-				Shared::SoundBaseFunctions[head++] = &UnrealCLRFramework::SoundBase::GetDuration;
-			}
+	for (const FName& tag : Actor->Tags) {
+		TArray<TWeakObjectPtr<AActor>>& taggedActors = Tags.FindOrAdd(tag).FindOrAdd(type);
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::SoundWaveFunctions;
+		if (Unique)
+			taggedActors.AddUnique(Actor);
+		else
+			taggedActors.Add(Actor);
+	}
+}
 
-				Shared::SoundWaveFunctions[head++] = &UnrealCLRFramework::SoundWave::GetLoop;
-				Shared::SoundWaveFunctions[head++] = &UnrealCLRFramework::SoundWave::SetLoop;
-			}
+void UnrealCLR::ActorIndex::Remove(AActor* Actor) {
+	if (!Built || !Actor)
+		return;
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::AnimationInstanceFunctions;
+	UClass* type = Actor->GetClass();
 
-				Shared::AnimationInstanceFunctions[head++] = &UnrealCLRFramework::AnimationInstance::GetCurrentActiveMontage;
-				Shared::AnimationInstanceFunctions[head++] = &UnrealCLRFramework::AnimationInstance::MontagePlay;
-				Shared::AnimationInstanceFunctions[head++] = &UnrealCLRFramework::AnimationInstance::MontagePause;
-				Shared::AnimationInstanceFunctions[head++] = &UnrealCLRFramework::AnimationInstance::MontageResume;
-			}
+	if (Classes* buckets = Names.Find(Actor->GetFName())) {
+		if (TArray<TWeakObjectPtr<AActor>>* actors = buckets->Find(type))
+			actors->RemoveSingleSwap(Actor);
+	}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::PlayerInputFunctions;
+	for (const FName& tag : Actor->Tags) {
+		if (Classes* buckets = Tags.Find(tag)) {
+			if (TArray<TWeakObjectPtr<AActor>>* actors = buckets->Find(type))
+				actors->RemoveSingleSwap(Actor);
+		}
+	}
+}
 
-				Shared::PlayerInputFunctions[head++] = &UnrealCLRFramework::PlayerInput::IsKeyPressed;
-				Shared::PlayerInputFunctions[head++] = &UnrealCLRFramework::PlayerInput::GetTimeKeyPressed;
-				Shared::PlayerInputFunctions[head++] = &UnrealCLRFramework::PlayerInput::GetMouseSensitivity;
-				Shared::PlayerInputFunctions[head++] = &UnrealCLRFramework::PlayerInput::SetMouseSensitivity;
-			}
+// Stale entries are dropped before the class of a bucket is tested, a bucket without live actors is removed since its class might be unloaded
+AActor* UnrealCLR::ActorIndex::Find(Classes& Buckets, const FName& Key, bool Tag, UClass* Type) {
+	for (auto bucket = Buckets.CreateIterator(); bucket; ++bucket) {
+		TArray<TWeakObjectPtr<AActor>>& actors = bucket.Value();
+		AActor* actor = nullptr;
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::Texture2DFunctions;
+		while (actors.Num() > 0) {
+			actor = actors.Last().Get();
 
-				Shared::Texture2DFunctions[head++] = &UnrealCLRFramework::Texture2D::GetSize;
-			}
+			if (actor && !actor->IsPendingKillPending() && (Tag ? actor->ActorHasTag(Key) : actor->GetFName() == Key))
+				break;
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::ActorComponentFunctions;
+			actors.Pop(false);
+			actor = nullptr;
+		}
 
-				Shared::ActorComponentFunctions[head++] = &UnrealCLRFramework::ActorComponent::IsOwnerSelected;
-				Shared::ActorComponentFunctions[head++] = &UnrealCLRFramework::ActorComponent::GetOwner;
-				Shared::ActorComponentFunctions[head++] = &UnrealCLRFramework::ActorComponent::Destroy;
-				Shared::ActorComponentFunctions[head++] = &UnrealCLRFramework::ActorComponent::AddTag;
-				Shared::ActorComponentFunctions[head++] = &UnrealCLRFramework::ActorComponent::RemoveTag;
-				Shared::ActorComponentFunctions[head++] = &UnrealCLRFramework::ActorComponent::HasTag;
-			}
+		if (!actor) {
+			bucket.RemoveCurrent();
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::InputComponentFunctions;
-
-				Shared::InputComponentFunctions[head++] = &UnrealCLRFramework::InputComponent::HasBindings;
-				Shared::InputComponentFunctions[head++] = &UnrealCLRFramework::InputComponent::GetActionBindingsNumber;
-				Shared::InputComponentFunctions[head++] = &UnrealCLRFramework::InputComponent::ClearActionBindings;
-				Shared::InputComponentFunctions[head++] = &UnrealCLRFramework::InputComponent::BindAction;
-				Shared::InputComponentFunctions[head++] = &UnrealCLRFramework::InputComponent::BindAxis;
-				Shared::InputComponentFunctions[head++] = &UnrealCLRFramework::InputComponent::RemoveActionBinding;
-				Shared::InputComponentFunctions[head++] = &UnrealCLRFramework::InputComponent::GetBlockInput;
-				Shared::InputComponentFunctions[head++] = &UnrealCLRFramework::InputComponent::SetBlockInput;
-				Shared::InputComponentFunctions[head++] = &UnrealCLRFramework::InputComponent::GetPriority;
-				Shared::InputComponentFunctions[head++] = &UnrealCLRFramework::InputComponent::SetPriority;
-			}
+			continue;
+		}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::SceneComponentFunctions;
-
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::IsAttachedToComponent;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::IsAttachedToActor;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::Create;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::AttachToComponent;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::UpdateToWorld;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::AddLocalOffset;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::AddLocalRotation;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::AddRelativeLocation;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::AddRelativeRotation;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::AddLocalTransform;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::AddWorldOffset;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::AddWorldRotation;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::AddWorldTransform;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::GetComponentVelocity;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::GetComponentLocation;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::GetComponentRotation;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::GetComponentScale;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::GetComponentTransform;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::GetForwardVector;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::GetRightVector;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::GetUpVector;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::SetMobility;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::SetRelativeLocation;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::SetRelativeRotation;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::SetRelativeTransform;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::SetWorldLocation;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::SetWorldRotation;
-				Shared::SceneComponentFunctions[head++] = &UnrealCLRFramework::SceneComponent::SetWorldTransform;
-			}
+		if (bucket.Key()->IsChildOf(Type))
+			return actor;
+	}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::AudioComponentFunctions;
+	return nullptr;
+}
 
-				Shared::AudioComponentFunctions[head++] = &UnrealCLRFramework::AudioComponent::GetPaused;
-				Shared::AudioComponentFunctions[head++] = &UnrealCLRFramework::AudioComponent::SetSound;
-				Shared::AudioComponentFunctions[head++] = &UnrealCLRFramework::AudioComponent::SetPaused;
-				Shared::AudioComponentFunctions[head++] = &UnrealCLRFramework::AudioComponent::Play;
-				Shared::AudioComponentFunctions[head++] = &UnrealCLRFramework::AudioComponent::Stop;
-			}
+AActor* UnrealCLR::ActorIndex::FindByName(const FName& Name, UClass* Type) {
+	Build();
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::CameraComponentFunctions;
-
-				Shared::CameraComponentFunctions[head++] = &UnrealCLRFramework::CameraComponent::GetConstrainAspectRatio;
-				Shared::CameraComponentFunctions[head++] = &UnrealCLRFramework::CameraComponent::GetAspectRatio;
-				Shared::CameraComponentFunctions[head++] = &UnrealCLRFramework::CameraComponent::GetFieldOfView;
-				Shared::CameraComponentFunctions[head++] = &UnrealCLRFramework::CameraComponent::GetOrthoFarClipPlane;
-				Shared::CameraComponentFunctions[head++] = &UnrealCLRFramework::CameraComponent::GetOrthoNearClipPlane;
-				Shared::CameraComponentFunctions[head++] = &UnrealCLRFramework::CameraComponent::GetOrthoWidth;
-				Shared::CameraComponentFunctions[head++] = &UnrealCLRFramework::CameraComponent::GetLockToHeadMountedDisplay;
-				Shared::CameraComponentFunctions[head++] = &UnrealCLRFramework::CameraComponent::SetProjectionMode;
-				Shared::CameraComponentFunctions[head++] = &UnrealCLRFramework::CameraComponent::SetConstrainAspectRatio;
-				Shared::CameraComponentFunctions[head++] = &UnrealCLRFramework::CameraComponent::SetAspectRatio;
-				Shared::CameraComponentFunctions[head++] = &UnrealCLRFramework::CameraComponent::SetFieldOfView;
-				Shared::CameraComponentFunctions[head++] = &UnrealCLRFramework::CameraComponent::SetOrthoFarClipPlane;
-				Shared::CameraComponentFunctions[head++] = &UnrealCLRFramework::CameraComponent::SetOrthoNearClipPlane;
-				Shared::CameraComponentFunctions[head++] = &UnrealCLRFramework::CameraComponent::SetOrthoWidth;
-				Shared::CameraComponentFunctions[head++] = &UnrealCLRFramework::CameraComponent::SetLockToHeadMountedDisplay;
-			}
+	if (Classes* buckets = Names.Find(Name))
+		return Find(*buckets, Name, false, Type);
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::PrimitiveComponentFunctions;
-
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::IsGravityEnabled;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::AddAngularImpulseInDegrees;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::AddAngularImpulseInRadians;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::AddForce;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::AddForceAtLocation;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::AddImpulse;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::AddImpulseAtLocation;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::AddRadialForce;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::AddRadialImpulse;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::AddTorqueInDegrees;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::AddTorqueInRadians;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::GetMass;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::GetCastShadow;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::GetOnlyOwnerSee;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::GetOwnerNoSee;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::GetMaterial;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::GetMaterialsNumber;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::GetDistanceToCollision;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::GetSquaredDistanceToCollision;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::GetAngularDamping;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::GetLinearDamping;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::SetMass;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::SetCastShadow;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::SetOnlyOwnerSee;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::SetOwnerNoSee;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::SetMaterial;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::SetSimulatePhysics;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::SetAngularDamping;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::SetLinearDamping;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::SetEnableGravity;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::SetCollisionMode;
-				Shared::PrimitiveComponentFunctions[head++] = &UnrealCLRFramework::PrimitiveComponent::CreateAndSetMaterialInstanceDynamic;
-			}
+	return nullptr;
+}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::ShapeComponentFunctions;
+AActor* UnrealCLR::ActorIndex::FindByTag(const FName& Tag, UClass* Type) {
+	Build();
 
-				Shared::ShapeComponentFunctions[head++] = &UnrealCLRFramework::ShapeComponent::GetDynamicObstacle;
-				Shared::ShapeComponentFunctions[head++] = &UnrealCLRFramework::ShapeComponent::GetShapeColor;
-				Shared::ShapeComponentFunctions[head++] = &UnrealCLRFramework::ShapeComponent::SetDynamicObstacle;
-				Shared::ShapeComponentFunctions[head++] = &UnrealCLRFramework::ShapeComponent::SetShapeColor;
-			}
+	if (Classes* buckets = Tags.Find(Tag))
+		return Find(*buckets, Tag, true, Type);
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::BoxComponentFunctions;
+	return nullptr;
+}
 
-				Shared::BoxComponentFunctions[head++] = &UnrealCLRFramework::BoxComponent::GetScaledBoxExtent;
-				Shared::BoxComponentFunctions[head++] = &UnrealCLRFramework::BoxComponent::GetUnscaledBoxExtent;
-				Shared::BoxComponentFunctions[head++] = &UnrealCLRFramework::BoxComponent::SetBoxExtent;
-				Shared::BoxComponentFunctions[head++] = &UnrealCLRFramework::BoxComponent::InitBoxExtent;
-			}
+UnrealCLR::ComponentIndex::Entry& UnrealCLR::ComponentIndex::Get(AActor* Actor, bool* Rebuilt) {
+	Entry& entry = Entries.FindOrAdd(Actor);
+	const TSet<UActorComponent*>& components = Actor->GetComponents();
+	const int32 generation = Generation.GetValue();
+	const bool rebuild = !entry.Valid || entry.Count != components.Num() || entry.Generation != generation;
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::SphereComponentFunctions;
+	if (Rebuilt)
+		*Rebuilt = rebuild;
 
-				Shared::SphereComponentFunctions[head++] = &UnrealCLRFramework::SphereComponent::GetScaledSphereRadius;
-				Shared::SphereComponentFunctions[head++] = &UnrealCLRFramework::SphereComponent::GetUnscaledSphereRadius;
-				Shared::SphereComponentFunctions[head++] = &UnrealCLRFramework::SphereComponent::GetShapeScale;
-				Shared::SphereComponentFunctions[head++] = &UnrealCLRFramework::SphereComponent::SetSphereRadius;
-				Shared::SphereComponentFunctions[head++] = &UnrealCLRFramework::SphereComponent::InitSphereRadius;
-			}
+	if (rebuild) {
+		entry.Components.Reset();
+		entry.Names.Reset();
+		entry.Types.Reset();
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::CapsuleComponentFunctions;
-
-				Shared::CapsuleComponentFunctions[head++] = &UnrealCLRFramework::CapsuleComponent::GetScaledCapsuleRadius;
-				Shared::CapsuleComponentFunctions[head++] = &UnrealCLRFramework::CapsuleComponent::GetUnscaledCapsuleRadius;
-				Shared::CapsuleComponentFunctions[head++] = &UnrealCLRFramework::CapsuleComponent::GetShapeScale;
-				Shared::CapsuleComponentFunctions[head++] = &UnrealCLRFramework::CapsuleComponent::GetScaledCapsuleSize;
-				Shared::CapsuleComponentFunctions[head++] = &UnrealCLRFramework::CapsuleComponent::GetUnscaledCapsuleSize;
-				Shared::CapsuleComponentFunctions[head++] = &UnrealCLRFramework::CapsuleComponent::SetCapsuleRadius;
-				Shared::CapsuleComponentFunctions[head++] = &UnrealCLRFramework::CapsuleComponent::SetCapsuleSize;
-				Shared::CapsuleComponentFunctions[head++] = &UnrealCLRFramework::CapsuleComponent::InitCapsuleSize;
+		for (UActorComponent* component : components) {
+			if (component && !component->IsPendingKill()) {
+				entry.Names.Add(component->GetFName(), entry.Components.Num());
+				entry.Components.Add(component);
 			}
+		}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::MeshComponentFunctions;
+		entry.Valid = true;
+		entry.Count = components.Num();
+		entry.Generation = generation;
+	}
 
-				Shared::MeshComponentFunctions[head++] = &UnrealCLRFramework::MeshComponent::GetMaterialIndex;
-			}
+	return entry;
+}
+
+UActorComponent* UnrealCLR::ComponentIndex::Find(AActor* Actor, const FName& Name, UClass* Type) {
+	if (Name != NAME_None) {
+		// A cached component which is destroyed or renamed is a miss, as well as a name which is not cached, the entry is rebuilt once unless it's just rebuilt since a component might be renamed or re-created under the same name
+		for (int32 attempt = 0; attempt < 2; attempt++) {
+			bool rebuilt = false;
+			Entry& entry = Get(Actor, &rebuilt);
+			const int32* index = entry.Names.Find(Name);
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::LightComponentBaseFunctions;
+			if (index) {
+				UActorComponent* component = entry.Components[*index].Get();
 
-				Shared::LightComponentBaseFunctions[head++] = &UnrealCLRFramework::LightComponentBase::GetIntensity;
-				Shared::LightComponentBaseFunctions[head++] = &UnrealCLRFramework::LightComponentBase::GetCastShadows;
-				Shared::LightComponentBaseFunctions[head++] = &UnrealCLRFramework::LightComponentBase::SetCastShadows;
+				if (component && !component->IsPendingKill() && component->GetFName() == Name)
+					return component->IsA(Type) ? component : nullptr;
+			} else if (rebuilt) {
+				return nullptr;
 			}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::LightComponentFunctions;
+			Invalidate(Actor);
+		}
 
-				Shared::LightComponentFunctions[head++] = &UnrealCLRFramework::LightComponent::SetIntensity;
-			}
+		return nullptr;
+	}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::MotionControllerComponentFunctions;
+	UActorComponent* components[1];
 
-				Shared::MotionControllerComponentFunctions[head++] = &UnrealCLRFramework::MotionControllerComponent::IsTracked;
-			}
+	return FindAll(Actor, Type, components, 1) > 0 ? components[0] : nullptr;
+}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::StaticMeshComponentFunctions;
+int32 UnrealCLR::ComponentIndex::FindAll(AActor* Actor, UClass* Type, UActorComponent** Components, int32 Capacity) {
+	Entry& entry = Get(Actor);
+	TArray<int32>* indices = entry.Types.Find(Type);
 
-				Shared::StaticMeshComponentFunctions[head++] = &UnrealCLRFramework::StaticMeshComponent::GetLocalBounds;
-				Shared::StaticMeshComponentFunctions[head++] = &UnrealCLRFramework::StaticMeshComponent::GetStaticMesh;
-				Shared::StaticMeshComponentFunctions[head++] = &UnrealCLRFramework::StaticMeshComponent::SetStaticMesh;
-			}
+	if (!indices) {
+		indices = &entry.Types.Add(Type);
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::InstancedStaticMeshComponentFunctions;
+		for (int32 i = 0; i < entry.Components.Num(); i++) {
+			UActorComponent* component = entry.Components[i].Get();
 
-				Shared::InstancedStaticMeshComponentFunctions[head++] = &UnrealCLRFramework::InstancedStaticMeshComponent::GetInstanceCount;
-				Shared::InstancedStaticMeshComponentFunctions[head++] = &UnrealCLRFramework::InstancedStaticMeshComponent::AddInstance;
-				Shared::InstancedStaticMeshComponentFunctions[head++] = &UnrealCLRFramework::InstancedStaticMeshComponent::UpdateInstanceTransform;
-				Shared::InstancedStaticMeshComponentFunctions[head++] = &UnrealCLRFramework::InstancedStaticMeshComponent::ClearInstances;
-			}
+			if (component && component->IsA(Type))
+				indices->Add(i);
+		}
+	}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::SkinnedMeshComponentFunctions;
+	for (int32 i = 0; i < indices->Num(); i++) {
+		UActorComponent* component = entry.Components[(*indices)[i]].Get();
 
-				Shared::SkinnedMeshComponentFunctions[head++] = &UnrealCLRFramework::SkinnedMeshComponent::SetSkeletalMesh;
-			}
+		if (!component || component->IsPendingKill()) {
+			Invalidate(Actor);
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::SkeletalMeshComponentFunctions;
-
-				Shared::SkeletalMeshComponentFunctions[head++] = &UnrealCLRFramework::SkeletalMeshComponent::GetAnimationInstance;
-				Shared::SkeletalMeshComponentFunctions[head++] = &UnrealCLRFramework::SkeletalMeshComponent::SetAnimation;
-				Shared::SkeletalMeshComponentFunctions[head++] = &UnrealCLRFramework::SkeletalMeshComponent::SetAnimationMode;
-				Shared::SkeletalMeshComponentFunctions[head++] = &UnrealCLRFramework::SkeletalMeshComponent::SetAnimationBlueprint;
-				Shared::SkeletalMeshComponentFunctions[head++] = &UnrealCLRFramework::SkeletalMeshComponent::Play;
-				Shared::SkeletalMeshComponentFunctions[head++] = &UnrealCLRFramework::SkeletalMeshComponent::PlayAnimation;
-				Shared::SkeletalMeshComponentFunctions[head++] = &UnrealCLRFramework::SkeletalMeshComponent::Stop;
-			}
+			return FindAll(Actor, Type, Components, Capacity);
+		}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::MaterialInterfaceFunctions;
+		if (i < Capacity)
+			Components[i] = component;
+	}
 
-				Shared::MaterialInterfaceFunctions[head++] = &UnrealCLRFramework::MaterialInterface::IsTwoSided;
-			}
+	return indices->Num();
+}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::MaterialFunctions;
+void UnrealCLR::ComponentIndex::Invalidate(AActor* Actor) {
+	if (Entry* entry = Entries.Find(Actor))
+		entry->Valid = false;
+}
 
-				Shared::MaterialFunctions[head++] = &UnrealCLRFramework::Material::IsDefaultMaterial;
-			}
+void UnrealCLR::ComponentIndex::Remove(AActor* Actor) {
+	Entries.Remove(Actor);
+}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::MaterialInstanceFunctions;
+void UnrealCLR::ComponentIndex::Start() {
+	if (Listening)
+		return;
 
-				Shared::MaterialInstanceFunctions[head++] = &UnrealCLRFramework::MaterialInstance::IsChildOf;
-			}
+	GUObjectArray.AddUObjectCreateListener(&ObjectListener);
+	GUObjectArray.AddUObjectDeleteListener(&ObjectListener);
+	Listening = true;
+}
 
-			{
-				int32 head = 0;
-				Shared::Functions[position++] = Shared::MaterialInstanceDynamicFunctions;
+void UnrealCLR::ComponentIndex::Stop() {
+	if (!Listening)
+		return;
 
-				Shared::MaterialInstanceDynamicFunctions[head++] = &UnrealCLRFramework::MaterialInstanceDynamic::ClearParameterValues;
-				Shared::MaterialInstanceDynamicFunctions[head++] = &UnrealCLRFramework::MaterialInstanceDynamic::SetTextureParameterValue;
-				Shared::MaterialInstanceDynamicFunctions[head++] = &UnrealCLRFramework::MaterialInstanceDynamic::SetVectorParameterValue;
-				Shared::MaterialInstanceDynamicFunctions[head++] = &UnrealCLRFramework::MaterialInstanceDynamic::SetScalarParameterValue;
-			}
+	GUObjectArray.RemoveUObjectCreateListener(&ObjectListener);
+	GUObjectArray.RemoveUObjectDeleteListener(&ObjectListener);
+	Listening = false;
+}
 
-			// Runtime pointers
+void UnrealCLR::ComponentIndex::Clear() {
+	Stop();
+	Entries.Empty();
+}
 
-			Shared::ManagedFunctions[0] = &UnrealCLR::Module::Invoke;
-			Shared::ManagedFunctions[1] = &UnrealCLR::Module::Exception;
-			Shared::ManagedFunctions[2] = &UnrealCLR::Module::Log;
+void UnrealCLR::ComponentIndex::Listener::NotifyUObjectCreated(const UObjectBase* Object, int32 Index) {
+	const UObject* object = static_cast<const UObject*>(Object);
 
-			void* Functions[3] = {
-				Shared::ManagedFunctions,
-				Shared::NativeFunctions,
-				Shared::Functions
-			};
+	if (!object->IsA<UActorComponent>())
+		return;
 
-			if (Initialize(Functions) == 0xF) {
-				UnrealCLR::ExecuteAssemblyFunction = (UnrealCLR::ExecuteAssemblyFunctionDelegate)Shared::NativeFunctions[0];
-				UnrealCLR::LoadAssemblyFunction = (UnrealCLR::LoadAssemblyFunctionDelegate)Shared::NativeFunctions[1];
-				UnrealCLR::UnloadAssemblies = (UnrealCLR::UnloadAssembliesDelegate)Shared::NativeFunctions[2];
+	if (!IsInGameThread()) {
+		Generation.Increment();
 
-				UE_LOG(LogUnrealCLR, Display, TEXT("%s: Host runtime assembly initialized succesfuly!"), ANSI_TO_TCHAR(__FUNCTION__));
-			} else {
-				UE_LOG(LogUnrealCLR, Error, TEXT("%s: Host runtime assembly initialization failed!"), ANSI_TO_TCHAR(__FUNCTION__));
+		return;
+	}
 
-				return;
-			}
+	if (AActor* actor = Cast<AActor>(object->GetOuter()))
+		Invalidate(actor);
+}
 
-			IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+// The object might be partially destroyed, so its class and outer are not accessed
+void UnrealCLR::ComponentIndex::Listener::NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) {
+	Generation.Increment();
+}
 
-			if (!platformFile.DirectoryExists(*UnrealCLR::UserAssembliesPath)) {
-				platformFile.CreateDirectory(*UnrealCLR::UserAssembliesPath);
+void UnrealCLR::ComponentIndex::Listener::OnUObjectArrayShutdown() {
+	Stop();
+}
 
-				if (!platformFile.DirectoryExists(*UnrealCLR::UserAssembliesPath))
-					UE_LOG(LogUnrealCLR, Error, TEXT("%s: Unable to create a folder for managed assemblies at %s."), ANSI_TO_TCHAR(__FUNCTION__), *UnrealCLR::UserAssembliesPath);
-			}
+UClass* UnrealCLR::AssetLoader::GetClass(UnrealCLRFramework::ObjectType Type) {
+	switch (Type) {
+		case UnrealCLRFramework::ObjectType::Blueprint:
+			#if WITH_EDITOR
+				return UBlueprint::StaticClass();
+			#else
+				return UClass::StaticClass();
+			#endif
 
-			UnrealCLR::Status = UnrealCLR::StatusType::Idle;
+		case UnrealCLRFramework::ObjectType::SoundWave:
+			return USoundWave::StaticClass();
 
-			UE_LOG(LogUnrealCLR, Display, TEXT("%s: Host loaded succesfuly!"), ANSI_TO_TCHAR(__FUNCTION__));
-		} else {
-			UE_LOG(LogUnrealCLR, Error, TEXT("%s: Host runtime assembly unable to load the initialization function!"), ANSI_TO_TCHAR(__FUNCTION__));
+		case UnrealCLRFramework::ObjectType::AnimationSequence:
+			return UAnimSequence::StaticClass();
 
-			return;
-		}
-	} else {
-		UE_LOG(LogUnrealCLR, Error, TEXT("%s: Host loading failed!"), ANSI_TO_TCHAR(__FUNCTION__));
+		case UnrealCLRFramework::ObjectType::AnimationMontage:
+			return UAnimMontage::StaticClass();
+
+		case UnrealCLRFramework::ObjectType::StaticMesh:
+			return UStaticMesh::StaticClass();
+
+		case UnrealCLRFramework::ObjectType::SkeletalMesh:
+			return USkeletalMesh::StaticClass();
+
+		case UnrealCLRFramework::ObjectType::Material:
+			return UMaterial::StaticClass();
+
+		case UnrealCLRFramework::ObjectType::Texture2D:
+			return UTexture2D::StaticClass();
+
+		default:
+			return nullptr;
 	}
 }
 
-void UnrealCLR::Module::ShutdownModule() {
-	FWorldDelegates::OnPreWorldInitialization.Remove(OnPreWorldInitializationHandle);
-	FWorldDelegates::OnWorldCleanup.Remove(OnWorldCleanupHandle);
+FSoftObjectPath UnrealCLR::AssetLoader::GetPath(UnrealCLRFramework::ObjectType Type, const char* Name) {
+	FString name(UTF8_TO_TCHAR(Name));
+	int32 index = INDEX_NONE;
 
-	FPlatformProcess::FreeDllHandle(HostfxrLibrary);
-}
+	if (!name.Contains(TEXT(".")) && name.FindLastChar(TCHAR('/'), index)) {
+		name.AppendChar(TCHAR('.'));
+		name.Append(name.Mid(index + 1, name.Len() - index - 2));
+	}
 
-void UnrealCLR::Module::OnPreWorldInitialization(UWorld* World, const UWorld::InitializationValues InitializationValues) {
-	if (World->IsGameWorld() && !UnrealCLR::Engine::World) {
-		UnrealCLR::Engine::World = World;
+	#if !WITH_EDITOR
+		if (Type == UnrealCLRFramework::ObjectType::Blueprint)
+			name.Append(TEXT("_C"));
+	#endif
 
-		if (UnrealCLR::Status != UnrealCLR::StatusType::Stopped) {
-			UnrealCLR::Status = UnrealCLR::StatusType::Running;
-		} else {
-			#if WITH_EDITOR
-				FNotificationInfo notificationInfo(FText::FromString(TEXT("UnrealCLR host is not initialized! Please, check logs and try to restart the engine.")));
+	return FSoftObjectPath(name);
+}
 
-				notificationInfo.ExpireDuration = 5.0f;
+void UnrealCLR::AssetLoader::Start(int32 Id, UnrealCLRFramework::ObjectType Type, const char** Names, int32 Count, UnrealCLRFramework::LoadAsyncDelegate Function) {
+	Request& request = Requests.Add(Id);
 
-				FSlateNotificationManager::Get().AddNotification(notificationInfo);
-			#endif
-		}
+	request.Type = Type;
+	request.Function = Function;
+	request.Paths.Reserve(Count);
+
+	for (int32 i = 0; i < Count; i++) {
+		request.Paths.Add(GetPath(Type, Names[i]));
 	}
+
+	if (!Manager)
+		Manager = MakeUnique<FStreamableManager>();
+
+	TSharedPtr<FStreamableHandle> handle = Manager->RequestAsyncLoad(request.Paths, FStreamableDelegate::CreateLambda([Id]() {
+		UnrealCLR::AssetLoader::Complete(Id);
+	}));
+
+	if (Request* pending = Requests.Find(Id))
+		pending->Handle = handle;
 }
 
-void UnrealCLR::Module::OnWorldCleanup(UWorld* World, bool SessionEnded, bool CleanupResources) {
-	if (World->IsGameWorld() && World->GetFullName() == UnrealCLR::Engine::World->GetFullName()) {
-		UnrealCLR::Engine::World = nullptr;
+void UnrealCLR::AssetLoader::Complete(int32 Id) {
+	Request request;
 
-		if (UnrealCLR::Status != UnrealCLR::StatusType::Stopped) {
-			UnrealCLR::UnloadAssemblies();
-			UnrealCLR::Status = UnrealCLR::StatusType::Idle;
-		}
+	if (!Requests.RemoveAndCopyValue(Id, request))
+		return;
+
+	UClass* type = GetClass(request.Type);
+	TArray<UObject*> objects;
+
+	objects.Reserve(request.Paths.Num());
+
+	for (const FSoftObjectPath& path : request.Paths) {
+		UObject* object = path.ResolveObject();
+
+		objects.Add(object && object->IsA(type) ? object : nullptr);
 	}
+
+	if (UnrealCLR::Status == UnrealCLR::StatusType::Running)
+		request.Function(Id, objects.GetData(), objects.Num());
 }
 
-void UnrealCLR::Module::HostError(const char_t* Message) {
-	UE_LOG(LogUnrealCLR, Error, TEXT("%s: %s"), ANSI_TO_TCHAR(__FUNCTION__), *FString(Message));
+void UnrealCLR::AssetLoader::Cancel(int32 Id) {
+	Request request;
+
+	if (Requests.RemoveAndCopyValue(Id, request) && request.Handle.IsValid())
+		request.Handle->CancelHandle();
 }
 
-void UnrealCLR::Module::Invoke(void(*ManagedFunction)()) {
-	ManagedFunction();
+void UnrealCLR::AssetLoader::Clear() {
+	TMap<int32, Request> requests = MoveTemp(Requests);
+
+	Requests.Reset();
+
+	for (auto& request : requests) {
+		if (request.Value.Handle.IsValid())
+			request.Value.Handle->CancelHandle();
+
+		if (UnrealCLR::Status == UnrealCLR::StatusType::Running)
+			request.Value.Function(request.Key, nullptr, -1);
+	}
+	Manager.Reset();
 }
 
-void UnrealCLR::Module::Exception(const char* Message) {
-	UE_LOG(LogUnrealCLR, Error, TEXT("%s: %s"), ANSI_TO_TCHAR(__FUNCTION__), *FString(ANSI_TO_TCHAR(Message)));
+bool UnrealCLR::TickFunctions::Contains(UnrealCLRFramework::ManagedTickFunction* TickFunction) {
+	for (const TUniquePtr<UnrealCLRFramework::ManagedTickFunction>& function : Functions) {
+		if (function.Get() == TickFunction)
+			return true;
+	}
 
-	GEngine->AddOnScreenDebugMessage((uint64)-1, 10.0f, FColor::Red, *FString(ANSI_TO_TCHAR(Message)));
+	return false;
 }
 
-void UnrealCLR::Module::Log(UnrealCLR::LogLevel Level, const char* Message) {
-	#define UNREALCLR_LOG(Verbosity) UE_LOG(LogUnrealCLR, Verbosity, TEXT("%s: %s"), ANSI_TO_TCHAR(__FUNCTION__), *FString(ANSI_TO_TCHAR(Message)));
+void UnrealCLR::TickFunctions::Remove(UnrealCLRFramework::ManagedTickFunction* TickFunction) {
+	const int32 index = Functions.IndexOfByPredicate([TickFunction](const TUniquePtr<UnrealCLRFramework::ManagedTickFunction>& Function) {
+		return Function.Get() == TickFunction;
+	});
 
-	if (Level == UnrealCLR::LogLevel::Display) {
-		UNREALCLR_LOG(Display);
-	} else if (Level == UnrealCLR::LogLevel::Warning) {
-		UNREALCLR_LOG(Warning);
+	if (index == INDEX_NONE)
+		return;
 
-		GEngine->AddOnScreenDebugMessage((uint64)-1, 10.0f, FColor::Yellow, *FString(ANSI_TO_TCHAR(Message)));
-	} else if (Level == UnrealCLR::LogLevel::Error) {
-		UNREALCLR_LOG(Error);
+	for (const TUniquePtr<UnrealCLRFramework::ManagedTickFunction>& function : Functions) {
+		function->RemovePrerequisite(UnrealCLR::Engine::World, *TickFunction);
+	}
+
+	TickFunction->UnRegisterTickFunction();
+
+	// The function may be unregistered from its own tick while the engine is still executing it, so it's released on the next frame
+	Removed.Add(MoveTemp(Functions[index]));
+	Functions.RemoveAtSwap(index);
+}
+
+void UnrealCLR::TickFunctions::Release() {
+	Removed.Empty();
+}
+
+void UnrealCLR::TickFunctions::Clear() {
+	for (const TUniquePtr<UnrealCLRFramework::ManagedTickFunction>& function : Functions) {
+		function->UnRegisterTickFunction();
+	}
+
+	Functions.Empty();
+	Removed.Empty();
+}
 
-		GEngine->AddOnScreenDebugMessage((uint64)-1, 10.0f, FColor::Red, *FString(ANSI_TO_TCHAR(Message)));
+void UnrealCLR::GameThread::Drain() {
+	if (UnrealCLR::Status != UnrealCLR::StatusType::Running)
+		return;
+
+	for (int32 i = 0; i < Dispatchers.Num(); i++) {
+		Dispatchers[i]();
 	}
 }
 
-size_t UnrealCLR::Utility::Strcpy(char* Destination, const char* Source, size_t Length) {
-	char* destination = Destination;
-	const char* source = Source;
-	size_t length = Length;
+void UnrealCLR::GameThread::Clear() {
+	Dispatchers.Empty();
+}
 
-	if (length != 0 && --length != 0) {
-		do {
-			if ((*destination++ = *source++) == 0)
-				break;
+void UnrealCLR::Logger::Drain() {
+	const int32 dropped = FPlatformAtomics::InterlockedExchange(&Buffer.Dropped, 0);
+
+	if (dropped > 0)
+		UE_LOG(LogUnrealManaged, Warning, TEXT("%s: %d messages were dropped since the log buffer was full"), ANSI_TO_TCHAR(__FUNCTION__), dropped);
+
+	int64 read = Buffer.Read;
+
+	while (read != FPlatformAtomics::AtomicRead(&Buffer.Write)) {
+		UnrealCLRFramework::LogEntry& entry = Entries[read & (Capacity - 1)];
+
+		// Entries are drained in the order of reservation, an entry which is still being written is left for the next frame
+		if (FPlatformAtomics::AtomicRead(&entry.Committed) == 0)
+			break;
+
+		const int32 offset = (read & (Capacity - 1)) * SlotSize;
+		const int32 length = entry.CategoryLength + entry.MessageLength;
+		const uint8* payload = Payload + offset;
+
+		if (offset + length > Capacity * SlotSize) {
+			const int32 tail = Capacity * SlotSize - offset;
+
+			Scratch.SetNumUninitialized(length, false);
+			FMemory::Memcpy(Scratch.GetData(), payload, tail);
+			FMemory::Memcpy(Scratch.GetData() + tail, Payload, length - tail);
+			payload = Scratch.GetData();
+		}
+
+		const FUTF8ToTCHAR category(reinterpret_cast<const ANSICHAR*>(payload), entry.CategoryLength);
+		const FUTF8ToTCHAR message(reinterpret_cast<const ANSICHAR*>(payload + entry.CategoryLength), entry.MessageLength);
+		const FString text = entry.CategoryLength > 0 ? FString(category.Length(), category.Get()) + TEXT(": ") + FString(message.Length(), message.Get()) : FString(message.Length(), message.Get());
+
+		#define UNREALCLR_LOGGER_LOG(Verbosity) UE_LOG(LogUnrealManaged, Verbosity, TEXT("[Frame %llu] %s"), entry.Frame, *text);
+
+		if (entry.Level == UnrealCLRFramework::LogLevel::Display) {
+			UNREALCLR_LOGGER_LOG(Display);
+		} else if (entry.Level == UnrealCLRFramework::LogLevel::Warning) {
+			UNREALCLR_LOGGER_LOG(Warning);
+		} else if (entry.Level == UnrealCLRFramework::LogLevel::Error) {
+			UNREALCLR_LOGGER_LOG(Error);
 		}
 
-		while (--length != 0);
+		#undef UNREALCLR_LOGGER_LOG
+
+		read += entry.Count;
+
+		FPlatformAtomics::AtomicStore(&entry.Committed, 0);
+		FPlatformAtomics::AtomicStore(&Buffer.Read, read);
+	}
+}
+
+void UnrealCLR::Statistics::Add(const FString& Table, const FString& Function, const UnrealCLRFramework::InteropCounter* Counter) {
+	const FString name = Table + TEXT("::") + Function;
+
+	// Each user assembly loads its own copy of the framework with its own counters, the calls of a function are summed across them
+	if (const int32* index = Functions.Find(name)) {
+		Entries[*index].Counters.Add(Counter);
+
+		return;
 	}
 
-	if (length == 0) {
-		if (Length != 0)
-			*destination = '\0';
+	int32 table = Tables.IndexOfByPredicate([&Table](const TableEntry& Entry) {
+		return Entry.Name == Table;
+	});
+
+	if (table == INDEX_NONE) {
+		table = Tables.AddDefaulted();
+		Tables[table].Name = Table;
 
-		while (*source++);
+		#if STATS
+			Tables[table].CallsStat = FDynamicStats::CreateStatIdInt64<FStatGroup_STATGROUP_UnrealCLRInterop>(Table + TEXT(" (calls)")).GetName();
+			Tables[table].TimeStat = FDynamicStats::CreateStatIdDouble<FStatGroup_STATGROUP_UnrealCLRInterop>(Table + TEXT(" (ms)")).GetName();
+		#endif
 	}
 
-	return (source - Source - 1);
+	Functions.Add(name, Entries.Num());
+
+	Entry& entry = Entries.AddDefaulted_GetRef();
+
+	entry.Counters.Add(Counter);
+	entry.Table = table;
+
+	#if STATS
+		entry.CallsStat = FDynamicStats::CreateStatIdInt64<FStatGroup_STATGROUP_UnrealCLRInterop>(name + TEXT(" (calls)")).GetName();
+		entry.TimeStat = FDynamicStats::CreateStatIdDouble<FStatGroup_STATGROUP_UnrealCLRInterop>(name + TEXT(" (ms)")).GetName();
+	#endif
+}
+
+void UnrealCLR::Statistics::Publish() {
+	#if STATS
+		if (Entries.Num() == 0)
+			return;
+
+		const bool collecting = FThreadStats::IsCollectingData();
+
+		for (TableEntry& table : Tables) {
+			table.Calls = 0;
+			table.Ticks = 0;
+		}
+
+		// Counters are cumulative on the managed side, the stats receive the difference since the previous frame
+		for (Entry& entry : Entries) {
+			int64 calls = 0;
+			int64 ticks = 0;
+
+			for (const UnrealCLRFramework::InteropCounter* counter : entry.Counters) {
+				calls += FPlatformAtomics::AtomicRead(&counter->Calls);
+				ticks += FPlatformAtomics::AtomicRead(&counter->Ticks);
+			}
+
+			const int64 frameCalls = calls - entry.Calls;
+			const int64 frameTicks = ticks - entry.Ticks;
+
+			entry.Calls = calls;
+			entry.Ticks = ticks;
+
+			if (!collecting || frameCalls == 0)
+				continue;
+
+			TableEntry& table = Tables[entry.Table];
+
+			table.Calls += frameCalls;
+			table.Ticks += frameTicks;
+
+			SET_DWORD_STAT_FName(entry.CallsStat, frameCalls);
+			SET_FLOAT_STAT_FName(entry.TimeStat, frameTicks * MillisecondsPerTick);
+		}
+
+		if (!collecting)
+			return;
+
+		for (const TableEntry& table : Tables) {
+			if (table.Calls == 0)
+				continue;
+
+			SET_DWORD_STAT_FName(table.CallsStat, table.Calls);
+			SET_FLOAT_STAT_FName(table.TimeStat, table.Ticks * MillisecondsPerTick);
+		}
+	#endif
+}
+
+void UnrealCLR::Statistics::Clear() {
+	Entries.Empty();
+	Tables.Empty();
+	Functions.Empty();
 }
 
-size_t UnrealCLR::Utility::Strlen(const char* Source) {
-	return strlen(Source) + 1;
+const char* UnrealCLR::Utility::Encode(const TCHAR* Source) {
+	FTCHARToUTF8 converter(Source);
+	const int32 length = converter.Length();
+
+	// The length in bytes precedes the null-terminated string, the buffer is reused by the next call on the game thread
+	StringBuffer.SetNumUninitialized(sizeof(int32) + length + 1, false);
+	FMemory::Memcpy(StringBuffer.GetData(), &length, sizeof(int32));
+	FMemory::Memcpy(StringBuffer.GetData() + sizeof(int32), converter.Get(), length);
+	StringBuffer[sizeof(int32) + length] = '\0';
+
+	return StringBuffer.GetData() + sizeof(int32);
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2020 Stanislav Denisov (nxrighthere@gmail.com)
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU Lesser General Public License
+ * (LGPL) version 3 with a static linking exception which accompanies this
+ * distribution.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ */
+
+#include "UnrealCLRConversion.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#define UNREALCLR_CONVERSION_SSE 1
+
+	#include <immintrin.h>
+#else
+	#define UNREALCLR_CONVERSION_SSE 0
+#endif
+
+namespace UnrealCLRConversion {
+	namespace Scalar {
+		static inline void VectorToEngine(const float* Source, float* Destination) {
+			const float x = Source[0];
+			const float y = Source[1];
+			const float z = Source[2];
+
+			Destination[0] = z;
+			Destination[1] = x;
+			Destination[2] = y;
+		}
+
+		void TransformsToEngine(const float* Source, float* Destination, int32_t Count) {
+			for (int32_t i = 0; i < Count; i++, Source += TransformFloats, Destination += EngineTransformFloats) {
+				VectorToEngine(Source + 3, Destination);
+				Destination[3] = Source[6];
+				VectorToEngine(Source, Destination + 4);
+				VectorToEngine(Source + 7, Destination + 8);
+				Destination[7] = 0.0f;
+				Destination[11] = 0.0f;
+			}
+		}
+
+		void TransformsFromEngine(const float* Source, float* Destination, int32_t Count) {
+			for (int32_t i = 0; i < Count; i++, Source += EngineTransformFloats, Destination += TransformFloats) {
+				TransformsFromEngine(&Source, Destination, 1);
+			}
+		}
+
+		void TransformsFromEngine(const float* const* Sources, float* Destination, int32_t Count) {
+			for (int32_t i = 0; i < Count; i++, Destination += TransformFloats) {
+				const float* source = Sources[i];
+
+				for (int32_t j = 0; j < 3; j++) {
+					Destination[j] = source[4 + j];
+					Destination[7 + j] = source[8 + j];
+				}
+
+				for (int32_t j = 0; j < 4; j++) {
+					Destination[3 + j] = source[j];
+				}
+			}
+		}
+	}
+
+	#if UNREALCLR_CONVERSION_SSE
+		namespace SSE {
+			// Rotates the first three lanes to the engine order, the fourth lane is preserved
+			#define UNREALCLR_SWIZZLE_TO_ENGINE _MM_SHUFFLE(3, 1, 0, 2)
+
+			static inline __m128 TranslationMask() {
+				return _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+			}
+
+			static void TransformsToEngine(const float* Source, float* Destination, int32_t Count) {
+				const __m128 mask = TranslationMask();
+
+				for (int32_t i = 0; i < Count; i++, Source += TransformFloats, Destination += EngineTransformFloats) {
+					const __m128 location = _mm_loadu_ps(Source);
+					const __m128 rotation = _mm_loadu_ps(Source + 3);
+					const __m128 scale = _mm_loadu_ps(Source + 6);
+
+					_mm_storeu_ps(Destination, _mm_shuffle_ps(rotation, rotation, UNREALCLR_SWIZZLE_TO_ENGINE));
+					_mm_storeu_ps(Destination + 4, _mm_and_ps(_mm_shuffle_ps(location, location, UNREALCLR_SWIZZLE_TO_ENGINE), mask));
+					_mm_storeu_ps(Destination + 8, _mm_and_ps(_mm_shuffle_ps(scale, scale, _MM_SHUFFLE(0, 2, 1, 3)), mask));
+				}
+			}
+
+			// The stores overlap by one lane, so the ten floats are written with three registers without touching the next transform
+			static inline void TransformFromEngine(const float* Source, float* Destination) {
+				const __m128 rotation = _mm_loadu_ps(Source);
+				const __m128 translation = _mm_loadu_ps(Source + 4);
+				const __m128 scale = _mm_loadu_ps(Source + 8);
+
+				_mm_storeu_ps(Destination, translation);
+				_mm_storeu_ps(Destination + 3, rotation);
+				_mm_storeu_ps(Destination + 6, _mm_move_ss(_mm_shuffle_ps(scale, scale, _MM_SHUFFLE(2, 1, 0, 0)), _mm_shuffle_ps(rotation, rotation, _MM_SHUFFLE(3, 3, 3, 3))));
+			}
+
+			static void TransformsFromEngine(const float* Source, float* Destination, int32_t Count) {
+				for (int32_t i = 0; i < Count; i++, Source += EngineTransformFloats, Destination += TransformFloats) {
+					TransformFromEngine(Source, Destination);
+				}
+			}
+
+			static void TransformsFromEngine(const float* const* Sources, float* Destination, int32_t Count) {
+				for (int32_t i = 0; i < Count; i++, Destination += TransformFloats) {
+					TransformFromEngine(Sources[i], Destination);
+				}
+			}
+
+			#undef UNREALCLR_SWIZZLE_TO_ENGINE
+		}
+	#endif
+
+	InstructionSet GetInstructionSet() {
+		#if UNREALCLR_CONVERSION_SSE
+			return InstructionSet::SSE;
+		#else
+			return InstructionSet::Scalar;
+		#endif
+	}
+
+	void TransformsToEngine(const float* Source, float* Destination, int32_t Count) {
+		#if UNREALCLR_CONVERSION_SSE
+			SSE::TransformsToEngine(Source, Destination, Count);
+		#else
+			Scalar::TransformsToEngine(Source, Destination, Count);
+		#endif
+	}
+
+	void TransformsFromEngine(const float* Source, float* Destination, int32_t Count) {
+		#if UNREALCLR_CONVERSION_SSE
+			SSE::TransformsFromEngine(Source, Destination, Count);
+		#else
+			Scalar::TransformsFromEngine(Source, Destination, Count);
+		#endif
+	}
+
+	void TransformsFromEngine(const float* const* Sources, float* Destination, int32_t Count) {
+		#if UNREALCLR_CONVERSION_SSE
+			SSE::TransformsFromEngine(Sources, Destination, Count);
+		#else
+			Scalar::TransformsFromEngine(Sources, Destination, Count);
+		#endif
+	}
+}
\ No newline at end of file
@@ -173,7 +173,7 @@ namespace UnrealCLRFramework {
 	}
 
 	#define UNREALCLR_GET_PROPERTY_VALUE(Type, Object, Name, Value)\
-		FName name(ANSI_TO_TCHAR(Name));\
+		FName name(Name);\
 		for (TFieldIterator<Type> currentProperty(Object->GetClass()); currentProperty; ++currentProperty) {\
 			Type* property = *currentProperty;\
 			if (property->GetFName() == name) {\
@@ -184,7 +184,7 @@ namespace UnrealCLRFramework {
 		return false;
 
 	#define UNREALCLR_SET_PROPERTY_VALUE(Type, Object, Name, Value)\
-		FName name(ANSI_TO_TCHAR(Name));\
+		FName name(Name);\
 		for (TFieldIterator<Type> currentProperty(Object->GetClass()); currentProperty; ++currentProperty) {\
 			Type* property = *currentProperty;\
 			if (property->GetFName() == name) {\
@@ -194,18 +194,39 @@ namespace UnrealCLRFramework {
 		}\
 		return false;
 
+	#define UNREALCLR_GET_TEXT_VALUE(Object, Name)\
+		FName name(Name);\
+		for (TFieldIterator<FTextProperty> currentProperty(Object->GetClass()); currentProperty; ++currentProperty) {\
+			FTextProperty* property = *currentProperty;\
+			if (property->GetFName() == name) {\
+				return UnrealCLR::Utility::Encode(*property->GetPropertyValue_InContainer(Object).ToString());\
+			}\
+		}\
+		return nullptr;
+
+	#define UNREALCLR_SET_TEXT_VALUE(Object, Name, Value)\
+		FName name(Name);\
+		for (TFieldIterator<FTextProperty> currentProperty(Object->GetClass()); currentProperty; ++currentProperty) {\
+			FTextProperty* property = *currentProperty;\
+			if (property->GetFName() == name) {\
+				property->SetPropertyValue_InContainer(Object, FText::FromString(FString(UTF8_TO_TCHAR(Value))));\
+				return true;\
+			}\
+		}\
+		return false;
+
 	#define UNREALCLR_SET_BONE_NAME(Name)\
 		FName boneName;\
 		if (!Name)\
 			boneName = NAME_None;\
 		else\
-			boneName = FName(ANSI_TO_TCHAR(Name));
+			boneName = FName(UTF8_TO_TCHAR(Name));
 
 	#define UNREALCLR_COLOR_TO_INTEGER(Color) (Color.A << 24) + (Color.R << 16) + (Color.G << 8) + Color.B
 
 	namespace Assert {
 		void OutputMessage(const char* Message) {
-			FString message(ANSI_TO_TCHAR(Message));
+			FString message(UTF8_TO_TCHAR(Message));
 
 			UE_LOG(LogUnrealAssert, Error, TEXT("%s: %s"), ANSI_TO_TCHAR(__FUNCTION__), *message);
 
@@ -214,24 +235,22 @@ namespace UnrealCLRFramework {
 	}
 
 	namespace CommandLine {
-		void Get(char* Arguments) {
-			const char* arguments = TCHAR_TO_ANSI(FCommandLine::Get());
-
-			UnrealCLR::Utility::Strcpy(Arguments, arguments, UnrealCLR::Utility::Strlen(arguments));
+		const char* Get() {
+			return UnrealCLR::Utility::Encode(FCommandLine::Get());
 		}
 
 		void Set(const char* Arguments) {
-			FCommandLine::Set(ANSI_TO_TCHAR(Arguments));
+			FCommandLine::Set(UTF8_TO_TCHAR(Arguments));
 		}
 
 		void Append(const char* Arguments) {
-			FCommandLine::Append(ANSI_TO_TCHAR(Arguments));
+			FCommandLine::Append(UTF8_TO_TCHAR(Arguments));
 		}
 	}
 
 	namespace Debug {
 		void Log(LogLevel Level, const char* Message) {
-			#define UNREALCLR_FRAMEWORK_LOG(Verbosity) UE_LOG(LogUnrealManaged, Verbosity, TEXT("%s: %s"), ANSI_TO_TCHAR(__FUNCTION__), *FString(ANSI_TO_TCHAR(Message)));
+			#define UNREALCLR_FRAMEWORK_LOG(Verbosity) UE_LOG(LogUnrealManaged, Verbosity, TEXT("%s: %s"), ANSI_TO_TCHAR(__FUNCTION__), *FString(UTF8_TO_TCHAR(Message)));
 
 			if (Level == LogLevel::Display) {
 				UNREALCLR_FRAMEWORK_LOG(Display);
@@ -245,11 +264,11 @@ namespace UnrealCLRFramework {
 		}
 
 		void HandleException(const char* Message) {
-			GEngine->AddOnScreenDebugMessage((uint64)-1, 60.0f, FColor::Red, *FString(ANSI_TO_TCHAR(Message)));
+			GEngine->AddOnScreenDebugMessage((uint64)-1, 60.0f, FColor::Red, *FString(UTF8_TO_TCHAR(Message)));
 		}
 
 		void AddOnScreenMessage(int32 Key, float TimeToDisplay, Color DisplayColor, const char* Message) {
-			GEngine->AddOnScreenDebugMessage((uint64)Key, TimeToDisplay, DisplayColor, *FString(ANSI_TO_TCHAR(Message)));
+			GEngine->AddOnScreenDebugMessage((uint64)Key, TimeToDisplay, DisplayColor, *FString(UTF8_TO_TCHAR(Message)));
 		}
 
 		void ClearOnScreenMessages() {
@@ -287,6 +306,10 @@ namespace UnrealCLRFramework {
 		void FlushPersistentLines() {
 			FlushPersistentDebugLines(UnrealCLR::Engine::World);
 		}
+
+		LogBuffer* GetLogBuffer() {
+			return &UnrealCLR::Logger::Buffer;
+		}
 	}
 
 	namespace Object {
@@ -304,9 +327,9 @@ namespace UnrealCLRFramework {
 			switch (Type) {
 				case ObjectType::Blueprint: {
 					#if WITH_EDITOR
-						object = StaticLoadObject(UBlueprint::StaticClass(), nullptr, *FString(ANSI_TO_TCHAR(Name)));
+						object = StaticLoadObject(UBlueprint::StaticClass(), nullptr, *FString(UTF8_TO_TCHAR(Name)));
 					#else
-						FString name(ANSI_TO_TCHAR(Name));
+						FString name(UTF8_TO_TCHAR(Name));
 						int32 index = INDEX_NONE;
 
 						if (name.FindLastChar(TCHAR('/'), index)) {
@@ -322,37 +345,37 @@ namespace UnrealCLRFramework {
 				}
 
 				case ObjectType::SoundWave: {
-					object = StaticLoadObject(USoundWave::StaticClass(), nullptr, *FString(ANSI_TO_TCHAR(Name)));
+					object = StaticLoadObject(USoundWave::StaticClass(), nullptr, *FString(UTF8_TO_TCHAR(Name)));
 					break;
 				}
 
 				case ObjectType::AnimationSequence: {
-					object = StaticLoadObject(UAnimSequence::StaticClass(), nullptr, *FString(ANSI_TO_TCHAR(Name)));
+					object = StaticLoadObject(UAnimSequence::StaticClass(), nullptr, *FString(UTF8_TO_TCHAR(Name)));
 					break;
 				}
 
 				case ObjectType::AnimationMontage: {
-					object = StaticLoadObject(UAnimMontage::StaticClass(), nullptr, *FString(ANSI_TO_TCHAR(Name)));
+					object = StaticLoadObject(UAnimMontage::StaticClass(), nullptr, *FString(UTF8_TO_TCHAR(Name)));
 					break;
 				}
 
 				case ObjectType::StaticMesh: {
-					object = StaticLoadObject(UStaticMesh::StaticClass(), nullptr, *FString(ANSI_TO_TCHAR(Name)));
+					object = StaticLoadObject(UStaticMesh::StaticClass(), nullptr, *FString(UTF8_TO_TCHAR(Name)));
 					break;
 				}
 
 				case ObjectType::SkeletalMesh: {
-					object = StaticLoadObject(USkeletalMesh::StaticClass(), nullptr, *FString(ANSI_TO_TCHAR(Name)));
+					object = StaticLoadObject(USkeletalMesh::StaticClass(), nullptr, *FString(UTF8_TO_TCHAR(Name)));
 					break;
 				}
 
 				case ObjectType::Material: {
-					object = StaticLoadObject(UMaterial::StaticClass(), nullptr, *FString(ANSI_TO_TCHAR(Name)));
+					object = StaticLoadObject(UMaterial::StaticClass(), nullptr, *FString(UTF8_TO_TCHAR(Name)));
 					break;
 				}
 
 				case ObjectType::Texture2D: {
-					object = StaticLoadObject(UTexture2D::StaticClass(), nullptr, *FString(ANSI_TO_TCHAR(Name)));
+					object = StaticLoadObject(UTexture2D::StaticClass(), nullptr, *FString(UTF8_TO_TCHAR(Name)));
 					break;
 				}
 
@@ -364,129 +387,268 @@ namespace UnrealCLRFramework {
 		}
 
 		void Rename(UObject* Object, const char* Name) {
-			FString name(ANSI_TO_TCHAR(Name));
+			FString name(UTF8_TO_TCHAR(Name));
 
 			Object->Rename(*name);
 		}
 
-		void GetName(UObject* Object, char* Name) {
-			const char* name = TCHAR_TO_ANSI(*Object->GetName());
-
-			UnrealCLR::Utility::Strcpy(Name, name, UnrealCLR::Utility::Strlen(name));
+		const char* GetName(UObject* Object) {
+			return UnrealCLR::Utility::Encode(*Object->GetName());
 		}
 
 		bool GetBool(UObject* Object, const char* Name, bool* Value) {
-			UNREALCLR_GET_PROPERTY_VALUE(FBoolProperty, Object, Name, Value);
+			UNREALCLR_GET_PROPERTY_VALUE(FBoolProperty, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool GetByte(UObject* Object, const char* Name, int8* Value) {
-			UNREALCLR_GET_PROPERTY_VALUE(FByteProperty, Object, Name, Value);
+			UNREALCLR_GET_PROPERTY_VALUE(FByteProperty, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool GetShort(UObject* Object, const char* Name, int16* Value) {
-			UNREALCLR_GET_PROPERTY_VALUE(FInt16Property, Object, Name, Value);
+			UNREALCLR_GET_PROPERTY_VALUE(FInt16Property, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool GetInt(UObject* Object, const char* Name, int32* Value) {
-			UNREALCLR_GET_PROPERTY_VALUE(FIntProperty, Object, Name, Value);
+			UNREALCLR_GET_PROPERTY_VALUE(FIntProperty, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool GetLong(UObject* Object, const char* Name, int64* Value) {
-			UNREALCLR_GET_PROPERTY_VALUE(FInt64Property, Object, Name, Value);
+			UNREALCLR_GET_PROPERTY_VALUE(FInt64Property, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool GetUShort(UObject* Object, const char* Name, uint16* Value) {
-			UNREALCLR_GET_PROPERTY_VALUE(FUInt16Property, Object, Name, Value);
+			UNREALCLR_GET_PROPERTY_VALUE(FUInt16Property, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool GetUInt(UObject* Object, const char* Name, uint32* Value) {
-			UNREALCLR_GET_PROPERTY_VALUE(FUInt32Property, Object, Name, Value);
+			UNREALCLR_GET_PROPERTY_VALUE(FUInt32Property, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool GetULong(UObject* Object, const char* Name, uint64* Value) {
-			UNREALCLR_GET_PROPERTY_VALUE(FUInt64Property, Object, Name, Value);
+			UNREALCLR_GET_PROPERTY_VALUE(FUInt64Property, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool GetFloat(UObject* Object, const char* Name, float* Value) {
-			UNREALCLR_GET_PROPERTY_VALUE(FFloatProperty, Object, Name, Value);
+			UNREALCLR_GET_PROPERTY_VALUE(FFloatProperty, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool GetDouble(UObject* Object, const char* Name, double* Value) {
-			UNREALCLR_GET_PROPERTY_VALUE(FDoubleProperty, Object, Name, Value);
+			UNREALCLR_GET_PROPERTY_VALUE(FDoubleProperty, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
-		bool GetText(UObject* Object, const char* Name, char* Value) {
-			FName name(ANSI_TO_TCHAR(Name));
-
-			for (TFieldIterator<FTextProperty> currentProperty(Object->GetClass()); currentProperty; ++currentProperty) {
-				FTextProperty* property = *currentProperty;
-
-				if (property->GetFName() == name) {
-					const char* string = TCHAR_TO_ANSI(*property->GetPropertyValue_InContainer(Object).ToString());
-
-					UnrealCLR::Utility::Strcpy(Value, string, UnrealCLR::Utility::Strlen(string));
-
-					return true;
-				}
-			}
-
-			return false;
+		const char* GetText(UObject* Object, const char* Name) {
+			UNREALCLR_GET_TEXT_VALUE(Object, UTF8_TO_TCHAR(Name));
 		}
 
 		bool SetBool(UObject* Object, const char* Name, bool Value) {
-			UNREALCLR_SET_PROPERTY_VALUE(FBoolProperty, Object, Name, Value);
+			UNREALCLR_SET_PROPERTY_VALUE(FBoolProperty, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool SetByte(UObject* Object, const char* Name, int8 Value) {
-			UNREALCLR_SET_PROPERTY_VALUE(FByteProperty, Object, Name, Value);
+			UNREALCLR_SET_PROPERTY_VALUE(FByteProperty, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool SetShort(UObject* Object, const char* Name, int16 Value) {
-			UNREALCLR_SET_PROPERTY_VALUE(FInt16Property, Object, Name, Value);
+			UNREALCLR_SET_PROPERTY_VALUE(FInt16Property, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool SetInt(UObject* Object, const char* Name, int32 Value) {
-			UNREALCLR_SET_PROPERTY_VALUE(FIntProperty, Object, Name, Value);
+			UNREALCLR_SET_PROPERTY_VALUE(FIntProperty, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool SetLong(UObject* Object, const char* Name, int64 Value) {
-			UNREALCLR_SET_PROPERTY_VALUE(FInt64Property, Object, Name, Value);
+			UNREALCLR_SET_PROPERTY_VALUE(FInt64Property, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool SetUShort(UObject* Object, const char* Name, uint16 Value) {
-			UNREALCLR_SET_PROPERTY_VALUE(FUInt16Property, Object, Name, Value);
+			UNREALCLR_SET_PROPERTY_VALUE(FUInt16Property, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool SetUInt(UObject* Object, const char* Name, uint32 Value) {
-			UNREALCLR_SET_PROPERTY_VALUE(FUInt32Property, Object, Name, Value);
+			UNREALCLR_SET_PROPERTY_VALUE(FUInt32Property, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool SetULong(UObject* Object, const char* Name, uint64 Value) {
-			UNREALCLR_SET_PROPERTY_VALUE(FUInt64Property, Object, Name, Value);
+			UNREALCLR_SET_PROPERTY_VALUE(FUInt64Property, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool SetFloat(UObject* Object, const char* Name, float Value) {
-			UNREALCLR_SET_PROPERTY_VALUE(FFloatProperty, Object, Name, Value);
+			UNREALCLR_SET_PROPERTY_VALUE(FFloatProperty, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool SetDouble(UObject* Object, const char* Name, double Value) {
-			UNREALCLR_SET_PROPERTY_VALUE(FDoubleProperty, Object, Name, Value);
+			UNREALCLR_SET_PROPERTY_VALUE(FDoubleProperty, Object, UTF8_TO_TCHAR(Name), Value);
 		}
 
 		bool SetText(UObject* Object, const char* Name, const char* Value) {
-			FName name(ANSI_TO_TCHAR(Name));
+			UNREALCLR_SET_TEXT_VALUE(Object, UTF8_TO_TCHAR(Name), Value);
+		}
 
-			for (TFieldIterator<FTextProperty> currentProperty(Object->GetClass()); currentProperty; ++currentProperty) {
-				FTextProperty* property = *currentProperty;
+		bool GetBoolInterned(UObject* Object, const InternedName* Name, bool* Value) {
+			UNREALCLR_GET_PROPERTY_VALUE(FBoolProperty, Object, *Name, Value);
+		}
 
-				if (property->GetFName() == name) {
-					property->SetPropertyValue_InContainer(Object, FText::FromString(FString(ANSI_TO_TCHAR(Value))));
+		bool GetByteInterned(UObject* Object, const InternedName* Name, int8* Value) {
+			UNREALCLR_GET_PROPERTY_VALUE(FByteProperty, Object, *Name, Value);
+		}
 
-					return true;
-				}
-			}
+		bool GetShortInterned(UObject* Object, const InternedName* Name, int16* Value) {
+			UNREALCLR_GET_PROPERTY_VALUE(FInt16Property, Object, *Name, Value);
+		}
 
-			return false;
+		bool GetIntInterned(UObject* Object, const InternedName* Name, int32* Value) {
+			UNREALCLR_GET_PROPERTY_VALUE(FIntProperty, Object, *Name, Value);
+		}
+
+		bool GetLongInterned(UObject* Object, const InternedName* Name, int64* Value) {
+			UNREALCLR_GET_PROPERTY_VALUE(FInt64Property, Object, *Name, Value);
+		}
+
+		bool GetUShortInterned(UObject* Object, const InternedName* Name, uint16* Value) {
+			UNREALCLR_GET_PROPERTY_VALUE(FUInt16Property, Object, *Name, Value);
+		}
+
+		bool GetUIntInterned(UObject* Object, const InternedName* Name, uint32* Value) {
+			UNREALCLR_GET_PROPERTY_VALUE(FUInt32Property, Object, *Name, Value);
+		}
+
+		bool GetULongInterned(UObject* Object, const InternedName* Name, uint64* Value) {
+			UNREALCLR_GET_PROPERTY_VALUE(FUInt64Property, Object, *Name, Value);
+		}
+
+		bool GetFloatInterned(UObject* Object, const InternedName* Name, float* Value) {
+			UNREALCLR_GET_PROPERTY_VALUE(FFloatProperty, Object, *Name, Value);
+		}
+
+		bool GetDoubleInterned(UObject* Object, const InternedName* Name, double* Value) {
+			UNREALCLR_GET_PROPERTY_VALUE(FDoubleProperty, Object, *Name, Value);
+		}
+
+		const char* GetTextInterned(UObject* Object, const InternedName* Name) {
+			UNREALCLR_GET_TEXT_VALUE(Object, *Name);
+		}
+
+		bool SetBoolInterned(UObject* Object, const InternedName* Name, bool Value) {
+			UNREALCLR_SET_PROPERTY_VALUE(FBoolProperty, Object, *Name, Value);
+		}
+
+		bool SetByteInterned(UObject* Object, const InternedName* Name, int8 Value) {
+			UNREALCLR_SET_PROPERTY_VALUE(FByteProperty, Object, *Name, Value);
+		}
+
+		bool SetShortInterned(UObject* Object, const InternedName* Name, int16 Value) {
+			UNREALCLR_SET_PROPERTY_VALUE(FInt16Property, Object, *Name, Value);
+		}
+
+		bool SetIntInterned(UObject* Object, const InternedName* Name, int32 Value) {
+			UNREALCLR_SET_PROPERTY_VALUE(FIntProperty, Object, *Name, Value);
+		}
+
+		bool SetLongInterned(UObject* Object, const InternedName* Name, int64 Value) {
+			UNREALCLR_SET_PROPERTY_VALUE(FInt64Property, Object, *Name, Value);
+		}
+
+		bool SetUShortInterned(UObject* Object, const InternedName* Name, uint16 Value) {
+			UNREALCLR_SET_PROPERTY_VALUE(FUInt16Property, Object, *Name, Value);
+		}
+
+		bool SetUIntInterned(UObject* Object, const InternedName* Name, uint32 Value) {
+			UNREALCLR_SET_PROPERTY_VALUE(FUInt32Property, Object, *Name, Value);
+		}
+
+		bool SetULongInterned(UObject* Object, const InternedName* Name, uint64 Value) {
+			UNREALCLR_SET_PROPERTY_VALUE(FUInt64Property, Object, *Name, Value);
+		}
+
+		bool SetFloatInterned(UObject* Object, const InternedName* Name, float Value) {
+			UNREALCLR_SET_PROPERTY_VALUE(FFloatProperty, Object, *Name, Value);
+		}
+
+		bool SetDoubleInterned(UObject* Object, const InternedName* Name, double Value) {
+			UNREALCLR_SET_PROPERTY_VALUE(FDoubleProperty, Object, *Name, Value);
+		}
+
+		bool SetTextInterned(UObject* Object, const InternedName* Name, const char* Value) {
+			UNREALCLR_SET_TEXT_VALUE(Object, *Name, Value);
+		}
+
+		FUObjectItem* GetItem(UObject* Object, int32* Index, int32* SerialNumber, UClass** Class) {
+			static_assert(STRUCT_OFFSET(FUObjectItem, Object) == STRUCT_OFFSET(ObjectItem, Object) && STRUCT_OFFSET(FUObjectItem, Flags) == STRUCT_OFFSET(ObjectItem, Flags) && STRUCT_OFFSET(FUObjectItem, SerialNumber) == STRUCT_OFFSET(ObjectItem, SerialNumber), "Object item layout is mirrored by the managed side");
+			static_assert(int32(EInternalObjectFlags::PendingKill) == (1 << 29) && int32(EInternalObjectFlags::Unreachable) == (1 << 28), "Object item flags are mirrored by the managed side");
+
+			*Index = GUObjectArray.ObjectToIndex(Object);
+			*SerialNumber = GUObjectArray.AllocateSerialNumber(*Index);
+			*Class = Object->GetClass();
+
+			return GUObjectArray.IndexToObject(*Index);
+		}
+
+		bool GetPropertyHandle(UObject* Object, const char* Name, PropertyHandle* Result) {
+			FProperty* property = FindFProperty<FProperty>(Object->GetClass(), FName(UTF8_TO_TCHAR(Name)));
+
+			if (!property || property->ArrayDim != 1)
+				return false;
+
+			PropertyType type = PropertyType::None;
+
+			if (FBoolProperty* boolProperty = CastField<FBoolProperty>(property))
+				type = boolProperty->IsNativeBool() ? PropertyType::Bool : PropertyType::None;
+			else if (property->IsA<FByteProperty>())
+				type = PropertyType::Byte;
+			else if (property->IsA<FInt16Property>())
+				type = PropertyType::Short;
+			else if (property->IsA<FIntProperty>())
+				type = PropertyType::Int;
+			else if (property->IsA<FInt64Property>())
+				type = PropertyType::Long;
+			else if (property->IsA<FUInt16Property>())
+				type = PropertyType::UShort;
+			else if (property->IsA<FUInt32Property>())
+				type = PropertyType::UInt;
+			else if (property->IsA<FUInt64Property>())
+				type = PropertyType::ULong;
+			else if (property->IsA<FFloatProperty>())
+				type = PropertyType::Float;
+			else if (property->IsA<FDoubleProperty>())
+				type = PropertyType::Double;
+			else if (property->IsA<FTextProperty>())
+				type = PropertyType::Text;
+
+			if (type == PropertyType::None)
+				return false;
+
+			Result->Property = property;
+			Result->Class = Object->GetClass();
+			Result->Offset = property->GetOffset_ForInternal();
+			Result->Type = type;
+
+			return true;
+		}
+
+		const char* GetTextByHandle(UObject* Object, FTextProperty* Property) {
+			return UnrealCLR::Utility::Encode(*Property->GetPropertyValue_InContainer(Object).ToString());
+		}
+
+		void SetTextByHandle(UObject* Object, FTextProperty* Property, const char* Value) {
+			Property->SetPropertyValue_InContainer(Object, FText::FromString(FString(UTF8_TO_TCHAR(Value))));
+		}
+
+		void LoadAsync(int32 Request, ObjectType Type, const char** Names, int32 Count, LoadAsyncDelegate Function) {
+			UnrealCLR::AssetLoader::Start(Request, Type, Names, Count, Function);
+		}
+
+		void CancelLoadAsync(int32 Request) {
+			UnrealCLR::AssetLoader::Cancel(Request);
+		}
+	}
+
+	namespace Name {
+		void Create(const char* Value, InternedName* Result) {
+			*Result = FName(UTF8_TO_TCHAR(Value));
+		}
+
+		const char* GetString(const InternedName* Value) {
+			return UnrealCLR::Utility::Encode(*FName(*Value).ToString());
 		}
 	}
 
@@ -507,22 +669,16 @@ namespace UnrealCLRFramework {
 			#endif
 		}
 
-		void GetProjectDirectory(char* Directory) {
-			const char* directory = TCHAR_TO_ANSI(FGenericPlatformMisc::ProjectDir());
-
-			UnrealCLR::Utility::Strcpy(Directory, directory, UnrealCLR::Utility::Strlen(directory));
+		const char* GetProjectDirectory() {
+			return UnrealCLR::Utility::Encode(FGenericPlatformMisc::ProjectDir());
 		}
 
-		void GetDefaultLanguage(char* Language) {
-			const char* language = TCHAR_TO_ANSI(*FGenericPlatformMisc::GetDefaultLanguage());
-
-			UnrealCLR::Utility::Strcpy(Language, language, UnrealCLR::Utility::Strlen(language));
+		const char* GetDefaultLanguage() {
+			return UnrealCLR::Utility::Encode(*FGenericPlatformMisc::GetDefaultLanguage());
 		}
 
-		void GetProjectName(char* ProjectName) {
-			const char* projectName = TCHAR_TO_ANSI(FApp::GetProjectName());
-
-			UnrealCLR::Utility::Strcpy(ProjectName, projectName, UnrealCLR::Utility::Strlen(projectName));
+		const char* GetProjectName() {
+			return UnrealCLR::Utility::Encode(FApp::GetProjectName());
 		}
 
 		float GetVolumeMultiplier() {
@@ -530,7 +686,7 @@ namespace UnrealCLRFramework {
 		}
 
 		void SetProjectName(const char* ProjectName) {
-			FApp::SetProjectName(ANSI_TO_TCHAR(ProjectName));
+			FApp::SetProjectName(UTF8_TO_TCHAR(ProjectName));
 		}
 
 		void SetVolumeMultiplier(float Value) {
@@ -540,27 +696,27 @@ namespace UnrealCLRFramework {
 
 	namespace ConsoleManager {
 		bool IsRegisteredVariable(const char* Name) {
-			return IConsoleManager::Get().IsNameRegistered(ANSI_TO_TCHAR(Name));
+			return IConsoleManager::Get().IsNameRegistered(UTF8_TO_TCHAR(Name));
 		}
 
 		IConsoleVariable* FindVariable(const char* Name) {
-			return IConsoleManager::Get().FindConsoleVariable(ANSI_TO_TCHAR(Name));
+			return IConsoleManager::Get().FindConsoleVariable(UTF8_TO_TCHAR(Name));
 		}
 
 		IConsoleVariable* RegisterVariableBool(const char* Name, const char* Help, bool DefaultValue, bool ReadOnly) {
-			return IConsoleManager::Get().RegisterConsoleVariable(ANSI_TO_TCHAR(Name), DefaultValue, ANSI_TO_TCHAR(Help), !ReadOnly ? ECVF_Default : ECVF_ReadOnly);
+			return IConsoleManager::Get().RegisterConsoleVariable(UTF8_TO_TCHAR(Name), DefaultValue, UTF8_TO_TCHAR(Help), !ReadOnly ? ECVF_Default : ECVF_ReadOnly);
 		}
 
 		IConsoleVariable* RegisterVariableInt(const char* Name, const char* Help, int32 DefaultValue, bool ReadOnly) {
-			return IConsoleManager::Get().RegisterConsoleVariable(ANSI_TO_TCHAR(Name), DefaultValue, ANSI_TO_TCHAR(Help), !ReadOnly ? ECVF_Default : ECVF_ReadOnly);
+			return IConsoleManager::Get().RegisterConsoleVariable(UTF8_TO_TCHAR(Name), DefaultValue, UTF8_TO_TCHAR(Help), !ReadOnly ? ECVF_Default : ECVF_ReadOnly);
 		}
 
 		IConsoleVariable* RegisterVariableFloat(const char* Name, const char* Help, float DefaultValue, bool ReadOnly) {
-			return IConsoleManager::Get().RegisterConsoleVariable(ANSI_TO_TCHAR(Name), DefaultValue, ANSI_TO_TCHAR(Help), !ReadOnly ? ECVF_Default : ECVF_ReadOnly);
+			return IConsoleManager::Get().RegisterConsoleVariable(UTF8_TO_TCHAR(Name), DefaultValue, UTF8_TO_TCHAR(Help), !ReadOnly ? ECVF_Default : ECVF_ReadOnly);
 		}
 
 		IConsoleVariable* RegisterVariableString(const char* Name, const char* Help, const char* DefaultValue, bool ReadOnly) {
-			return IConsoleManager::Get().RegisterConsoleVariable(ANSI_TO_TCHAR(Name), ANSI_TO_TCHAR(DefaultValue), ANSI_TO_TCHAR(Help), !ReadOnly ? ECVF_Default : ECVF_ReadOnly);
+			return IConsoleManager::Get().RegisterConsoleVariable(UTF8_TO_TCHAR(Name), UTF8_TO_TCHAR(DefaultValue), UTF8_TO_TCHAR(Help), !ReadOnly ? ECVF_Default : ECVF_ReadOnly);
 		}
 
 		void RegisterCommand(const char* Name, const char* Help, ConsoleCommandDelegate Function, bool ReadOnly) {
@@ -575,11 +731,11 @@ namespace UnrealCLRFramework {
 				}
 			};
 
-			IConsoleManager::Get().RegisterConsoleCommand(ANSI_TO_TCHAR(Name), ANSI_TO_TCHAR(Help), FConsoleCommandWithArgsDelegate::CreateLambda(function), !ReadOnly ? ECVF_Default : ECVF_ReadOnly);
+			IConsoleManager::Get().RegisterConsoleCommand(UTF8_TO_TCHAR(Name), UTF8_TO_TCHAR(Help), FConsoleCommandWithArgsDelegate::CreateLambda(function), !ReadOnly ? ECVF_Default : ECVF_ReadOnly);
 		}
 
 		void UnregisterObject(const char* Name) {
-			IConsoleManager::Get().UnregisterConsoleObject(ANSI_TO_TCHAR(Name), false);
+			IConsoleManager::Get().UnregisterConsoleObject(UTF8_TO_TCHAR(Name), false);
 		}
 	}
 
@@ -620,10 +776,8 @@ namespace UnrealCLRFramework {
 			return UnrealCLR::Engine::World->GetGameViewport()->Viewport->GetWindowMode();
 		}
 
-		void GetVersion(char* Version) {
-			const char* version = TCHAR_TO_ANSI(*FEngineVersion::Current().ToString());
-
-			UnrealCLR::Utility::Strcpy(Version, version, UnrealCLR::Utility::Strlen(version));
+		const char* GetVersion() {
+			return UnrealCLR::Utility::Encode(*FEngineVersion::Current().ToString());
 		}
 
 		float GetMaxFPS() {
@@ -641,16 +795,16 @@ namespace UnrealCLRFramework {
 				TSharedPtr<SWindow> gameViewportWindow = gameEngine->GameViewportWindow.Pin();
 
 				if (gameViewportWindow.IsValid())
-					gameViewportWindow->SetTitle(FText::FromString(FString(ANSI_TO_TCHAR(Title))));
+					gameViewportWindow->SetTitle(FText::FromString(FString(UTF8_TO_TCHAR(Title))));
 			}
 		}
 
 		void AddActionMapping(const char* ActionName, const char* Key, bool Shift, bool Ctrl, bool Alt, bool Cmd) {
-			UPlayerInput::AddEngineDefinedActionMapping(FInputActionKeyMapping(FName(ANSI_TO_TCHAR(ActionName)), FKey(ANSI_TO_TCHAR(Key)), Shift, Ctrl, Alt, Cmd));
+			UPlayerInput::AddEngineDefinedActionMapping(FInputActionKeyMapping(FName(UTF8_TO_TCHAR(ActionName)), FKey(UTF8_TO_TCHAR(Key)), Shift, Ctrl, Alt, Cmd));
 		}
 
 		void AddAxisMapping(const char* AxisName, const char* Key, float Scale) {
-			UPlayerInput::AddEngineDefinedAxisMapping(FInputAxisKeyMapping(FName(ANSI_TO_TCHAR(AxisName)), FKey(ANSI_TO_TCHAR(Key)), Scale));
+			UPlayerInput::AddEngineDefinedAxisMapping(FInputAxisKeyMapping(FName(UTF8_TO_TCHAR(AxisName)), FKey(UTF8_TO_TCHAR(Key)), Scale));
 		}
 
 		void ForceGarbageCollection(bool FullPurge) {
@@ -671,12 +825,10 @@ namespace UnrealCLRFramework {
 			return UHeadMountedDisplayFunctionLibrary::IsHeadMountedDisplayEnabled();
 		}
 
-		void GetDeviceName(char* Name) {
+		const char* GetDeviceName() {
 			FName deviceName = UHeadMountedDisplayFunctionLibrary::GetHMDDeviceName();
 
-			const char* name = TCHAR_TO_ANSI(*deviceName.ToString());
-
-			UnrealCLR::Utility::Strcpy(Name, name, UnrealCLR::Utility::Strlen(name));
+			return UnrealCLR::Utility::Encode(*deviceName.ToString());
 		}
 	}
 
@@ -711,10 +863,17 @@ namespace UnrealCLRFramework {
 			TSubclassOf<AActor> type;
 
 			if (Name)
-				name = FString(ANSI_TO_TCHAR(Name));
+				name = FString(UTF8_TO_TCHAR(Name));
 
 			UNREALCLR_GET_ACTOR_TYPE(Type, UNREALCLR_NONE, ::StaticClass(), type);
 
+			if (Name) {
+				actor = UnrealCLR::ActorIndex::FindByName(FName(*name), type);
+
+				if (actor)
+					return actor;
+			}
+
 			for (TActorIterator<AActor> currentActor(UnrealCLR::Engine::World, type); currentActor; ++currentActor) {
 				if (!Name || Name && *currentActor->GetName() == name) {
 					actor = *currentActor;
@@ -722,16 +881,24 @@ namespace UnrealCLRFramework {
 				}
 			}
 
+			if (actor && Name)
+				UnrealCLR::ActorIndex::Add(actor);
+
 			return actor;
 		}
 
 		AActor* GetActorByTag(const char* Tag, ActorType Type) {
-			FName tag(ANSI_TO_TCHAR(Tag));
+			FName tag(UTF8_TO_TCHAR(Tag));
 			AActor* actor = nullptr;
 			TSubclassOf<AActor> type;
 
 			UNREALCLR_GET_ACTOR_TYPE(Type, UNREALCLR_NONE, ::StaticClass(), type);
 
+			actor = UnrealCLR::ActorIndex::FindByTag(tag, type);
+
+			if (actor)
+				return actor;
+
 			for (TActorIterator<AActor> currentActor(UnrealCLR::Engine::World, type); currentActor; ++currentActor) {
 				if (currentActor->ActorHasTag(tag)) {
 					actor = *currentActor;
@@ -739,6 +906,9 @@ namespace UnrealCLRFramework {
 				}
 			}
 
+			if (actor)
+				UnrealCLR::ActorIndex::Add(actor);
+
 			return actor;
 		}
 
@@ -793,10 +963,8 @@ namespace UnrealCLRFramework {
 			return ConsoleVariable->GetFloat();
 		}
 
-		void GetString(IConsoleVariable* ConsoleVariable, char* Value) {
-			const char* value = TCHAR_TO_ANSI(*ConsoleVariable->GetString());
-
-			UnrealCLR::Utility::Strcpy(Value, value, UnrealCLR::Utility::Strlen(value));
+		const char* GetString(IConsoleVariable* ConsoleVariable) {
+			return UnrealCLR::Utility::Encode(*ConsoleVariable->GetString());
 		}
 
 		void SetBool(IConsoleVariable* ConsoleVariable, bool Value) {
@@ -812,7 +980,7 @@ namespace UnrealCLRFramework {
 		}
 
 		void SetString(IConsoleVariable* ConsoleVariable, const char* Value) {
-			ConsoleVariable->Set(ANSI_TO_TCHAR(Value));
+			ConsoleVariable->Set(UTF8_TO_TCHAR(Value));
 		}
 
 		void SetOnChangedCallback(IConsoleVariable* ConsoleVariable, ConsoleVariableDelegate Function) {
@@ -857,30 +1025,41 @@ namespace UnrealCLRFramework {
 			}
 
 			if (Name) {
-				FString name(ANSI_TO_TCHAR(Name));
+				FString name(UTF8_TO_TCHAR(Name));
+
+				UnrealCLR::ActorIndex::Remove(actor);
 
 				actor->Rename(*name);
 
 				#if WITH_EDITOR
 					actor->SetActorLabel(*name);
 				#endif
+
+				UnrealCLR::ActorIndex::Add(actor);
 			}
 
 			return actor;
 		}
 
 		bool Destroy(AActor* Actor) {
+			UnrealCLR::ActorIndex::Remove(Actor);
+			UnrealCLR::ComponentIndex::Remove(Actor);
+
 			return UnrealCLR::Engine::World->DestroyActor(Actor);
 		}
 
 		void Rename(AActor* Actor, const char* Name) {
-			FString name(ANSI_TO_TCHAR(Name));
+			FString name(UTF8_TO_TCHAR(Name));
+
+			UnrealCLR::ActorIndex::Remove(Actor);
 
 			Actor->Rename(*name);
 
 			#if WITH_EDITOR
 				Actor->SetActorLabel(*name);
 			#endif
+
+			UnrealCLR::ActorIndex::Add(Actor);
 		}
 
 		void Hide(AActor* Actor, bool Value) {
@@ -892,23 +1071,15 @@ namespace UnrealCLRFramework {
 		}
 
 		UActorComponent* GetComponent(AActor* Actor, const char* Name, ComponentType Type) {
-			FString name;
-			UActorComponent* component = nullptr;
+			FName name;
 			TSubclassOf<UActorComponent> type;
 
 			if (Name)
-				name = FString(ANSI_TO_TCHAR(Name));
+				name = FName(UTF8_TO_TCHAR(Name));
 
 			UNREALCLR_GET_COMPONENT_TYPE(Type, UNREALCLR_NONE, ::StaticClass(), type);
 
-			for (UActorComponent* currentComponent : Actor->GetComponents()) {
-				if (currentComponent && currentComponent->IsA(type) && (!Name || Name && *currentComponent->GetName() == name)) {
-					component = currentComponent;
-					break;
-				}
-			}
-
-			return component;
+			return UnrealCLR::ComponentIndex::Find(Actor, name, type);
 		}
 
 		USceneComponent* GetRootComponent(AActor* Actor, ComponentType Type) {
@@ -968,15 +1139,33 @@ namespace UnrealCLRFramework {
 		}
 
 		void AddTag(AActor* Actor, const char* Tag) {
-			Actor->Tags.AddUnique(FName(ANSI_TO_TCHAR(Tag)));
+			Actor->Tags.AddUnique(FName(UTF8_TO_TCHAR(Tag)));
+
+			UnrealCLR::ActorIndex::Add(Actor);
 		}
 
 		void RemoveTag(AActor* Actor, const char* Tag) {
-			Actor->Tags.Remove(FName(ANSI_TO_TCHAR(Tag)));
+			UnrealCLR::ActorIndex::Remove(Actor);
+
+			Actor->Tags.Remove(FName(UTF8_TO_TCHAR(Tag)));
+
+			UnrealCLR::ActorIndex::Add(Actor);
 		}
 
 		bool HasTag(AActor* Actor, const char* Tag) {
-			return Actor->ActorHasTag(FName(ANSI_TO_TCHAR(Tag)));
+			return Actor->ActorHasTag(FName(UTF8_TO_TCHAR(Tag)));
+		}
+
+		bool HasTagInterned(AActor* Actor, const InternedName* Tag) {
+			return Actor->ActorHasTag(*Tag);
+		}
+
+		int32 GetComponents(AActor* Actor, ComponentType Type, UActorComponent** Components, int32 Capacity) {
+			TSubclassOf<UActorComponent> type;
+
+			UNREALCLR_GET_COMPONENT_TYPE(Type, UNREALCLR_NONE, ::StaticClass(), type);
+
+			return UnrealCLR::ComponentIndex::FindAll(Actor, type, Components, Capacity);
 		}
 	}
 
@@ -1110,7 +1299,7 @@ namespace UnrealCLRFramework {
 		}
 
 		void ConsoleCommand(APlayerController* PlayerController, const char* Command, bool WriteToLog) {
-			PlayerController->ConsoleCommand(FString(ANSI_TO_TCHAR(Command)), WriteToLog);
+			PlayerController->ConsoleCommand(FString(UTF8_TO_TCHAR(Command)), WriteToLog);
 		}
 
 		bool SetPause(APlayerController* PlayerController, bool Value) {
@@ -1206,11 +1395,11 @@ namespace UnrealCLRFramework {
 
 	namespace PlayerInput {
 		bool IsKeyPressed(UPlayerInput* PlayerInput, const char* Key) {
-			return PlayerInput->IsPressed(FKey(ANSI_TO_TCHAR(Key)));
+			return PlayerInput->IsPressed(FKey(UTF8_TO_TCHAR(Key)));
 		}
 
 		float GetTimeKeyPressed(UPlayerInput* PlayerInput, const char* Key) {
-			return PlayerInput->GetTimeDown(FKey(ANSI_TO_TCHAR(Key)));
+			return PlayerInput->GetTimeDown(FKey(UTF8_TO_TCHAR(Key)));
 		}
 
 		void GetMouseSensitivity(UPlayerInput* PlayerInput, Vector2* Value) {
@@ -1221,6 +1410,14 @@ namespace UnrealCLRFramework {
 		void SetMouseSensitivity(UPlayerInput* PlayerInput, const Vector2* Value) {
 			PlayerInput->SetMouseSensitivity(Value->X, Value->Y);
 		}
+
+		bool IsKeyPressedInterned(UPlayerInput* PlayerInput, const InternedName* Key) {
+			return PlayerInput->IsPressed(FKey(*Key));
+		}
+
+		float GetTimeKeyPressedInterned(UPlayerInput* PlayerInput, const InternedName* Key) {
+			return PlayerInput->GetTimeDown(FKey(*Key));
+		}
 	}
 
 	namespace Texture2D {
@@ -1240,19 +1437,25 @@ namespace UnrealCLRFramework {
 		}
 
 		void Destroy(UActorComponent* ActorComponent, bool PromoteChildren) {
+			UnrealCLR::ComponentIndex::Invalidate(ActorComponent->GetOwner());
+
 			ActorComponent->DestroyComponent(PromoteChildren);
 		}
 
 		void AddTag(UActorComponent* ActorComponent, const char* Tag) {
-			ActorComponent->ComponentTags.AddUnique(FName(ANSI_TO_TCHAR(Tag)));
+			ActorComponent->ComponentTags.AddUnique(FName(UTF8_TO_TCHAR(Tag)));
 		}
 
 		void RemoveTag(UActorComponent* ActorComponent, const char* Tag) {
-			ActorComponent->ComponentTags.Remove(FName(ANSI_TO_TCHAR(Tag)));
+			ActorComponent->ComponentTags.Remove(FName(UTF8_TO_TCHAR(Tag)));
 		}
 
 		bool HasTag(UActorComponent* ActorComponent, const char* Tag) {
-			return ActorComponent->ComponentHasTag(FName(ANSI_TO_TCHAR(Tag)));
+			return ActorComponent->ComponentHasTag(FName(UTF8_TO_TCHAR(Tag)));
+		}
+
+		bool HasTagInterned(UActorComponent* ActorComponent, const InternedName* Tag) {
+			return ActorComponent->ComponentHasTag(*Tag);
 		}
 	}
 
@@ -1270,7 +1473,7 @@ namespace UnrealCLRFramework {
 		}
 
 		void BindAction(UInputComponent* InputComponent, const char* ActionName, InputEvent KeyEvent, bool ExecutedWhenPaused, InputDelegate Function) {
-			FInputActionBinding actionBinding(FName(ANSI_TO_TCHAR(ActionName)), KeyEvent);
+			FInputActionBinding actionBinding(FName(UTF8_TO_TCHAR(ActionName)), KeyEvent);
 
 			actionBinding.bExecuteWhenPaused = ExecutedWhenPaused;
 			actionBinding.ActionDelegate.GetDelegateForManualSet().BindLambda([Function]() {
@@ -1281,7 +1484,7 @@ namespace UnrealCLRFramework {
 		}
 
 		void BindAxis(UInputComponent* InputComponent, const char* AxisName, bool ExecutedWhenPaused, InputAxisDelegate Function) {
-			FInputAxisBinding axisBinding(FName(ANSI_TO_TCHAR(AxisName)));
+			FInputAxisBinding axisBinding(FName(UTF8_TO_TCHAR(AxisName)));
 
 			axisBinding.bExecuteWhenPaused = ExecutedWhenPaused;
 			axisBinding.AxisDelegate.GetDelegateForManualSet().BindLambda([Function](float AxisValue) {
@@ -1292,7 +1495,7 @@ namespace UnrealCLRFramework {
 		}
 
 		void RemoveActionBinding(UInputComponent* InputComponent, const char* ActionName, InputEvent KeyEvent) {
-			InputComponent->RemoveActionBinding(FName(ANSI_TO_TCHAR(ActionName)), KeyEvent);
+			InputComponent->RemoveActionBinding(FName(UTF8_TO_TCHAR(ActionName)), KeyEvent);
 		}
 
 		bool GetBlockInput(UInputComponent* InputComponent) {
@@ -1356,7 +1559,7 @@ namespace UnrealCLRFramework {
 				component->RegisterComponent();
 
 				if (Name)
-					component->Rename(*FString(ANSI_TO_TCHAR(Name)));
+					component->Rename(*FString(UTF8_TO_TCHAR(Name)));
 			}
 
 			return component;
@@ -1369,7 +1572,7 @@ namespace UnrealCLRFramework {
 			UNREALCLR_GET_ATTACHMENT_RULE(AttachmentRule, attachmentRules);
 
 			if (SocketName)
-				socketName = FName(ANSI_TO_TCHAR(SocketName));
+				socketName = FName(UTF8_TO_TCHAR(SocketName));
 
 			return SceneComponent->AttachToComponent(Parent, attachmentRules, socketName);
 		}
@@ -1505,6 +1708,41 @@ namespace UnrealCLRFramework {
 		void SetWorldTransform(USceneComponent* SceneComponent, const Transform* Transform) {
 			SceneComponent->SetWorldTransform(*Transform);
 		}
+
+		void GetComponentsLocations(USceneComponent** SceneComponents, int32 Count, Vector3* Values) {
+			for (int32 i = 0; i < Count; i++) {
+				Values[i] = SceneComponents[i]->GetComponentLocation();
+			}
+		}
+
+		void GetComponentsRotations(USceneComponent** SceneComponents, int32 Count, Quaternion* Values) {
+			for (int32 i = 0; i < Count; i++) {
+				Values[i] = SceneComponents[i]->GetComponentQuat();
+			}
+		}
+
+		void GetComponentsTransforms(USceneComponent** SceneComponents, int32 Count, Transform* Values) {
+			#if ENABLE_VECTORIZED_TRANSFORM
+				static_assert(sizeof(FTransform) == UnrealCLRConversion::EngineTransformFloats * sizeof(float) && sizeof(Transform) == UnrealCLRConversion::TransformFloats * sizeof(float), "Transform layouts are mirrored by the conversion kernels");
+
+				constexpr int32 chunkSize = 64;
+				const float* transforms[chunkSize];
+
+				for (int32 i = 0; i < Count; i += chunkSize) {
+					const int32 count = FMath::Min(Count - i, chunkSize);
+
+					for (int32 j = 0; j < count; j++) {
+						transforms[j] = reinterpret_cast<const float*>(&SceneComponents[i + j]->GetComponentTransform());
+					}
+
+					UnrealCLRConversion::TransformsFromEngine(transforms, reinterpret_cast<float*>(Values + i), count);
+				}
+			#else
+				for (int32 i = 0; i < Count; i++) {
+					Values[i] = SceneComponents[i]->GetComponentTransform();
+				}
+			#endif
+		}
 	}
 
 	namespace AudioComponent {
@@ -1754,6 +1992,45 @@ namespace UnrealCLRFramework {
 		UMaterialInstanceDynamic* CreateAndSetMaterialInstanceDynamic(UPrimitiveComponent* PrimitiveComponent, int32 ElementIndex) {
 			return PrimitiveComponent->CreateAndSetMaterialInstanceDynamic(ElementIndex);
 		}
+
+		void AddAngularImpulseInDegreesInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Impulse, const InternedName* BoneName, bool VelocityChange) {
+			PrimitiveComponent->AddAngularImpulseInDegrees(*Impulse, *BoneName, VelocityChange);
+		}
+
+		void AddAngularImpulseInRadiansInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Impulse, const InternedName* BoneName, bool VelocityChange) {
+			PrimitiveComponent->AddAngularImpulseInRadians(*Impulse, *BoneName, VelocityChange);
+		}
+
+		void AddForceInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Force, const InternedName* BoneName, bool AccelerationChange) {
+			PrimitiveComponent->AddForce(*Force, *BoneName, AccelerationChange);
+		}
+
+		void AddForceAtLocationInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Force, const Vector3* Location, const InternedName* BoneName, bool LocalSpace) {
+			if (!LocalSpace)
+				PrimitiveComponent->AddForceAtLocation(*Force, *Location, *BoneName);
+			else
+				PrimitiveComponent->AddForceAtLocationLocal(*Force, *Location, *BoneName);
+		}
+
+		void AddImpulseInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Impulse, const InternedName* BoneName, bool VelocityChange) {
+			PrimitiveComponent->AddImpulse(*Impulse, *BoneName, VelocityChange);
+		}
+
+		void AddImpulseAtLocationInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Impulse, const Vector3* Location, const InternedName* BoneName) {
+			PrimitiveComponent->AddImpulseAtLocation(*Impulse, *Location, *BoneName);
+		}
+
+		void AddTorqueInDegreesInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Torque, const InternedName* BoneName, bool AccelerationChange) {
+			PrimitiveComponent->AddTorqueInDegrees(*Torque, *BoneName, AccelerationChange);
+		}
+
+		void AddTorqueInRadiansInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Torque, const InternedName* BoneName, bool AccelerationChange) {
+			PrimitiveComponent->AddTorqueInRadians(*Torque, *BoneName, AccelerationChange);
+		}
+
+		void SetMassInterned(UPrimitiveComponent* PrimitiveComponent, float Mass, const InternedName* BoneName) {
+			PrimitiveComponent->SetMassOverrideInKg(*BoneName, Mass);
+		}
 	}
 
 	namespace ShapeComponent {
@@ -1850,7 +2127,7 @@ namespace UnrealCLRFramework {
 
 	namespace MeshComponent {
 		int32 GetMaterialIndex(UMeshComponent* MeshComponent, const char* MaterialSlotName) {
-			return MeshComponent->GetMaterialIndex(FName(ANSI_TO_TCHAR(MaterialSlotName)));
+			return MeshComponent->GetMaterialIndex(FName(UTF8_TO_TCHAR(MaterialSlotName)));
 		}
 	}
 
@@ -1904,6 +2181,25 @@ namespace UnrealCLRFramework {
 	}
 
 	namespace InstancedStaticMeshComponent {
+		#if ENABLE_VECTORIZED_TRANSFORM
+			// Transforms are converted in chunks on the stack, so a batch doesn't allocate and each chunk is consumed while it's still in the cache
+			template <typename Function>
+			static void ConvertTransforms(const Transform* InstanceTransforms, int32 Count, Function Consume) {
+				constexpr int32 chunkSize = 64;
+				alignas(16) float transforms[chunkSize * UnrealCLRConversion::EngineTransformFloats];
+
+				for (int32 i = 0; i < Count; i += chunkSize) {
+					const int32 count = FMath::Min(Count - i, chunkSize);
+
+					UnrealCLRConversion::TransformsToEngine(reinterpret_cast<const float*>(InstanceTransforms + i), transforms, count);
+
+					for (int32 j = 0; j < count; j++) {
+						Consume(i + j, reinterpret_cast<const FTransform*>(transforms)[j]);
+					}
+				}
+			}
+		#endif
+
 		int32 GetInstanceCount(UInstancedStaticMeshComponent* InstancedStaticMeshComponent) {
 			return InstancedStaticMeshComponent->GetInstanceCount();
 		}
@@ -1919,6 +2215,64 @@ namespace UnrealCLRFramework {
 		void ClearInstances(UInstancedStaticMeshComponent* InstancedStaticMeshComponent) {
 			InstancedStaticMeshComponent->ClearInstances();
 		}
+
+		int32 AddInstances(UInstancedStaticMeshComponent* InstancedStaticMeshComponent, const Transform* InstanceTransforms, int32 Count) {
+			const int32 firstIndex = InstancedStaticMeshComponent->GetInstanceCount();
+
+			InstancedStaticMeshComponent->PerInstanceSMData.Reserve(firstIndex + Count);
+
+			// The render state is recreated once for the whole batch instead of being marked dirty by each instance
+			FComponentRecreateRenderStateContext recreateRenderStateContext(InstancedStaticMeshComponent);
+
+			#if ENABLE_VECTORIZED_TRANSFORM
+				ConvertTransforms(InstanceTransforms, Count, [InstancedStaticMeshComponent](int32, const FTransform& InstanceTransform) {
+					InstancedStaticMeshComponent->AddInstance(InstanceTransform);
+				});
+			#else
+				for (int32 i = 0; i < Count; i++) {
+					InstancedStaticMeshComponent->AddInstance(InstanceTransforms[i]);
+				}
+			#endif
+
+			return firstIndex;
+		}
+
+		bool UpdateInstanceTransforms(UInstancedStaticMeshComponent* InstancedStaticMeshComponent, int32 StartIndex, const Transform* InstanceTransforms, int32 Count, bool WorldSpace, bool Teleport) {
+			bool result = true;
+
+			#if ENABLE_VECTORIZED_TRANSFORM
+				ConvertTransforms(InstanceTransforms, Count, [&](int32 Index, const FTransform& InstanceTransform) {
+					result &= InstancedStaticMeshComponent->UpdateInstanceTransform(StartIndex + Index, InstanceTransform, WorldSpace, false, Teleport);
+				});
+			#else
+				for (int32 i = 0; i < Count; i++) {
+					result &= InstancedStaticMeshComponent->UpdateInstanceTransform(StartIndex + i, InstanceTransforms[i], WorldSpace, false, Teleport);
+				}
+			#endif
+
+			InstancedStaticMeshComponent->MarkRenderStateDirty();
+
+			return result;
+		}
+
+		bool RemoveInstances(UInstancedStaticMeshComponent* InstancedStaticMeshComponent, const int32* InstanceIndices, int32 Count) {
+			TArray<int32> indices(InstanceIndices, Count);
+
+			indices.Sort(TGreater<int32>());
+
+			FComponentRecreateRenderStateContext recreateRenderStateContext(InstancedStaticMeshComponent);
+			bool result = true;
+
+			for (int32 i = 0; i < indices.Num(); i++) {
+				// Repeated indices are removed once, otherwise the instance shifted into the removed slot would be removed instead
+				if (i > 0 && indices[i] == indices[i - 1])
+					continue;
+
+				result &= InstancedStaticMeshComponent->RemoveInstance(indices[i]);
+			}
+
+			return result;
+		}
 	}
 
 	namespace SkinnedMeshComponent {
@@ -1985,15 +2339,242 @@ namespace UnrealCLRFramework {
 		}
 
 		void SetTextureParameterValue(UMaterialInstanceDynamic* MaterialInstanceDynamic, const char* ParameterName, UTexture* Value) {
-			MaterialInstanceDynamic->SetTextureParameterValue(FName(ANSI_TO_TCHAR(ParameterName)), Value);
+			MaterialInstanceDynamic->SetTextureParameterValue(FName(UTF8_TO_TCHAR(ParameterName)), Value);
 		}
 
 		void SetVectorParameterValue(UMaterialInstanceDynamic* MaterialInstanceDynamic, const char* ParameterName, const LinearColor* Value) {
-			MaterialInstanceDynamic->SetVectorParameterValue(FName(ANSI_TO_TCHAR(ParameterName)), *Value);
+			MaterialInstanceDynamic->SetVectorParameterValue(FName(UTF8_TO_TCHAR(ParameterName)), *Value);
 		}
 
 		void SetScalarParameterValue(UMaterialInstanceDynamic* MaterialInstanceDynamic, const char* ParameterName, float Value) {
-			MaterialInstanceDynamic->SetScalarParameterValue(FName(ANSI_TO_TCHAR(ParameterName)), Value);
+			MaterialInstanceDynamic->SetScalarParameterValue(FName(UTF8_TO_TCHAR(ParameterName)), Value);
+		}
+
+		void SetTextureParameterValueInterned(UMaterialInstanceDynamic* MaterialInstanceDynamic, const InternedName* ParameterName, UTexture* Value) {
+			MaterialInstanceDynamic->SetTextureParameterValue(*ParameterName, Value);
+		}
+
+		void SetVectorParameterValueInterned(UMaterialInstanceDynamic* MaterialInstanceDynamic, const InternedName* ParameterName, const LinearColor* Value) {
+			MaterialInstanceDynamic->SetVectorParameterValue(*ParameterName, *Value);
+		}
+
+		void SetScalarParameterValueInterned(UMaterialInstanceDynamic* MaterialInstanceDynamic, const InternedName* ParameterName, float Value) {
+			MaterialInstanceDynamic->SetScalarParameterValue(*ParameterName, Value);
 		}
 	}
+
+	namespace CommandBuffer {
+		void Execute(const Command* Commands, int32 Count) {
+			static_assert(sizeof(Command) == 56, "Command layout is mirrored by the managed side");
+
+			for (int32 i = 0; i < Count; i++) {
+				const Command& Current = Commands[i];
+
+				// Objects are referenced by index and serial number, so the ones collected after recording are never dereferenced
+				FUObjectItem* item = Current.ObjectIndex >= 0 ? GUObjectArray.IndexToObject(Current.ObjectIndex) : nullptr;
+
+				if (!item || item->GetSerialNumber() != Current.SerialNumber || item->IsUnreachable() || !IsValid(static_cast<UObject*>(item->Object)))
+					continue;
+
+				UObject* object = static_cast<UObject*>(item->Object);
+
+				switch (Current.Type) {
+					case CommandType::AddLocalOffset:
+						SceneComponent::AddLocalOffset(static_cast<USceneComponent*>(object), Current.Get<Vector3>());
+						break;
+
+					case CommandType::AddLocalRotation:
+						SceneComponent::AddLocalRotation(static_cast<USceneComponent*>(object), Current.Get<Quaternion>());
+						break;
+
+					case CommandType::AddRelativeLocation:
+						SceneComponent::AddRelativeLocation(static_cast<USceneComponent*>(object), Current.Get<Vector3>());
+						break;
+
+					case CommandType::AddRelativeRotation:
+						SceneComponent::AddRelativeRotation(static_cast<USceneComponent*>(object), Current.Get<Quaternion>());
+						break;
+
+					case CommandType::AddLocalTransform:
+						SceneComponent::AddLocalTransform(static_cast<USceneComponent*>(object), Current.Get<Transform>());
+						break;
+
+					case CommandType::AddWorldOffset:
+						SceneComponent::AddWorldOffset(static_cast<USceneComponent*>(object), Current.Get<Vector3>());
+						break;
+
+					case CommandType::AddWorldRotation:
+						SceneComponent::AddWorldRotation(static_cast<USceneComponent*>(object), Current.Get<Quaternion>());
+						break;
+
+					case CommandType::AddWorldTransform:
+						SceneComponent::AddWorldTransform(static_cast<USceneComponent*>(object), Current.Get<Transform>());
+						break;
+
+					case CommandType::SetRelativeLocation:
+						SceneComponent::SetRelativeLocation(static_cast<USceneComponent*>(object), Current.Get<Vector3>());
+						break;
+
+					case CommandType::SetRelativeRotation:
+						SceneComponent::SetRelativeRotation(static_cast<USceneComponent*>(object), Current.Get<Quaternion>());
+						break;
+
+					case CommandType::SetRelativeTransform:
+						SceneComponent::SetRelativeTransform(static_cast<USceneComponent*>(object), Current.Get<Transform>());
+						break;
+
+					case CommandType::SetWorldLocation:
+						SceneComponent::SetWorldLocation(static_cast<USceneComponent*>(object), Current.Get<Vector3>());
+						break;
+
+					case CommandType::SetWorldRotation:
+						SceneComponent::SetWorldRotation(static_cast<USceneComponent*>(object), Current.Get<Quaternion>());
+						break;
+
+					case CommandType::SetWorldTransform:
+						SceneComponent::SetWorldTransform(static_cast<USceneComponent*>(object), Current.Get<Transform>());
+						break;
+
+					case CommandType::AddAngularImpulseInDegrees:
+						PrimitiveComponent::AddAngularImpulseInDegreesInterned(static_cast<UPrimitiveComponent*>(object), Current.Get<Vector3>(), Current.Get<InternedName>(24), Current.Flags != 0);
+						break;
+
+					case CommandType::AddAngularImpulseInRadians:
+						PrimitiveComponent::AddAngularImpulseInRadiansInterned(static_cast<UPrimitiveComponent*>(object), Current.Get<Vector3>(), Current.Get<InternedName>(24), Current.Flags != 0);
+						break;
+
+					case CommandType::AddForce:
+						PrimitiveComponent::AddForceInterned(static_cast<UPrimitiveComponent*>(object), Current.Get<Vector3>(), Current.Get<InternedName>(24), Current.Flags != 0);
+						break;
+
+					case CommandType::AddForceAtLocation:
+						PrimitiveComponent::AddForceAtLocationInterned(static_cast<UPrimitiveComponent*>(object), Current.Get<Vector3>(), Current.Get<Vector3>(12), Current.Get<InternedName>(24), Current.Flags != 0);
+						break;
+
+					case CommandType::AddImpulse:
+						PrimitiveComponent::AddImpulseInterned(static_cast<UPrimitiveComponent*>(object), Current.Get<Vector3>(), Current.Get<InternedName>(24), Current.Flags != 0);
+						break;
+
+					case CommandType::AddImpulseAtLocation:
+						PrimitiveComponent::AddImpulseAtLocationInterned(static_cast<UPrimitiveComponent*>(object), Current.Get<Vector3>(), Current.Get<Vector3>(12), Current.Get<InternedName>(24));
+						break;
+
+					case CommandType::AddTorqueInDegrees:
+						PrimitiveComponent::AddTorqueInDegreesInterned(static_cast<UPrimitiveComponent*>(object), Current.Get<Vector3>(), Current.Get<InternedName>(24), Current.Flags != 0);
+						break;
+
+					case CommandType::AddTorqueInRadians:
+						PrimitiveComponent::AddTorqueInRadiansInterned(static_cast<UPrimitiveComponent*>(object), Current.Get<Vector3>(), Current.Get<InternedName>(24), Current.Flags != 0);
+						break;
+
+					case CommandType::Hide:
+						Actor::Hide(static_cast<AActor*>(object), Current.Flags != 0);
+						break;
+
+					case CommandType::SetEnableCollision:
+						Actor::SetEnableCollision(static_cast<AActor*>(object), Current.Flags != 0);
+						break;
+
+					case CommandType::TeleportTo:
+						Actor::TeleportTo(static_cast<AActor*>(object), Current.Get<Vector3>(), Current.Get<Quaternion>(12), false, Current.Flags != 0);
+						break;
+
+					default:
+						checkNoEntry();
+				}
+			}
+		}
+	}
+
+	namespace TickFunction {
+		ManagedTickFunction* Register(TickExecuteDelegate Execute, TickDelegate Function, TickGroup Group, float Interval, bool TickEvenWhenPaused) {
+			if (!UnrealCLR::Engine::World || !UnrealCLR::Engine::World->PersistentLevel)
+				return nullptr;
+
+			ManagedTickFunction* tickFunction = UnrealCLR::TickFunctions::Functions.Add_GetRef(MakeUnique<ManagedTickFunction>()).Get();
+
+			tickFunction->Execute = Execute;
+			tickFunction->Function = Function;
+			tickFunction->TickGroup = Group;
+			tickFunction->TickInterval = Interval;
+			tickFunction->bCanEverTick = true;
+			tickFunction->bTickEvenWhenPaused = TickEvenWhenPaused;
+			tickFunction->RegisterTickFunction(UnrealCLR::Engine::World->PersistentLevel);
+
+			return tickFunction;
+		}
+
+		void Unregister(ManagedTickFunction* TickFunction) {
+			UnrealCLR::TickFunctions::Remove(TickFunction);
+		}
+
+		bool IsRegistered(ManagedTickFunction* TickFunction) {
+			return UnrealCLR::TickFunctions::Contains(TickFunction);
+		}
+
+		bool IsEnabled(ManagedTickFunction* TickFunction) {
+			return TickFunction->IsTickFunctionEnabled();
+		}
+
+		float GetInterval(ManagedTickFunction* TickFunction) {
+			return TickFunction->TickInterval;
+		}
+
+		void SetEnabled(ManagedTickFunction* TickFunction, bool Value) {
+			TickFunction->SetTickFunctionEnable(Value);
+		}
+
+		void SetInterval(ManagedTickFunction* TickFunction, float Value) {
+			TickFunction->UpdateTickIntervalAndCoolDown(Value);
+		}
+
+		void AddPrerequisite(ManagedTickFunction* TickFunction, ManagedTickFunction* Prerequisite) {
+			TickFunction->AddPrerequisite(UnrealCLR::Engine::World, *Prerequisite);
+		}
+
+		void AddActorPrerequisite(ManagedTickFunction* TickFunction, AActor* Prerequisite) {
+			TickFunction->AddPrerequisite(Prerequisite, Prerequisite->PrimaryActorTick);
+		}
+
+		void AddComponentPrerequisite(ManagedTickFunction* TickFunction, UActorComponent* Prerequisite) {
+			TickFunction->AddPrerequisite(Prerequisite, Prerequisite->PrimaryComponentTick);
+		}
+
+		void RemovePrerequisite(ManagedTickFunction* TickFunction, ManagedTickFunction* Prerequisite) {
+			TickFunction->RemovePrerequisite(UnrealCLR::Engine::World, *Prerequisite);
+		}
+
+		void RemoveActorPrerequisite(ManagedTickFunction* TickFunction, AActor* Prerequisite) {
+			TickFunction->RemovePrerequisite(Prerequisite, Prerequisite->PrimaryActorTick);
+		}
+
+		void RemoveComponentPrerequisite(ManagedTickFunction* TickFunction, UActorComponent* Prerequisite) {
+			TickFunction->RemovePrerequisite(Prerequisite, Prerequisite->PrimaryComponentTick);
+		}
+	}
+
+	namespace GameThread {
+		void SetDispatcher(DispatchDelegate Function) {
+			UnrealCLR::GameThread::Dispatchers.AddUnique(Function);
+		}
+	}
+
+	namespace Statistics {
+		void Register(const char** Tables, const char** Functions, const InteropCounter** Counters, int32 Count, int64 Frequency) {
+			UnrealCLR::Statistics::MillisecondsPerTick = 1000.0 / Frequency;
+
+			for (int32 i = 0; i < Count; i++) {
+				UnrealCLR::Statistics::Add(UTF8_TO_TCHAR(Tables[i]), UTF8_TO_TCHAR(Functions[i]), Counters[i]);
+			}
+		}
+	}
+
+	void ManagedTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) {
+		if (UnrealCLR::Status == UnrealCLR::StatusType::Running)
+			Execute(Function, DeltaTime);
+	}
+
+	FString ManagedTickFunction::DiagnosticMessage() {
+		return TEXT("UnrealCLR managed tick function");
+	}
 }
\ No newline at end of file
@@ -33,4 +33,54 @@ FManagedFunction UUnrealCLRLibrary::LoadAssemblyFunction(FString AssemblyPath, F
 	}
 
 	return managedFunction;
+}
+
+TMap<FString, FManagedFunction> UUnrealCLRLibrary::LoadAssemblyFunctions(FString AssemblyPath, const TArray<FString>& FunctionNames, bool Optional) {
+	TMap<FString, FManagedFunction> managedFunctions;
+
+	if (UnrealCLR::Status == UnrealCLR::StatusType::Running && FunctionNames.Num() > 0) {
+		FString assemblyPath = UnrealCLR::UserAssembliesPath + AssemblyPath;
+		TArray<const char_t*> functionNames;
+		TArray<void*> functions;
+
+		functionNames.Reserve(FunctionNames.Num());
+		functions.SetNumZeroed(FunctionNames.Num());
+
+		for (const FString& functionName : FunctionNames) {
+			functionNames.Add(*functionName);
+		}
+
+		UnrealCLR::LoadAssemblyFunctions(*assemblyPath, functionNames.GetData(), functionNames.Num(), functions.GetData(), Optional);
+
+		managedFunctions.Reserve(FunctionNames.Num());
+
+		for (int32 i = 0; i < FunctionNames.Num(); i++) {
+			FManagedFunction& managedFunction = managedFunctions.Add(FunctionNames[i]);
+
+			managedFunction.Pointer = functions[i];
+		}
+	}
+
+	return managedFunctions;
+}
+
+TMap<FString, FManagedFunction> UUnrealCLRLibrary::LoadAssemblyManifest(FString AssemblyPath, FString ManifestPath, bool Optional) {
+	TArray<FString> lines;
+	TArray<FString> functionNames;
+
+	if (!FFileHelper::LoadFileToStringArray(lines, *(UnrealCLR::UserAssembliesPath + ManifestPath))) {
+		if (!Optional)
+			UE_LOG(LogUnrealCLR, Error, TEXT("%s: Unable to read manifest file at %s"), ANSI_TO_TCHAR(__FUNCTION__), *(UnrealCLR::UserAssembliesPath + ManifestPath));
+
+		return TMap<FString, FManagedFunction>();
+	}
+
+	for (FString& line : lines) {
+		line.TrimStartAndEndInline();
+
+		if (!line.IsEmpty() && !line.StartsWith(TEXT("#")))
+			functionNames.Add(MoveTemp(line));
+	}
+
+	return LoadAssemblyFunctions(AssemblyPath, functionNames, Optional);
 }
\ No newline at end of file
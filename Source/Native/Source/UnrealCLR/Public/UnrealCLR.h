@@ -20,9 +20,11 @@
 // @third party code - END CoreCLR
 
 #include "AIController.h"
+#include "Async/Async.h"
 #include "Animation/AnimInstance.h"
 #include "Camera/CameraActor.h"
 #include "Camera/CameraComponent.h"
+#include "ComponentRecreateRenderStateContext.h"
 #include "Components/AudioComponent.h"
 #include "Components/BoxComponent.h"
 #include "Components/CapsuleComponent.h"
@@ -39,6 +41,7 @@
 #include "Engine/PointLight.h"
 #include "Engine/RectLight.h"
 #include "Engine/SpotLight.h"
+#include "Engine/StreamableManager.h"
 #include "EngineUtils.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Character.h"
@@ -47,12 +50,15 @@
 #include "HeadMountedDisplayFunctionLibrary.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Misc/DefaultValueHelper.h"
+#include "Misc/FileHelper.h"
 #include "Modules/ModuleManager.h"
 #include "MotionControllerComponent.h"
 #include "Sound/AmbientSound.h"
 #include "UnrealEngine.h"
 
+#include "UnrealCLRConversion.h"
 #include "UnrealCLRFramework.h"
+#include "UnrealCLRHost.h"
 #include "UnrealCLRLibrary.h"
 
 #if WITH_EDITOR
@@ -67,6 +73,9 @@
 
 UNREALCLR_API DECLARE_LOG_CATEGORY_EXTERN(LogUnrealCLR, Log, All);
 
+DECLARE_STATS_GROUP(TEXT("UnrealCLR"), STATGROUP_UnrealCLR, STATCAT_Advanced);
+DECLARE_STATS_GROUP(TEXT("UnrealCLR Interop"), STATGROUP_UnrealCLRInterop, STATCAT_Advanced);
+
 namespace UnrealCLR {
 	enum class StatusType : int32 {
 		Stopped,
@@ -74,19 +83,10 @@ namespace UnrealCLR {
 		Running
 	};
 
-	enum class LogLevel : int32 {
-		Display,
-		Warning,
-		Error
-	};
-
-	typedef void (*ExecuteAssemblyFunctionDelegate)(void*);
-	typedef void* (*LoadAssemblyFunctionDelegate)(const char_t* AssemblyPath, const char_t* TypeName, const char_t* MethodName, int8_t Optional);
-	typedef void (*UnloadAssembliesDelegate)();
-
 	static ExecuteAssemblyFunctionDelegate ExecuteAssemblyFunction;
 	static LoadAssemblyFunctionDelegate LoadAssemblyFunction;
 	static UnloadAssembliesDelegate UnloadAssemblies;
+	static LoadAssemblyFunctionsDelegate LoadAssemblyFunctions;
 	static FString ProjectPath;
 	static FString UserAssembliesPath;
 	static StatusType Status = StatusType::Stopped;
@@ -99,23 +99,170 @@ namespace UnrealCLR {
 
 		private:
 
+		struct StartupTimings {
+			double HostLibraryLoad;
+			double RuntimeInitialization;
+			double RuntimeAssemblyLoad;
+			double TableBinding;
+			double RuntimeAssemblyInitialization;
+		};
+
+		void LoadHost();
+		void WaitForHost();
 		void OnPreWorldInitialization(UWorld* World, const UWorld::InitializationValues InitializationValues);
 		void OnWorldCleanup(UWorld* World, bool SessionEnded, bool CleanupResources);
+		void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaTime);
+		void OnActorSpawned(AActor* Actor);
+		void OnActorDeleted(AActor* Actor);
 
 		static void HostError(const char_t* Message);
 		static void Invoke(void(*)());
 		static void Exception(const char* Message);
 		static void Log(UnrealCLR::LogLevel Level, const char* Message);
+		static void AddOnScreenMessage(const FColor& Color, const char* Message);
 
 		void* HostfxrLibrary;
+		TFuture<void> HostTask;
+		StartupTimings Timings = { };
 		FDelegateHandle OnPreWorldInitializationHandle;
 		FDelegateHandle OnWorldCleanupHandle;
+		FDelegateHandle OnWorldTickStartHandle;
+		FDelegateHandle OnActorSpawnedHandle;
+		FDelegateHandle OnActorDeletedHandle;
 	};
 
 	namespace Engine {
 		static UWorld* World;
 	}
 
+	namespace ActorIndex {
+		// Actors of each name or tag are bucketed by their exact class, so typed lookups test each class once instead of each actor
+		typedef TMap<UClass*, TArray<TWeakObjectPtr<AActor>>> Classes;
+
+		static void Build();
+		static void Clear();
+		static void Add(AActor* Actor, bool Unique = true);
+		static void Remove(AActor* Actor);
+		static AActor* Find(Classes& Buckets, const FName& Key, bool Tag, UClass* Type);
+		static AActor* FindByName(const FName& Name, UClass* Type);
+		static AActor* FindByTag(const FName& Tag, UClass* Type);
+
+		static bool Built;
+		static TMap<FName, Classes> Names;
+		static TMap<FName, Classes> Tags;
+	}
+
+	namespace ComponentIndex {
+		struct Entry {
+			bool Valid;
+			int32 Count;
+			int32 Generation;
+			TArray<TWeakObjectPtr<UActorComponent>> Components;
+			TMap<FName, int32> Names;
+			TMap<UClass*, TArray<int32>> Types;
+		};
+
+		// Components created by the engine or blueprints invalidate the entry of their actor, components created on other threads and deleted objects invalidate all entries
+		class Listener : public FUObjectArray::FUObjectCreateListener, public FUObjectArray::FUObjectDeleteListener {
+			public:
+
+			virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override;
+			virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override;
+			virtual void OnUObjectArrayShutdown() override;
+		};
+
+		static Entry& Get(AActor* Actor, bool* Rebuilt = nullptr);
+		static UActorComponent* Find(AActor* Actor, const FName& Name, UClass* Type);
+		static int32 FindAll(AActor* Actor, UClass* Type, UActorComponent** Components, int32 Capacity);
+		static void Invalidate(AActor* Actor);
+		static void Remove(AActor* Actor);
+		static void Start();
+		static void Stop();
+		static void Clear();
+
+		static TMap<TWeakObjectPtr<AActor>, Entry> Entries;
+		static FThreadSafeCounter Generation;
+		static Listener ObjectListener;
+		static bool Listening;
+	}
+
+	namespace AssetLoader {
+		struct Request {
+			UnrealCLRFramework::ObjectType Type;
+			UnrealCLRFramework::LoadAsyncDelegate Function;
+			TArray<FSoftObjectPath> Paths;
+			TSharedPtr<FStreamableHandle> Handle;
+		};
+
+		static UClass* GetClass(UnrealCLRFramework::ObjectType Type);
+		static FSoftObjectPath GetPath(UnrealCLRFramework::ObjectType Type, const char* Name);
+		static void Start(int32 Id, UnrealCLRFramework::ObjectType Type, const char** Names, int32 Count, UnrealCLRFramework::LoadAsyncDelegate Function);
+		static void Complete(int32 Id);
+		static void Cancel(int32 Id);
+		static void Clear();
+
+		static TUniquePtr<FStreamableManager> Manager;
+		static TMap<int32, Request> Requests;
+	}
+
+	namespace TickFunctions {
+		static bool Contains(UnrealCLRFramework::ManagedTickFunction* TickFunction);
+		static void Remove(UnrealCLRFramework::ManagedTickFunction* TickFunction);
+		static void Release();
+		static void Clear();
+
+		static TArray<TUniquePtr<UnrealCLRFramework::ManagedTickFunction>> Functions;
+		static TArray<TUniquePtr<UnrealCLRFramework::ManagedTickFunction>> Removed;
+	}
+
+	namespace GameThread {
+		static void Drain();
+
+		static void Clear();
+
+		static TArray<UnrealCLRFramework::DispatchDelegate> Dispatchers;
+	}
+
+	namespace Logger {
+		constexpr int32 Capacity = 4096;
+		constexpr int32 SlotSize = 128;
+
+		static void Drain();
+
+		static UnrealCLRFramework::LogEntry Entries[Capacity];
+		static uint8 Payload[Capacity * SlotSize];
+		static UnrealCLRFramework::LogBuffer Buffer = { 0, 0, 0, Capacity, SlotSize, 0, Entries, Payload, &GFrameCounter };
+		static TArray<uint8> Scratch;
+	}
+
+	namespace Statistics {
+		struct TableEntry {
+			FString Name;
+			int64 Calls;
+			int64 Ticks;
+			FName CallsStat;
+			FName TimeStat;
+		};
+
+		struct Entry {
+			TArray<const UnrealCLRFramework::InteropCounter*, TInlineAllocator<1>> Counters;
+			int32 Table;
+			int64 Calls;
+			int64 Ticks;
+			FName CallsStat;
+			FName TimeStat;
+		};
+
+		static void Add(const FString& Table, const FString& Function, const UnrealCLRFramework::InteropCounter* Counter);
+		static void Publish();
+		static void Clear();
+
+		static double MillisecondsPerTick;
+		static TArray<TableEntry> Tables;
+		static TArray<Entry> Entries;
+		static TMap<FString, int32> Functions;
+	}
+
 	namespace Shared {
 		constexpr int32 storageSize = 64;
 
@@ -123,6 +270,7 @@ namespace UnrealCLR {
 		void* CommandLineFunctions[storageSize];
 		void* DebugFunctions[storageSize];
 		void* ObjectFunctions[storageSize];
+		void* NameFunctions[storageSize];
 		void* ApplicationFunctions[storageSize];
 		void* ConsoleManagerFunctions[storageSize];
 		void* EngineFunctions[storageSize];
@@ -162,15 +310,20 @@ namespace UnrealCLR {
 		void* MaterialFunctions[storageSize];
 		void* MaterialInstanceFunctions[storageSize];
 		void* MaterialInstanceDynamicFunctions[storageSize];
+		void* CommandBufferFunctions[storageSize];
+		void* TickFunctionFunctions[storageSize];
+		void* GameThreadFunctions[storageSize];
+		void* StatisticsFunctions[storageSize];
 		void* HeadMountedDisplayFunctions[storageSize];
 
 		void* ManagedFunctions[3];
-		void* NativeFunctions[3];
+		void* NativeFunctions[4];
 		void* Functions[128];
 	}
 
 	namespace Utility {
-		FORCEINLINE static size_t Strcpy(char* Destination, const char* Source, size_t Length);
-		FORCEINLINE static size_t Strlen(const char* Source);
+		static const char* Encode(const TCHAR* Source);
+
+		static TArray<char> StringBuffer;
 	}
 }
\ No newline at end of file
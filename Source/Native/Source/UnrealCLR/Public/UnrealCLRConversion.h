@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020 Stanislav Denisov (nxrighthere@gmail.com)
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU Lesser General Public License
+ * (LGPL) version 3 with a static linking exception which accompanies this
+ * distribution.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// Batch conversion between the managed and the engine layouts of transforms, shared with the standalone harness and therefore independent of the engine
+//
+// Managed layout is packed: Transform { Location, Rotation, Scale } of 10 floats
+// Engine layout follows the implicit conversions of UnrealCLRFramework.h: the vectorized FTransform { Rotation, Translation, Scale3D } of 16-byte registers with zero W, where vectors are FVector(Z, X, Y) and quaternions are FQuat(Z, X, Y, W)
+// Single vectors and quaternions, such as the payloads of commands, are converted by the implicit conversions since there is nothing to batch
+namespace UnrealCLRConversion {
+	enum class InstructionSet : int32_t {
+		Scalar,
+		SSE
+	};
+
+	constexpr int32_t TransformFloats = 10;
+	constexpr int32_t EngineTransformFloats = 12;
+
+	// Returns the instruction set of the kernels below
+	InstructionSet GetInstructionSet();
+
+	void TransformsToEngine(const float* Source, float* Destination, int32_t Count);
+	void TransformsFromEngine(const float* Source, float* Destination, int32_t Count);
+
+	// Gathers transforms which are not contiguous in the engine, such as transforms of components
+	void TransformsFromEngine(const float* const* Sources, float* Destination, int32_t Count);
+
+	// Reference implementations equivalent to the per-element conversions, also used on platforms without SSE
+	namespace Scalar {
+		void TransformsToEngine(const float* Source, float* Destination, int32_t Count);
+		void TransformsFromEngine(const float* Source, float* Destination, int32_t Count);
+		void TransformsFromEngine(const float* const* Sources, float* Destination, int32_t Count);
+	}
+}
\ No newline at end of file
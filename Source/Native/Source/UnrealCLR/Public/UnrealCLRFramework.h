@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include "UnrealCLRInterop.h"
+
 UNREALCLR_API DECLARE_LOG_CATEGORY_EXTERN(LogUnrealManaged, Log, All);
 UNREALCLR_API DECLARE_LOG_CATEGORY_EXTERN(LogUnrealAssert, Log, All);
 
@@ -24,26 +26,7 @@ namespace UnrealCLRFramework {
 	using WindowMode = EWindowMode::Type;
 	using InputEvent = EInputEvent;
 	using NetMode = ENetMode;
-
-	enum struct LogLevel : int32 {
-		Display,
-		Warning,
-		Error,
-		Fatal
-	};
-
-	enum struct ComponentMobility : int32 {
-		Movable,
-		Static,
-		Stationary
-	};
-
-	enum struct AttachmentTransformRule : int32 {
-		KeepRelativeTransform,
-		KeepWorldTransform,
-		SnapToTargetIncludingScale,
-		SnapToTargetNotIncludingScale
-	};
+	using TickGroup = ETickingGroup;
 
 	enum struct TeleportType : int32 {
 		None,
@@ -159,14 +142,31 @@ namespace UnrealCLRFramework {
 		FORCEINLINE operator FTransform() const { return FTransform(Rotation, Location, Scale); }
 	};
 
+	// Identity follows the comparison index like the engine names, the display index is kept to restore the original spelling in case-preserving builds
+	struct InternedName {
+		uint32 Id;
+		uint32 DisplayId;
+		int32 Number;
+
+		FORCEINLINE InternedName(const FName& Value) {
+			Id = Value.GetComparisonIndex().ToUnstableInt();
+			DisplayId = Value.GetDisplayIndex().ToUnstableInt();
+			Number = Value.GetNumber();
+		}
+
+		FORCEINLINE operator FName() const { return FName::CreateFromDisplayId(FNameEntryId::FromUnstableInt(DisplayId), Number); }
+	};
+
+	static_assert(sizeof(InternedName) == 12 && 24 + sizeof(InternedName) <= sizeof(Command::Payload), "Interned name layout is mirrored by the managed side");
+
 	typedef void (*InputDelegate)();
 
 	typedef void (*InputAxisDelegate)(float);
 
-	typedef void (*ConsoleVariableDelegate)();
-
 	typedef void (*ConsoleCommandDelegate)(float);
 
+	typedef void (*LoadAsyncDelegate)(int32, UObject**, int32);
+
 	// Enumerable
 
 	enum struct ObjectType : int32 {
@@ -180,38 +180,19 @@ namespace UnrealCLRFramework {
 		Texture2D
 	};
 
-	enum struct ActorType : int32 {
-		Base,
-		Camera,
-		Pawn,
-		Character,
-		AIController,
-		PlayerController,
-		Brush,
-		AmbientSound,
-		DirectionalLight,
-		PointLight,
-		RectLight,
-		SpotLight
+	struct PropertyHandle {
+		FProperty* Property;
+		UClass* Class;
+		int32 Offset;
+		PropertyType Type;
 	};
 
-	enum struct ComponentType : int32 {
-		// Non-attachable
-		Actor,
-		Input,
-		// Attachable
-		Scene,
-		Audio,
-		Camera,
-		Light,
-		DirectionalLight,
-		MotionController,
-		StaticMesh,
-		InstancedStaticMesh,
-		Box,
-		Sphere,
-		Capsule,
-		SkeletalMesh
+	struct ManagedTickFunction : public FTickFunction {
+		TickExecuteDelegate Execute;
+		TickDelegate Function;
+
+		virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+		virtual FString DiagnosticMessage() override;
 	};
 
 	// Non-instantiable
@@ -221,7 +202,7 @@ namespace UnrealCLRFramework {
 	}
 
 	namespace CommandLine {
-		static void Get(char* Arguments);
+		static const char* Get();
 		static void Set(const char* Arguments);
 		static void Append(const char* Arguments);
 	}
@@ -239,6 +220,7 @@ namespace UnrealCLRFramework {
 		static void DrawLine(const Vector3* Start, const Vector3* End, Color Color, bool PersistentLines, float LifeTime, uint8 DepthPriority, float Thickness);
 		static void DrawPoint(const Vector3* Location, float Size, Color Color, bool PersistentLines, float LifeTime, uint8 DepthPriority);
 		static void FlushPersistentLines();
+		static LogBuffer* GetLogBuffer();
 	}
 
 	namespace Object {
@@ -246,7 +228,7 @@ namespace UnrealCLRFramework {
 		static bool IsValid(UObject* Object);
 		static UObject* Load(ObjectType Type, const char* Name);
 		static void Rename(UObject* Object, const char* Name);
-		static void GetName(UObject* Object, char* Name);
+		static const char* GetName(UObject* Object);
 		static bool GetBool(UObject* Object, const char* Name, bool* value);
 		static bool GetByte(UObject* Object, const char* Name, int8* Value);
 		static bool GetShort(UObject* Object, const char* Name, int16* Value);
@@ -257,7 +239,7 @@ namespace UnrealCLRFramework {
 		static bool GetULong(UObject* Object, const char* Name, uint64* Value);
 		static bool GetFloat(UObject* Object, const char* Name, float* Value);
 		static bool GetDouble(UObject* Object, const char* Name, double* Value);
-		static bool GetText(UObject* Object, const char* Name, char* Value);
+		static const char* GetText(UObject* Object, const char* Name);
 		static bool SetBool(UObject* Object, const char* Name, bool value);
 		static bool SetByte(UObject* Object, const char* Name, int8 Value);
 		static bool SetShort(UObject* Object, const char* Name, int16 Value);
@@ -269,15 +251,48 @@ namespace UnrealCLRFramework {
 		static bool SetFloat(UObject* Object, const char* Name, float Value);
 		static bool SetDouble(UObject* Object, const char* Name, double Value);
 		static bool SetText(UObject* Object, const char* Name, const char* Value);
+		static bool GetBoolInterned(UObject* Object, const InternedName* Name, bool* Value);
+		static bool GetByteInterned(UObject* Object, const InternedName* Name, int8* Value);
+		static bool GetShortInterned(UObject* Object, const InternedName* Name, int16* Value);
+		static bool GetIntInterned(UObject* Object, const InternedName* Name, int32* Value);
+		static bool GetLongInterned(UObject* Object, const InternedName* Name, int64* Value);
+		static bool GetUShortInterned(UObject* Object, const InternedName* Name, uint16* Value);
+		static bool GetUIntInterned(UObject* Object, const InternedName* Name, uint32* Value);
+		static bool GetULongInterned(UObject* Object, const InternedName* Name, uint64* Value);
+		static bool GetFloatInterned(UObject* Object, const InternedName* Name, float* Value);
+		static bool GetDoubleInterned(UObject* Object, const InternedName* Name, double* Value);
+		static const char* GetTextInterned(UObject* Object, const InternedName* Name);
+		static bool SetBoolInterned(UObject* Object, const InternedName* Name, bool Value);
+		static bool SetByteInterned(UObject* Object, const InternedName* Name, int8 Value);
+		static bool SetShortInterned(UObject* Object, const InternedName* Name, int16 Value);
+		static bool SetIntInterned(UObject* Object, const InternedName* Name, int32 Value);
+		static bool SetLongInterned(UObject* Object, const InternedName* Name, int64 Value);
+		static bool SetUShortInterned(UObject* Object, const InternedName* Name, uint16 Value);
+		static bool SetUIntInterned(UObject* Object, const InternedName* Name, uint32 Value);
+		static bool SetULongInterned(UObject* Object, const InternedName* Name, uint64 Value);
+		static bool SetFloatInterned(UObject* Object, const InternedName* Name, float Value);
+		static bool SetDoubleInterned(UObject* Object, const InternedName* Name, double Value);
+		static bool SetTextInterned(UObject* Object, const InternedName* Name, const char* Value);
+		static FUObjectItem* GetItem(UObject* Object, int32* Index, int32* SerialNumber, UClass** Class);
+		static bool GetPropertyHandle(UObject* Object, const char* Name, PropertyHandle* Result);
+		static const char* GetTextByHandle(UObject* Object, FTextProperty* Property);
+		static void SetTextByHandle(UObject* Object, FTextProperty* Property, const char* Value);
+		static void LoadAsync(int32 Request, ObjectType Type, const char** Names, int32 Count, LoadAsyncDelegate Function);
+		static void CancelLoadAsync(int32 Request);
+	}
+
+	namespace Name {
+		static void Create(const char* Value, InternedName* Result);
+		static const char* GetString(const InternedName* Value);
 	}
 
 	namespace Application {
 		static bool IsCanEverRender();
 		static bool IsPackagedForDistribution();
 		static bool IsPackagedForShipping();
-		static void GetProjectDirectory(char* Directory);
-		static void GetDefaultLanguage(char* Language);
-		static void GetProjectName(char* ProjectName);
+		static const char* GetProjectDirectory();
+		static const char* GetDefaultLanguage();
+		static const char* GetProjectName();
 		static float GetVolumeMultiplier();
 		static void SetProjectName(const char* ProjectName);
 		static void SetVolumeMultiplier(float Value);
@@ -304,7 +319,7 @@ namespace UnrealCLRFramework {
 		static void GetViewportSize(Vector2* Value);
 		static void GetScreenResolution(Vector2* Value);
 		static WindowMode GetWindowMode();
-		static void GetVersion(char* Version);
+		static const char* GetVersion();
 		static float GetMaxFPS();
 		static void SetMaxFPS(float MaxFPS);
 		static void SetTitle(const char* Title);
@@ -317,7 +332,7 @@ namespace UnrealCLRFramework {
 
 	namespace HeadMountedDisplay {
 		static bool IsEnabled();
-		static void GetDeviceName(char* Name);
+		static const char* GetDeviceName();
 	}
 
 	namespace World {
@@ -348,7 +363,7 @@ namespace UnrealCLRFramework {
 		static bool GetBool(IConsoleVariable* ConsoleVariable);
 		static int32 GetInt(IConsoleVariable* ConsoleVariable);
 		static float GetFloat(IConsoleVariable* ConsoleVariable);
-		static void GetString(IConsoleVariable* ConsoleVariable, char* Value);
+		static const char* GetString(IConsoleVariable* ConsoleVariable);
 		static void SetBool(IConsoleVariable* ConsoleVariable, bool Value);
 		static void SetInt(IConsoleVariable* ConsoleVariable, int32 Value);
 		static void SetFloat(IConsoleVariable* ConsoleVariable, float Value);
@@ -380,6 +395,8 @@ namespace UnrealCLRFramework {
 		static void AddTag(AActor* Actor, const char* Tag);
 		static void RemoveTag(AActor* Actor, const char* Tag);
 		static bool HasTag(AActor* Actor, const char* Tag);
+		static bool HasTagInterned(AActor* Actor, const InternedName* Tag);
+		static int32 GetComponents(AActor* Actor, ComponentType Type, UActorComponent** Components, int32 Capacity);
 	}
 
 	namespace Pawn {
@@ -507,6 +524,8 @@ namespace UnrealCLRFramework {
 		static float GetTimeKeyPressed(UPlayerInput* PlayerInput, const char* Key);
 		static void GetMouseSensitivity(UPlayerInput* PlayerInput, Vector2* Value);
 		static void SetMouseSensitivity(UPlayerInput* PlayerInput, const Vector2* Value);
+		static bool IsKeyPressedInterned(UPlayerInput* PlayerInput, const InternedName* Key);
+		static float GetTimeKeyPressedInterned(UPlayerInput* PlayerInput, const InternedName* Key);
 	}
 
 	namespace StreamableRenderAsset {
@@ -536,6 +555,7 @@ namespace UnrealCLRFramework {
 		static void AddTag(UActorComponent* ActorComponent, const char* Tag);
 		static void RemoveTag(UActorComponent* ActorComponent, const char* Tag);
 		static bool HasTag(UActorComponent* ActorComponent, const char* Tag);
+		static bool HasTagInterned(UActorComponent* ActorComponent, const InternedName* Tag);
 	}
 
 	namespace InputComponent {
@@ -580,6 +600,9 @@ namespace UnrealCLRFramework {
 		static void SetWorldLocation(USceneComponent* SceneComponent, const Vector3* Location);
 		static void SetWorldRotation(USceneComponent* SceneComponent, const Quaternion* Rotation);
 		static void SetWorldTransform(USceneComponent* SceneComponent, const Transform* Transform);
+		static void GetComponentsLocations(USceneComponent** SceneComponents, int32 Count, Vector3* Values);
+		static void GetComponentsRotations(USceneComponent** SceneComponents, int32 Count, Quaternion* Values);
+		static void GetComponentsTransforms(USceneComponent** SceneComponents, int32 Count, Transform* Values);
 	}
 
 	namespace AudioComponent {
@@ -641,6 +664,15 @@ namespace UnrealCLRFramework {
 		static void SetEnableGravity(UPrimitiveComponent* PrimitiveComponent, bool Value);
 		static void SetCollisionMode(UPrimitiveComponent* PrimitiveComponent, CollisionMode Mode);
 		static UMaterialInstanceDynamic* CreateAndSetMaterialInstanceDynamic(UPrimitiveComponent* PrimitiveComponent, int32 ElementIndex);
+		static void AddAngularImpulseInDegreesInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Impulse, const InternedName* BoneName, bool VelocityChange);
+		static void AddAngularImpulseInRadiansInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Impulse, const InternedName* BoneName, bool VelocityChange);
+		static void AddForceInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Force, const InternedName* BoneName, bool AccelerationChange);
+		static void AddForceAtLocationInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Force, const Vector3* Location, const InternedName* BoneName, bool LocalSpace);
+		static void AddImpulseInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Impulse, const InternedName* BoneName, bool VelocityChange);
+		static void AddImpulseAtLocationInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Impulse, const Vector3* Location, const InternedName* BoneName);
+		static void AddTorqueInDegreesInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Torque, const InternedName* BoneName, bool AccelerationChange);
+		static void AddTorqueInRadiansInterned(UPrimitiveComponent* PrimitiveComponent, const Vector3* Torque, const InternedName* BoneName, bool AccelerationChange);
+		static void SetMassInterned(UPrimitiveComponent* PrimitiveComponent, float Mass, const InternedName* BoneName);
 	}
 
 	namespace ShapeComponent {
@@ -709,6 +741,9 @@ namespace UnrealCLRFramework {
 		static int32 AddInstance(UInstancedStaticMeshComponent* InstancedStaticMeshComponent, const Transform* InstanceTransform);
 		static bool UpdateInstanceTransform(UInstancedStaticMeshComponent* InstancedStaticMeshComponent, int32 InstanceIndex, const Transform* InstanceTransform, bool WorldSpace, bool MarkRenderStateDirty, bool Teleport);
 		static void ClearInstances(UInstancedStaticMeshComponent* InstancedStaticMeshComponent);
+		static int32 AddInstances(UInstancedStaticMeshComponent* InstancedStaticMeshComponent, const Transform* InstanceTransforms, int32 Count);
+		static bool UpdateInstanceTransforms(UInstancedStaticMeshComponent* InstancedStaticMeshComponent, int32 StartIndex, const Transform* InstanceTransforms, int32 Count, bool WorldSpace, bool Teleport);
+		static bool RemoveInstances(UInstancedStaticMeshComponent* InstancedStaticMeshComponent, const int32* InstanceIndices, int32 Count);
 	}
 
 	namespace SkinnedMeshComponent {
@@ -742,5 +777,36 @@ namespace UnrealCLRFramework {
 		static void SetTextureParameterValue(UMaterialInstanceDynamic* MaterialInstanceDynamic, const char* ParameterName, UTexture* Value);
 		static void SetVectorParameterValue(UMaterialInstanceDynamic* MaterialInstanceDynamic, const char* ParameterName, const LinearColor* Value);
 		static void SetScalarParameterValue(UMaterialInstanceDynamic* MaterialInstanceDynamic, const char* ParameterName, float Value);
+		static void SetTextureParameterValueInterned(UMaterialInstanceDynamic* MaterialInstanceDynamic, const InternedName* ParameterName, UTexture* Value);
+		static void SetVectorParameterValueInterned(UMaterialInstanceDynamic* MaterialInstanceDynamic, const InternedName* ParameterName, const LinearColor* Value);
+		static void SetScalarParameterValueInterned(UMaterialInstanceDynamic* MaterialInstanceDynamic, const InternedName* ParameterName, float Value);
+	}
+
+	namespace CommandBuffer {
+		static void Execute(const Command* Commands, int32 Count);
+	}
+
+	namespace TickFunction {
+		static ManagedTickFunction* Register(TickExecuteDelegate Execute, TickDelegate Function, TickGroup Group, float Interval, bool TickEvenWhenPaused);
+		static void Unregister(ManagedTickFunction* TickFunction);
+		static bool IsRegistered(ManagedTickFunction* TickFunction);
+		static bool IsEnabled(ManagedTickFunction* TickFunction);
+		static float GetInterval(ManagedTickFunction* TickFunction);
+		static void SetEnabled(ManagedTickFunction* TickFunction, bool Value);
+		static void SetInterval(ManagedTickFunction* TickFunction, float Value);
+		static void AddPrerequisite(ManagedTickFunction* TickFunction, ManagedTickFunction* Prerequisite);
+		static void AddActorPrerequisite(ManagedTickFunction* TickFunction, AActor* Prerequisite);
+		static void AddComponentPrerequisite(ManagedTickFunction* TickFunction, UActorComponent* Prerequisite);
+		static void RemovePrerequisite(ManagedTickFunction* TickFunction, ManagedTickFunction* Prerequisite);
+		static void RemoveActorPrerequisite(ManagedTickFunction* TickFunction, AActor* Prerequisite);
+		static void RemoveComponentPrerequisite(ManagedTickFunction* TickFunction, UActorComponent* Prerequisite);
+	}
+
+	namespace GameThread {
+		static void SetDispatcher(DispatchDelegate Function);
+	}
+
+	namespace Statistics {
+		static void Register(const char** Tables, const char** Functions, const InteropCounter** Counters, int32 Count, int64 Frequency);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2020 Stanislav Denisov (nxrighthere@gmail.com)
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU Lesser General Public License
+ * (LGPL) version 3 with a static linking exception which accompanies this
+ * distribution.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// @third party code - BEGIN CoreCLR
+#include "../../Dependencies/CoreCLR/includes/coreclr_delegates.h"
+#include "../../Dependencies/CoreCLR/includes/hostfxr.h"
+// @third party code - END CoreCLR
+
+// Contract between the host and the managed runtime, shared with the standalone harness and therefore independent of the engine
+
+#define UNREALCLR_HOSTFXR_VERSION "3.1.5"
+#define UNREALCLR_RUNTIME_CONFIG "UnrealEngine.Runtime.runtimeconfig.json"
+#define UNREALCLR_RUNTIME_ASSEMBLY "UnrealEngine.Runtime.dll"
+#define UNREALCLR_RUNTIME_TYPE_NAME "UnrealEngine.Runtime.Core, UnrealEngine.Runtime"
+#define UNREALCLR_RUNTIME_METHOD_NAME "Initialize"
+#define UNREALCLR_RUNTIME_METHOD_DELEGATE_NAME "UnrealEngine.Runtime.InitializeDelegate, UnrealEngine.Runtime"
+#define UNREALCLR_RUNTIME_INITIALIZED 0xF
+
+#ifdef _WIN32
+	#define UNREALCLR_HOST_STRING_LITERAL(String) L##String
+#else
+	#define UNREALCLR_HOST_STRING_LITERAL(String) String
+#endif
+
+#define UNREALCLR_HOST_STRING(String) UNREALCLR_HOST_STRING_LITERAL(String)
+
+namespace UnrealCLR {
+	enum class LogLevel : int32_t {
+		Display,
+		Warning,
+		Error
+	};
+
+	// Layout of the buffer passed to the runtime initialization: managed functions, native functions, and shared function tables
+	enum class HostTable : int32_t {
+		ManagedFunctions,
+		NativeFunctions,
+		SharedFunctions,
+		Count
+	};
+
+	typedef int32_t (*InitializeDelegate)(void* Functions);
+	typedef void (*ExecuteAssemblyFunctionDelegate)(void*);
+	typedef void* (*LoadAssemblyFunctionDelegate)(const char_t* AssemblyPath, const char_t* TypeName, const char_t* MethodName, int8_t Optional);
+	typedef void (*UnloadAssembliesDelegate)();
+	typedef void (*LoadAssemblyFunctionsDelegate)(const char_t* AssemblyPath, const char_t** FunctionNames, int32_t Count, void** Functions, int8_t Optional);
+
+	struct HostTimings {
+		double HostLibraryLoad;
+		double RuntimeInitialization;
+		double RuntimeAssemblyLoad;
+	};
+
+	// Resolves the entry points of a loaded host library, initializes the runtime, and loads the initialization function of the runtime assembly, returns an error message on failure, timings are measured from the start of the library load in milliseconds
+	template <typename GetExportFunction, typename ClockFunction>
+	const char* LoadRuntime(void* HostfxrLibrary, GetExportFunction GetExport, ClockFunction Now, double Start, hostfxr_error_writer_fn ErrorWriter, const char_t* RuntimeConfigPath, const char_t* RuntimeAssemblyPath, InitializeDelegate* Initialize, HostTimings* Timings) {
+		hostfxr_set_error_writer_fn HostfxrSetErrorWriter = (hostfxr_set_error_writer_fn)GetExport(HostfxrLibrary, "hostfxr_set_error_writer");
+
+		if (!HostfxrSetErrorWriter)
+			return "Unable to locate hostfxr_set_error_writer entry point!";
+
+		hostfxr_initialize_for_runtime_config_fn HostfxrInitializeForRuntimeConfig = (hostfxr_initialize_for_runtime_config_fn)GetExport(HostfxrLibrary, "hostfxr_initialize_for_runtime_config");
+
+		if (!HostfxrInitializeForRuntimeConfig)
+			return "Unable to locate hostfxr_initialize_for_runtime_config entry point!";
+
+		hostfxr_get_runtime_delegate_fn HostfxrGetRuntimeDelegate = (hostfxr_get_runtime_delegate_fn)GetExport(HostfxrLibrary, "hostfxr_get_runtime_delegate");
+
+		if (!HostfxrGetRuntimeDelegate)
+			return "Unable to locate hostfxr_get_runtime_delegate entry point!";
+
+		hostfxr_close_fn HostfxrClose = (hostfxr_close_fn)GetExport(HostfxrLibrary, "hostfxr_close");
+
+		if (!HostfxrClose)
+			return "Unable to locate hostfxr_close entry point!";
+
+		HostfxrSetErrorWriter(ErrorWriter);
+
+		double time = Now();
+
+		Timings->HostLibraryLoad = time - Start;
+
+		hostfxr_handle HostfxrContext = nullptr;
+
+		if (HostfxrInitializeForRuntimeConfig(RuntimeConfigPath, nullptr, &HostfxrContext) != 0 || !HostfxrContext) {
+			HostfxrClose(HostfxrContext);
+
+			return "Unable to initialize the host!";
+		}
+
+		void* hostfxrLoadAssemblyAndGetFunctionPointer = nullptr;
+
+		if (HostfxrGetRuntimeDelegate(HostfxrContext, hdt_load_assembly_and_get_function_pointer, &hostfxrLoadAssemblyAndGetFunctionPointer) != 0 || !hostfxrLoadAssemblyAndGetFunctionPointer) {
+			HostfxrClose(HostfxrContext);
+
+			return "Unable to get hdt_load_assembly_and_get_function_pointer runtime delegate!";
+		}
+
+		HostfxrClose(HostfxrContext);
+
+		Timings->RuntimeInitialization = Now() - time;
+		time = Now();
+
+		load_assembly_and_get_function_pointer_fn HostfxrLoadAssemblyAndGetFunctionPointer = (load_assembly_and_get_function_pointer_fn)hostfxrLoadAssemblyAndGetFunctionPointer;
+
+		if (HostfxrLoadAssemblyAndGetFunctionPointer(RuntimeAssemblyPath, UNREALCLR_HOST_STRING(UNREALCLR_RUNTIME_TYPE_NAME), UNREALCLR_HOST_STRING(UNREALCLR_RUNTIME_METHOD_NAME), UNREALCLR_HOST_STRING(UNREALCLR_RUNTIME_METHOD_DELEGATE_NAME), nullptr, (void**)Initialize) != 0 || !*Initialize)
+			return "Host runtime assembly loading failed!";
+
+		Timings->RuntimeAssemblyLoad = Now() - time;
+
+		return nullptr;
+	}
+
+	// Passes the function tables to the runtime which fills the native functions in the order of the delegates above
+	inline bool InitializeRuntime(InitializeDelegate Initialize, void** ManagedFunctions, void** NativeFunctions, void** SharedFunctions) {
+		void* functions[(int32_t)HostTable::Count] = {
+			ManagedFunctions,
+			NativeFunctions,
+			SharedFunctions
+		};
+
+		return Initialize(functions) == UNREALCLR_RUNTIME_INITIALIZED;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2020 Stanislav Denisov (nxrighthere@gmail.com)
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU Lesser General Public License
+ * (LGPL) version 3 with a static linking exception which accompanies this
+ * distribution.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Enumerations and plain layouts of the framework which are mirrored by the managed side, shared with the standalone harness and therefore independent of the engine
+namespace UnrealCLRFramework {
+	enum struct LogLevel : int32_t {
+		Display,
+		Warning,
+		Error,
+		Fatal
+	};
+
+	enum struct ComponentMobility : int32_t {
+		Movable,
+		Static,
+		Stationary
+	};
+
+	enum struct AttachmentTransformRule : int32_t {
+		KeepRelativeTransform,
+		KeepWorldTransform,
+		SnapToTargetIncludingScale,
+		SnapToTargetNotIncludingScale
+	};
+
+	typedef void (*ConsoleVariableDelegate)();
+
+	typedef void (*TickDelegate)(float);
+
+	typedef void (*TickExecuteDelegate)(TickDelegate, float);
+
+	typedef void (*DispatchDelegate)();
+
+	// Enumerable
+
+	enum struct ActorType : int32_t {
+		Base,
+		Camera,
+		Pawn,
+		Character,
+		AIController,
+		PlayerController,
+		Brush,
+		AmbientSound,
+		DirectionalLight,
+		PointLight,
+		RectLight,
+		SpotLight
+	};
+
+	enum struct ComponentType : int32_t {
+		// Non-attachable
+		Actor,
+		Input,
+		// Attachable
+		Scene,
+		Audio,
+		Camera,
+		Light,
+		DirectionalLight,
+		MotionController,
+		StaticMesh,
+		InstancedStaticMesh,
+		Box,
+		Sphere,
+		Capsule,
+		SkeletalMesh
+	};
+
+	enum struct CommandType : int32_t {
+		// Scene component
+		AddLocalOffset,
+		AddLocalRotation,
+		AddRelativeLocation,
+		AddRelativeRotation,
+		AddLocalTransform,
+		AddWorldOffset,
+		AddWorldRotation,
+		AddWorldTransform,
+		SetRelativeLocation,
+		SetRelativeRotation,
+		SetRelativeTransform,
+		SetWorldLocation,
+		SetWorldRotation,
+		SetWorldTransform,
+		// Primitive component
+		AddAngularImpulseInDegrees,
+		AddAngularImpulseInRadians,
+		AddForce,
+		AddForceAtLocation,
+		AddImpulse,
+		AddImpulseAtLocation,
+		AddTorqueInDegrees,
+		AddTorqueInRadians,
+		// Actor
+		Hide,
+		SetEnableCollision,
+		TeleportTo
+	};
+
+	enum struct PropertyType : int32_t {
+		None,
+		Bool,
+		Byte,
+		Short,
+		Int,
+		Long,
+		UShort,
+		UInt,
+		ULong,
+		Float,
+		Double,
+		Text
+	};
+
+	// Payload fits a transform of 10 floats
+	struct Command {
+		CommandType Type;
+		int32_t Flags;
+		int32_t ObjectIndex;
+		int32_t SerialNumber;
+		uint8_t Payload[40];
+
+		template <typename T>
+		inline const T* Get(int32_t Offset = 0) const { return reinterpret_cast<const T*>(Payload + Offset); }
+	};
+
+	struct LogEntry {
+		int32_t Committed;
+		LogLevel Level;
+		int32_t CategoryLength;
+		int32_t MessageLength;
+		int32_t Count;
+		int32_t Padding;
+		uint64_t Frame;
+	};
+
+	struct LogBuffer {
+		int64_t Write;
+		int64_t Read;
+		int32_t Dropped;
+		int32_t Capacity;
+		int32_t SlotSize;
+		int32_t Padding;
+		LogEntry* Entries;
+		uint8_t* Payload;
+		const uint64_t* FrameCounter;
+	};
+
+	// Leading fields of an entry in the global object array, read directly by the managed side
+	struct ObjectItem {
+		void* Object;
+		int32_t Flags;
+		int32_t ClusterRootIndex;
+		int32_t SerialNumber;
+	};
+
+	struct InteropCounter {
+		int64_t Calls;
+		int64_t Ticks;
+	};
+
+	static_assert(sizeof(Command) == 56, "Command layout is mirrored by the managed side");
+	static_assert(sizeof(LogEntry) == 32, "Log entry layout is mirrored by the managed side");
+	static_assert(offsetof(ObjectItem, Flags) == sizeof(void*) && offsetof(ObjectItem, SerialNumber) == sizeof(void*) + 8, "Object item layout is mirrored by the managed side");
+}
\ No newline at end of file
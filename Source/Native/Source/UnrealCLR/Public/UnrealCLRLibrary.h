@@ -37,4 +37,10 @@ class UUnrealCLRLibrary : public UBlueprintFunctionLibrary {
 
 	UFUNCTION(BlueprintCallable, Category = ".NET", meta = (ToolTip = "Loads the managed function from assembly, optional parameter suppresses errors if the function was not found"))
 	static FManagedFunction LoadAssemblyFunction(FString AssemblyPath, FString TypeName, FString MethodName, bool Optional);
+
+	UFUNCTION(BlueprintCallable, Category = ".NET", meta = (ToolTip = "Loads the managed functions from assembly in a single pass, function names are specified as a full type name followed by a method name, optional parameter suppresses errors if a function was not found"))
+	static TMap<FString, FManagedFunction> LoadAssemblyFunctions(FString AssemblyPath, const TArray<FString>& FunctionNames, bool Optional);
+
+	UFUNCTION(BlueprintCallable, Category = ".NET", meta = (ToolTip = "Loads the managed functions from assembly listed in a manifest file with one function name per line, lines starting with # are ignored, optional parameter suppresses errors if a function was not found"))
+	static TMap<FString, FManagedFunction> LoadAssemblyManifest(FString AssemblyPath, FString ManifestPath, bool Optional);
 };
\ No newline at end of file
@@ -0,0 +1,555 @@
+/*
+ * Copyright (c) 2020 Stanislav Denisov (nxrighthere@gmail.com)
+ *
+ * All rights reserved. This program and the accompanying materials
+ * are made available under the terms of the GNU Lesser General Public License
+ * (LGPL) version 3 with a static linking exception which accompanies this
+ * distribution.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ */
+
+// Layout of the function tables shared with the managed side, tables and their entries must be listed in the same order as they are read by Shared.Load in Codegen.cs
+// Include this file with UNREALCLR_TABLE_BEGIN(Table), UNREALCLR_TABLE_ENTRY(Table, Function) and UNREALCLR_TABLE_END(Table) defined
+
+UNREALCLR_TABLE_BEGIN(Assert)
+	UNREALCLR_TABLE_ENTRY(Assert, OutputMessage)
+UNREALCLR_TABLE_END(Assert)
+
+UNREALCLR_TABLE_BEGIN(CommandLine)
+	UNREALCLR_TABLE_ENTRY(CommandLine, Get)
+	UNREALCLR_TABLE_ENTRY(CommandLine, Set)
+	UNREALCLR_TABLE_ENTRY(CommandLine, Append)
+UNREALCLR_TABLE_END(CommandLine)
+
+UNREALCLR_TABLE_BEGIN(Debug)
+	UNREALCLR_TABLE_ENTRY(Debug, Log)
+	UNREALCLR_TABLE_ENTRY(Debug, HandleException)
+	UNREALCLR_TABLE_ENTRY(Debug, AddOnScreenMessage)
+	UNREALCLR_TABLE_ENTRY(Debug, ClearOnScreenMessages)
+	UNREALCLR_TABLE_ENTRY(Debug, DrawBox)
+	UNREALCLR_TABLE_ENTRY(Debug, DrawCapsule)
+	UNREALCLR_TABLE_ENTRY(Debug, DrawCone)
+	UNREALCLR_TABLE_ENTRY(Debug, DrawCylinder)
+	UNREALCLR_TABLE_ENTRY(Debug, DrawSphere)
+	UNREALCLR_TABLE_ENTRY(Debug, DrawLine)
+	UNREALCLR_TABLE_ENTRY(Debug, DrawPoint)
+	UNREALCLR_TABLE_ENTRY(Debug, FlushPersistentLines)
+	UNREALCLR_TABLE_ENTRY(Debug, GetLogBuffer)
+UNREALCLR_TABLE_END(Debug)
+
+UNREALCLR_TABLE_BEGIN(Object)
+	UNREALCLR_TABLE_ENTRY(Object, IsPendingKill)
+	UNREALCLR_TABLE_ENTRY(Object, IsValid)
+	UNREALCLR_TABLE_ENTRY(Object, Load)
+	UNREALCLR_TABLE_ENTRY(Object, Rename)
+	UNREALCLR_TABLE_ENTRY(Object, GetName)
+	UNREALCLR_TABLE_ENTRY(Object, GetBool)
+	UNREALCLR_TABLE_ENTRY(Object, GetByte)
+	UNREALCLR_TABLE_ENTRY(Object, GetShort)
+	UNREALCLR_TABLE_ENTRY(Object, GetInt)
+	UNREALCLR_TABLE_ENTRY(Object, GetLong)
+	UNREALCLR_TABLE_ENTRY(Object, GetUShort)
+	UNREALCLR_TABLE_ENTRY(Object, GetUInt)
+	UNREALCLR_TABLE_ENTRY(Object, GetULong)
+	UNREALCLR_TABLE_ENTRY(Object, GetFloat)
+	UNREALCLR_TABLE_ENTRY(Object, GetDouble)
+	UNREALCLR_TABLE_ENTRY(Object, GetText)
+	UNREALCLR_TABLE_ENTRY(Object, SetBool)
+	UNREALCLR_TABLE_ENTRY(Object, SetByte)
+	UNREALCLR_TABLE_ENTRY(Object, SetShort)
+	UNREALCLR_TABLE_ENTRY(Object, SetInt)
+	UNREALCLR_TABLE_ENTRY(Object, SetLong)
+	UNREALCLR_TABLE_ENTRY(Object, SetUShort)
+	UNREALCLR_TABLE_ENTRY(Object, SetUInt)
+	UNREALCLR_TABLE_ENTRY(Object, SetULong)
+	UNREALCLR_TABLE_ENTRY(Object, SetFloat)
+	UNREALCLR_TABLE_ENTRY(Object, SetDouble)
+	UNREALCLR_TABLE_ENTRY(Object, SetText)
+	UNREALCLR_TABLE_ENTRY(Object, GetBoolInterned)
+	UNREALCLR_TABLE_ENTRY(Object, GetByteInterned)
+	UNREALCLR_TABLE_ENTRY(Object, GetShortInterned)
+	UNREALCLR_TABLE_ENTRY(Object, GetIntInterned)
+	UNREALCLR_TABLE_ENTRY(Object, GetLongInterned)
+	UNREALCLR_TABLE_ENTRY(Object, GetUShortInterned)
+	UNREALCLR_TABLE_ENTRY(Object, GetUIntInterned)
+	UNREALCLR_TABLE_ENTRY(Object, GetULongInterned)
+	UNREALCLR_TABLE_ENTRY(Object, GetFloatInterned)
+	UNREALCLR_TABLE_ENTRY(Object, GetDoubleInterned)
+	UNREALCLR_TABLE_ENTRY(Object, GetTextInterned)
+	UNREALCLR_TABLE_ENTRY(Object, SetBoolInterned)
+	UNREALCLR_TABLE_ENTRY(Object, SetByteInterned)
+	UNREALCLR_TABLE_ENTRY(Object, SetShortInterned)
+	UNREALCLR_TABLE_ENTRY(Object, SetIntInterned)
+	UNREALCLR_TABLE_ENTRY(Object, SetLongInterned)
+	UNREALCLR_TABLE_ENTRY(Object, SetUShortInterned)
+	UNREALCLR_TABLE_ENTRY(Object, SetUIntInterned)
+	UNREALCLR_TABLE_ENTRY(Object, SetULongInterned)
+	UNREALCLR_TABLE_ENTRY(Object, SetFloatInterned)
+	UNREALCLR_TABLE_ENTRY(Object, SetDoubleInterned)
+	UNREALCLR_TABLE_ENTRY(Object, SetTextInterned)
+	UNREALCLR_TABLE_ENTRY(Object, GetItem)
+	UNREALCLR_TABLE_ENTRY(Object, GetPropertyHandle)
+	UNREALCLR_TABLE_ENTRY(Object, GetTextByHandle)
+	UNREALCLR_TABLE_ENTRY(Object, SetTextByHandle)
+	UNREALCLR_TABLE_ENTRY(Object, LoadAsync)
+	UNREALCLR_TABLE_ENTRY(Object, CancelLoadAsync)
+UNREALCLR_TABLE_END(Object)
+
+UNREALCLR_TABLE_BEGIN(Name)
+	UNREALCLR_TABLE_ENTRY(Name, Create)
+	UNREALCLR_TABLE_ENTRY(Name, GetString)
+UNREALCLR_TABLE_END(Name)
+
+UNREALCLR_TABLE_BEGIN(Application)
+	UNREALCLR_TABLE_ENTRY(Application, IsCanEverRender)
+	UNREALCLR_TABLE_ENTRY(Application, IsPackagedForDistribution)
+	UNREALCLR_TABLE_ENTRY(Application, IsPackagedForShipping)
+	UNREALCLR_TABLE_ENTRY(Application, GetProjectDirectory)
+	UNREALCLR_TABLE_ENTRY(Application, GetDefaultLanguage)
+	UNREALCLR_TABLE_ENTRY(Application, GetProjectName)
+	UNREALCLR_TABLE_ENTRY(Application, GetVolumeMultiplier)
+	UNREALCLR_TABLE_ENTRY(Application, SetProjectName)
+	UNREALCLR_TABLE_ENTRY(Application, SetVolumeMultiplier)
+UNREALCLR_TABLE_END(Application)
+
+UNREALCLR_TABLE_BEGIN(ConsoleManager)
+	UNREALCLR_TABLE_ENTRY(ConsoleManager, IsRegisteredVariable)
+	UNREALCLR_TABLE_ENTRY(ConsoleManager, FindVariable)
+	UNREALCLR_TABLE_ENTRY(ConsoleManager, RegisterVariableBool)
+	UNREALCLR_TABLE_ENTRY(ConsoleManager, RegisterVariableInt)
+	UNREALCLR_TABLE_ENTRY(ConsoleManager, RegisterVariableFloat)
+	UNREALCLR_TABLE_ENTRY(ConsoleManager, RegisterVariableString)
+	UNREALCLR_TABLE_ENTRY(ConsoleManager, RegisterCommand)
+	UNREALCLR_TABLE_ENTRY(ConsoleManager, UnregisterObject)
+UNREALCLR_TABLE_END(ConsoleManager)
+
+UNREALCLR_TABLE_BEGIN(Engine)
+	UNREALCLR_TABLE_ENTRY(Engine, IsSplitScreen)
+	UNREALCLR_TABLE_ENTRY(Engine, IsEditor)
+	UNREALCLR_TABLE_ENTRY(Engine, IsForegroundWindow)
+	UNREALCLR_TABLE_ENTRY(Engine, IsExitRequested)
+	UNREALCLR_TABLE_ENTRY(Engine, GetNetMode)
+	UNREALCLR_TABLE_ENTRY(Engine, GetFrameNumber)
+	UNREALCLR_TABLE_ENTRY(Engine, GetViewportSize)
+	UNREALCLR_TABLE_ENTRY(Engine, GetScreenResolution)
+	UNREALCLR_TABLE_ENTRY(Engine, GetWindowMode)
+	UNREALCLR_TABLE_ENTRY(Engine, GetVersion)
+	UNREALCLR_TABLE_ENTRY(Engine, GetMaxFPS)
+	UNREALCLR_TABLE_ENTRY(Engine, SetMaxFPS)
+	UNREALCLR_TABLE_ENTRY(Engine, SetTitle)
+	UNREALCLR_TABLE_ENTRY(Engine, AddActionMapping)
+	UNREALCLR_TABLE_ENTRY(Engine, AddAxisMapping)
+	UNREALCLR_TABLE_ENTRY(Engine, ForceGarbageCollection)
+	UNREALCLR_TABLE_ENTRY(Engine, DelayGarbageCollection)
+	UNREALCLR_TABLE_ENTRY(Engine, RequestExit)
+UNREALCLR_TABLE_END(Engine)
+
+UNREALCLR_TABLE_BEGIN(HeadMountedDisplay)
+	UNREALCLR_TABLE_ENTRY(HeadMountedDisplay, IsEnabled)
+	UNREALCLR_TABLE_ENTRY(HeadMountedDisplay, GetDeviceName)
+UNREALCLR_TABLE_END(HeadMountedDisplay)
+
+UNREALCLR_TABLE_BEGIN(World)
+	UNREALCLR_TABLE_ENTRY(World, GetSimulatePhysics)
+	UNREALCLR_TABLE_ENTRY(World, GetActorCount)
+	UNREALCLR_TABLE_ENTRY(World, GetDeltaSeconds)
+	UNREALCLR_TABLE_ENTRY(World, GetRealTimeSeconds)
+	UNREALCLR_TABLE_ENTRY(World, GetTimeSeconds)
+	UNREALCLR_TABLE_ENTRY(World, GetWorldOrigin)
+	UNREALCLR_TABLE_ENTRY(World, GetActor)
+	UNREALCLR_TABLE_ENTRY(World, GetActorByTag)
+	UNREALCLR_TABLE_ENTRY(World, GetFirstPlayerController)
+	UNREALCLR_TABLE_ENTRY(World, SetSimulatePhysics)
+	UNREALCLR_TABLE_ENTRY(World, SetGravity)
+	UNREALCLR_TABLE_ENTRY(World, SetWorldOrigin)
+UNREALCLR_TABLE_END(World)
+
+UNREALCLR_TABLE_BEGIN(ConsoleObject)
+	UNREALCLR_TABLE_ENTRY(ConsoleObject, IsBool)
+	UNREALCLR_TABLE_ENTRY(ConsoleObject, IsInt)
+	UNREALCLR_TABLE_ENTRY(ConsoleObject, IsFloat)
+	UNREALCLR_TABLE_ENTRY(ConsoleObject, IsString)
+UNREALCLR_TABLE_END(ConsoleObject)
+
+UNREALCLR_TABLE_BEGIN(ConsoleVariable)
+	UNREALCLR_TABLE_ENTRY(ConsoleVariable, GetBool)
+	UNREALCLR_TABLE_ENTRY(ConsoleVariable, GetInt)
+	UNREALCLR_TABLE_ENTRY(ConsoleVariable, GetFloat)
+	UNREALCLR_TABLE_ENTRY(ConsoleVariable, GetString)
+	UNREALCLR_TABLE_ENTRY(ConsoleVariable, SetBool)
+	UNREALCLR_TABLE_ENTRY(ConsoleVariable, SetInt)
+	UNREALCLR_TABLE_ENTRY(ConsoleVariable, SetFloat)
+	UNREALCLR_TABLE_ENTRY(ConsoleVariable, SetString)
+	UNREALCLR_TABLE_ENTRY(ConsoleVariable, SetOnChangedCallback)
+	UNREALCLR_TABLE_ENTRY(ConsoleVariable, ClearOnChangedCallback)
+UNREALCLR_TABLE_END(ConsoleVariable)
+
+UNREALCLR_TABLE_BEGIN(Actor)
+	UNREALCLR_TABLE_ENTRY(Actor, IsPendingKill)
+	UNREALCLR_TABLE_ENTRY(Actor, IsRootComponentMovable)
+	UNREALCLR_TABLE_ENTRY(Actor, IsOverlappingActor)
+	UNREALCLR_TABLE_ENTRY(Actor, Spawn)
+	UNREALCLR_TABLE_ENTRY(Actor, Destroy)
+	UNREALCLR_TABLE_ENTRY(Actor, Rename)
+	UNREALCLR_TABLE_ENTRY(Actor, Hide)
+	UNREALCLR_TABLE_ENTRY(Actor, TeleportTo)
+	UNREALCLR_TABLE_ENTRY(Actor, GetComponent)
+	UNREALCLR_TABLE_ENTRY(Actor, GetRootComponent)
+	UNREALCLR_TABLE_ENTRY(Actor, GetInputComponent)
+	UNREALCLR_TABLE_ENTRY(Actor, GetBlockInput)
+	UNREALCLR_TABLE_ENTRY(Actor, GetDistanceTo)
+	UNREALCLR_TABLE_ENTRY(Actor, GetBounds)
+	UNREALCLR_TABLE_ENTRY(Actor, SetRootComponent)
+	UNREALCLR_TABLE_ENTRY(Actor, SetInputComponent)
+	UNREALCLR_TABLE_ENTRY(Actor, SetBlockInput)
+	UNREALCLR_TABLE_ENTRY(Actor, SetLifeSpan)
+	UNREALCLR_TABLE_ENTRY(Actor, SetEnableCollision)
+	UNREALCLR_TABLE_ENTRY(Actor, AddTag)
+	UNREALCLR_TABLE_ENTRY(Actor, RemoveTag)
+	UNREALCLR_TABLE_ENTRY(Actor, HasTag)
+	UNREALCLR_TABLE_ENTRY(Actor, HasTagInterned)
+	UNREALCLR_TABLE_ENTRY(Actor, GetComponents)
+UNREALCLR_TABLE_END(Actor)
+
+UNREALCLR_TABLE_BEGIN(Pawn)
+	UNREALCLR_TABLE_ENTRY(Pawn, AddControllerYawInput)
+	UNREALCLR_TABLE_ENTRY(Pawn, AddControllerPitchInput)
+	UNREALCLR_TABLE_ENTRY(Pawn, AddControllerRollInput)
+	UNREALCLR_TABLE_ENTRY(Pawn, AddMovementInput)
+	UNREALCLR_TABLE_ENTRY(Pawn, GetGravityDirection)
+UNREALCLR_TABLE_END(Pawn)
+
+UNREALCLR_TABLE_BEGIN(Controller)
+	UNREALCLR_TABLE_ENTRY(Controller, IsLookInputIgnored)
+	UNREALCLR_TABLE_ENTRY(Controller, IsMoveInputIgnored)
+	UNREALCLR_TABLE_ENTRY(Controller, IsPlayerController)
+	UNREALCLR_TABLE_ENTRY(Controller, GetPawn)
+	UNREALCLR_TABLE_ENTRY(Controller, LineOfSightTo)
+	UNREALCLR_TABLE_ENTRY(Controller, SetInitialLocationAndRotation)
+	UNREALCLR_TABLE_ENTRY(Controller, SetIgnoreLookInput)
+	UNREALCLR_TABLE_ENTRY(Controller, SetIgnoreMoveInput)
+	UNREALCLR_TABLE_ENTRY(Controller, ResetIgnoreLookInput)
+	UNREALCLR_TABLE_ENTRY(Controller, ResetIgnoreMoveInput)
+UNREALCLR_TABLE_END(Controller)
+
+UNREALCLR_TABLE_BEGIN(AIController)
+	UNREALCLR_TABLE_ENTRY(AIController, ClearFocus)
+	UNREALCLR_TABLE_ENTRY(AIController, GetFocalPoint)
+	UNREALCLR_TABLE_ENTRY(AIController, SetFocalPoint)
+	UNREALCLR_TABLE_ENTRY(AIController, GetFocusActor)
+	UNREALCLR_TABLE_ENTRY(AIController, GetAllowStrafe)
+	UNREALCLR_TABLE_ENTRY(AIController, SetAllowStrafe)
+	UNREALCLR_TABLE_ENTRY(AIController, SetFocus)
+UNREALCLR_TABLE_END(AIController)
+
+UNREALCLR_TABLE_BEGIN(PlayerController)
+	UNREALCLR_TABLE_ENTRY(PlayerController, IsPaused)
+	UNREALCLR_TABLE_ENTRY(PlayerController, GetShowMouseCursor)
+	UNREALCLR_TABLE_ENTRY(PlayerController, GetMousePosition)
+	UNREALCLR_TABLE_ENTRY(PlayerController, GetPlayerViewPoint)
+	UNREALCLR_TABLE_ENTRY(PlayerController, GetPlayerInput)
+	UNREALCLR_TABLE_ENTRY(PlayerController, SetShowMouseCursor)
+	UNREALCLR_TABLE_ENTRY(PlayerController, SetMousePosition)
+	UNREALCLR_TABLE_ENTRY(PlayerController, ConsoleCommand)
+	UNREALCLR_TABLE_ENTRY(PlayerController, SetPause)
+	UNREALCLR_TABLE_ENTRY(PlayerController, SetViewTarget)
+	UNREALCLR_TABLE_ENTRY(PlayerController, SetViewTargetWithBlend)
+	UNREALCLR_TABLE_ENTRY(PlayerController, AddYawInput)
+	UNREALCLR_TABLE_ENTRY(PlayerController, AddPitchInput)
+	UNREALCLR_TABLE_ENTRY(PlayerController, AddRollInput)
+UNREALCLR_TABLE_END(PlayerController)
+
+UNREALCLR_TABLE_BEGIN(Volume)
+	UNREALCLR_TABLE_ENTRY(Volume, EncompassesPoint)
+UNREALCLR_TABLE_END(Volume)
+
+UNREALCLR_TABLE_BEGIN(SoundBase)
+	UNREALCLR_TABLE_ENTRY(SoundBase, GetDuration)
+UNREALCLR_TABLE_END(SoundBase)
+
+UNREALCLR_TABLE_BEGIN(SoundWave)
+	UNREALCLR_TABLE_ENTRY(SoundWave, GetLoop)
+	UNREALCLR_TABLE_ENTRY(SoundWave, SetLoop)
+UNREALCLR_TABLE_END(SoundWave)
+
+UNREALCLR_TABLE_BEGIN(AnimationInstance)
+	UNREALCLR_TABLE_ENTRY(AnimationInstance, GetCurrentActiveMontage)
+	UNREALCLR_TABLE_ENTRY(AnimationInstance, MontagePlay)
+	UNREALCLR_TABLE_ENTRY(AnimationInstance, MontagePause)
+	UNREALCLR_TABLE_ENTRY(AnimationInstance, MontageResume)
+UNREALCLR_TABLE_END(AnimationInstance)
+
+UNREALCLR_TABLE_BEGIN(PlayerInput)
+	UNREALCLR_TABLE_ENTRY(PlayerInput, IsKeyPressed)
+	UNREALCLR_TABLE_ENTRY(PlayerInput, GetTimeKeyPressed)
+	UNREALCLR_TABLE_ENTRY(PlayerInput, GetMouseSensitivity)
+	UNREALCLR_TABLE_ENTRY(PlayerInput, SetMouseSensitivity)
+	UNREALCLR_TABLE_ENTRY(PlayerInput, IsKeyPressedInterned)
+	UNREALCLR_TABLE_ENTRY(PlayerInput, GetTimeKeyPressedInterned)
+UNREALCLR_TABLE_END(PlayerInput)
+
+UNREALCLR_TABLE_BEGIN(Texture2D)
+	UNREALCLR_TABLE_ENTRY(Texture2D, GetSize)
+UNREALCLR_TABLE_END(Texture2D)
+
+UNREALCLR_TABLE_BEGIN(ActorComponent)
+	UNREALCLR_TABLE_ENTRY(ActorComponent, IsOwnerSelected)
+	UNREALCLR_TABLE_ENTRY(ActorComponent, GetOwner)
+	UNREALCLR_TABLE_ENTRY(ActorComponent, Destroy)
+	UNREALCLR_TABLE_ENTRY(ActorComponent, AddTag)
+	UNREALCLR_TABLE_ENTRY(ActorComponent, RemoveTag)
+	UNREALCLR_TABLE_ENTRY(ActorComponent, HasTag)
+	UNREALCLR_TABLE_ENTRY(ActorComponent, HasTagInterned)
+UNREALCLR_TABLE_END(ActorComponent)
+
+UNREALCLR_TABLE_BEGIN(InputComponent)
+	UNREALCLR_TABLE_ENTRY(InputComponent, HasBindings)
+	UNREALCLR_TABLE_ENTRY(InputComponent, GetActionBindingsNumber)
+	UNREALCLR_TABLE_ENTRY(InputComponent, ClearActionBindings)
+	UNREALCLR_TABLE_ENTRY(InputComponent, BindAction)
+	UNREALCLR_TABLE_ENTRY(InputComponent, BindAxis)
+	UNREALCLR_TABLE_ENTRY(InputComponent, RemoveActionBinding)
+	UNREALCLR_TABLE_ENTRY(InputComponent, GetBlockInput)
+	UNREALCLR_TABLE_ENTRY(InputComponent, SetBlockInput)
+	UNREALCLR_TABLE_ENTRY(InputComponent, GetPriority)
+	UNREALCLR_TABLE_ENTRY(InputComponent, SetPriority)
+UNREALCLR_TABLE_END(InputComponent)
+
+UNREALCLR_TABLE_BEGIN(SceneComponent)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, IsAttachedToComponent)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, IsAttachedToActor)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, Create)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, AttachToComponent)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, UpdateToWorld)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, AddLocalOffset)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, AddLocalRotation)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, AddRelativeLocation)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, AddRelativeRotation)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, AddLocalTransform)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, AddWorldOffset)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, AddWorldRotation)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, AddWorldTransform)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, GetComponentVelocity)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, GetComponentLocation)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, GetComponentRotation)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, GetComponentScale)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, GetComponentTransform)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, GetForwardVector)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, GetRightVector)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, GetUpVector)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, SetMobility)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, SetRelativeLocation)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, SetRelativeRotation)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, SetRelativeTransform)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, SetWorldLocation)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, SetWorldRotation)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, SetWorldTransform)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, GetComponentsLocations)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, GetComponentsRotations)
+	UNREALCLR_TABLE_ENTRY(SceneComponent, GetComponentsTransforms)
+UNREALCLR_TABLE_END(SceneComponent)
+
+UNREALCLR_TABLE_BEGIN(AudioComponent)
+	UNREALCLR_TABLE_ENTRY(AudioComponent, GetPaused)
+	UNREALCLR_TABLE_ENTRY(AudioComponent, SetSound)
+	UNREALCLR_TABLE_ENTRY(AudioComponent, SetPaused)
+	UNREALCLR_TABLE_ENTRY(AudioComponent, Play)
+	UNREALCLR_TABLE_ENTRY(AudioComponent, Stop)
+UNREALCLR_TABLE_END(AudioComponent)
+
+UNREALCLR_TABLE_BEGIN(CameraComponent)
+	UNREALCLR_TABLE_ENTRY(CameraComponent, GetConstrainAspectRatio)
+	UNREALCLR_TABLE_ENTRY(CameraComponent, GetAspectRatio)
+	UNREALCLR_TABLE_ENTRY(CameraComponent, GetFieldOfView)
+	UNREALCLR_TABLE_ENTRY(CameraComponent, GetOrthoFarClipPlane)
+	UNREALCLR_TABLE_ENTRY(CameraComponent, GetOrthoNearClipPlane)
+	UNREALCLR_TABLE_ENTRY(CameraComponent, GetOrthoWidth)
+	UNREALCLR_TABLE_ENTRY(CameraComponent, GetLockToHeadMountedDisplay)
+	UNREALCLR_TABLE_ENTRY(CameraComponent, SetProjectionMode)
+	UNREALCLR_TABLE_ENTRY(CameraComponent, SetConstrainAspectRatio)
+	UNREALCLR_TABLE_ENTRY(CameraComponent, SetAspectRatio)
+	UNREALCLR_TABLE_ENTRY(CameraComponent, SetFieldOfView)
+	UNREALCLR_TABLE_ENTRY(CameraComponent, SetOrthoFarClipPlane)
+	UNREALCLR_TABLE_ENTRY(CameraComponent, SetOrthoNearClipPlane)
+	UNREALCLR_TABLE_ENTRY(CameraComponent, SetOrthoWidth)
+	UNREALCLR_TABLE_ENTRY(CameraComponent, SetLockToHeadMountedDisplay)
+UNREALCLR_TABLE_END(CameraComponent)
+
+UNREALCLR_TABLE_BEGIN(PrimitiveComponent)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, IsGravityEnabled)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddAngularImpulseInDegrees)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddAngularImpulseInRadians)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddForce)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddForceAtLocation)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddImpulse)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddImpulseAtLocation)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddRadialForce)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddRadialImpulse)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddTorqueInDegrees)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddTorqueInRadians)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, GetMass)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, GetCastShadow)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, GetOnlyOwnerSee)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, GetOwnerNoSee)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, GetMaterial)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, GetMaterialsNumber)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, GetDistanceToCollision)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, GetSquaredDistanceToCollision)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, GetAngularDamping)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, GetLinearDamping)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, SetMass)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, SetCastShadow)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, SetOnlyOwnerSee)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, SetOwnerNoSee)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, SetMaterial)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, SetSimulatePhysics)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, SetAngularDamping)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, SetLinearDamping)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, SetEnableGravity)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, SetCollisionMode)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, CreateAndSetMaterialInstanceDynamic)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddAngularImpulseInDegreesInterned)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddAngularImpulseInRadiansInterned)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddForceInterned)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddForceAtLocationInterned)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddImpulseInterned)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddImpulseAtLocationInterned)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddTorqueInDegreesInterned)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, AddTorqueInRadiansInterned)
+	UNREALCLR_TABLE_ENTRY(PrimitiveComponent, SetMassInterned)
+UNREALCLR_TABLE_END(PrimitiveComponent)
+
+UNREALCLR_TABLE_BEGIN(ShapeComponent)
+	UNREALCLR_TABLE_ENTRY(ShapeComponent, GetDynamicObstacle)
+	UNREALCLR_TABLE_ENTRY(ShapeComponent, GetShapeColor)
+	UNREALCLR_TABLE_ENTRY(ShapeComponent, SetDynamicObstacle)
+	UNREALCLR_TABLE_ENTRY(ShapeComponent, SetShapeColor)
+UNREALCLR_TABLE_END(ShapeComponent)
+
+UNREALCLR_TABLE_BEGIN(BoxComponent)
+	UNREALCLR_TABLE_ENTRY(BoxComponent, GetScaledBoxExtent)
+	UNREALCLR_TABLE_ENTRY(BoxComponent, GetUnscaledBoxExtent)
+	UNREALCLR_TABLE_ENTRY(BoxComponent, SetBoxExtent)
+	UNREALCLR_TABLE_ENTRY(BoxComponent, InitBoxExtent)
+UNREALCLR_TABLE_END(BoxComponent)
+
+UNREALCLR_TABLE_BEGIN(SphereComponent)
+	UNREALCLR_TABLE_ENTRY(SphereComponent, GetScaledSphereRadius)
+	UNREALCLR_TABLE_ENTRY(SphereComponent, GetUnscaledSphereRadius)
+	UNREALCLR_TABLE_ENTRY(SphereComponent, GetShapeScale)
+	UNREALCLR_TABLE_ENTRY(SphereComponent, SetSphereRadius)
+	UNREALCLR_TABLE_ENTRY(SphereComponent, InitSphereRadius)
+UNREALCLR_TABLE_END(SphereComponent)
+
+UNREALCLR_TABLE_BEGIN(CapsuleComponent)
+	UNREALCLR_TABLE_ENTRY(CapsuleComponent, GetScaledCapsuleRadius)
+	UNREALCLR_TABLE_ENTRY(CapsuleComponent, GetUnscaledCapsuleRadius)
+	UNREALCLR_TABLE_ENTRY(CapsuleComponent, GetShapeScale)
+	UNREALCLR_TABLE_ENTRY(CapsuleComponent, GetScaledCapsuleSize)
+	UNREALCLR_TABLE_ENTRY(CapsuleComponent, GetUnscaledCapsuleSize)
+	UNREALCLR_TABLE_ENTRY(CapsuleComponent, SetCapsuleRadius)
+	UNREALCLR_TABLE_ENTRY(CapsuleComponent, SetCapsuleSize)
+	UNREALCLR_TABLE_ENTRY(CapsuleComponent, InitCapsuleSize)
+UNREALCLR_TABLE_END(CapsuleComponent)
+
+UNREALCLR_TABLE_BEGIN(MeshComponent)
+	UNREALCLR_TABLE_ENTRY(MeshComponent, GetMaterialIndex)
+UNREALCLR_TABLE_END(MeshComponent)
+
+UNREALCLR_TABLE_BEGIN(LightComponentBase)
+	UNREALCLR_TABLE_ENTRY(LightComponentBase, GetIntensity)
+	UNREALCLR_TABLE_ENTRY(LightComponentBase, GetCastShadows)
+	UNREALCLR_TABLE_ENTRY(LightComponentBase, SetCastShadows)
+UNREALCLR_TABLE_END(LightComponentBase)
+
+UNREALCLR_TABLE_BEGIN(LightComponent)
+	UNREALCLR_TABLE_ENTRY(LightComponent, SetIntensity)
+UNREALCLR_TABLE_END(LightComponent)
+
+UNREALCLR_TABLE_BEGIN(MotionControllerComponent)
+	UNREALCLR_TABLE_ENTRY(MotionControllerComponent, IsTracked)
+UNREALCLR_TABLE_END(MotionControllerComponent)
+
+UNREALCLR_TABLE_BEGIN(StaticMeshComponent)
+	UNREALCLR_TABLE_ENTRY(StaticMeshComponent, GetLocalBounds)
+	UNREALCLR_TABLE_ENTRY(StaticMeshComponent, GetStaticMesh)
+	UNREALCLR_TABLE_ENTRY(StaticMeshComponent, SetStaticMesh)
+UNREALCLR_TABLE_END(StaticMeshComponent)
+
+UNREALCLR_TABLE_BEGIN(InstancedStaticMeshComponent)
+	UNREALCLR_TABLE_ENTRY(InstancedStaticMeshComponent, GetInstanceCount)
+	UNREALCLR_TABLE_ENTRY(InstancedStaticMeshComponent, AddInstance)
+	UNREALCLR_TABLE_ENTRY(InstancedStaticMeshComponent, UpdateInstanceTransform)
+	UNREALCLR_TABLE_ENTRY(InstancedStaticMeshComponent, ClearInstances)
+	UNREALCLR_TABLE_ENTRY(InstancedStaticMeshComponent, AddInstances)
+	UNREALCLR_TABLE_ENTRY(InstancedStaticMeshComponent, UpdateInstanceTransforms)
+	UNREALCLR_TABLE_ENTRY(InstancedStaticMeshComponent, RemoveInstances)
+UNREALCLR_TABLE_END(InstancedStaticMeshComponent)
+
+UNREALCLR_TABLE_BEGIN(SkinnedMeshComponent)
+	UNREALCLR_TABLE_ENTRY(SkinnedMeshComponent, SetSkeletalMesh)
+UNREALCLR_TABLE_END(SkinnedMeshComponent)
+
+UNREALCLR_TABLE_BEGIN(SkeletalMeshComponent)
+	UNREALCLR_TABLE_ENTRY(SkeletalMeshComponent, GetAnimationInstance)
+	UNREALCLR_TABLE_ENTRY(SkeletalMeshComponent, SetAnimation)
+	UNREALCLR_TABLE_ENTRY(SkeletalMeshComponent, SetAnimationMode)
+	UNREALCLR_TABLE_ENTRY(SkeletalMeshComponent, SetAnimationBlueprint)
+	UNREALCLR_TABLE_ENTRY(SkeletalMeshComponent, Play)
+	UNREALCLR_TABLE_ENTRY(SkeletalMeshComponent, PlayAnimation)
+	UNREALCLR_TABLE_ENTRY(SkeletalMeshComponent, Stop)
+UNREALCLR_TABLE_END(SkeletalMeshComponent)
+
+UNREALCLR_TABLE_BEGIN(MaterialInterface)
+	UNREALCLR_TABLE_ENTRY(MaterialInterface, IsTwoSided)
+UNREALCLR_TABLE_END(MaterialInterface)
+
+UNREALCLR_TABLE_BEGIN(Material)
+	UNREALCLR_TABLE_ENTRY(Material, IsDefaultMaterial)
+UNREALCLR_TABLE_END(Material)
+
+UNREALCLR_TABLE_BEGIN(MaterialInstance)
+	UNREALCLR_TABLE_ENTRY(MaterialInstance, IsChildOf)
+UNREALCLR_TABLE_END(MaterialInstance)
+
+UNREALCLR_TABLE_BEGIN(MaterialInstanceDynamic)
+	UNREALCLR_TABLE_ENTRY(MaterialInstanceDynamic, ClearParameterValues)
+	UNREALCLR_TABLE_ENTRY(MaterialInstanceDynamic, SetTextureParameterValue)
+	UNREALCLR_TABLE_ENTRY(MaterialInstanceDynamic, SetVectorParameterValue)
+	UNREALCLR_TABLE_ENTRY(MaterialInstanceDynamic, SetScalarParameterValue)
+	UNREALCLR_TABLE_ENTRY(MaterialInstanceDynamic, SetTextureParameterValueInterned)
+	UNREALCLR_TABLE_ENTRY(MaterialInstanceDynamic, SetVectorParameterValueInterned)
+	UNREALCLR_TABLE_ENTRY(MaterialInstanceDynamic, SetScalarParameterValueInterned)
+UNREALCLR_TABLE_END(MaterialInstanceDynamic)
+
+UNREALCLR_TABLE_BEGIN(CommandBuffer)
+	UNREALCLR_TABLE_ENTRY(CommandBuffer, Execute)
+UNREALCLR_TABLE_END(CommandBuffer)
+
+UNREALCLR_TABLE_BEGIN(TickFunction)
+	UNREALCLR_TABLE_ENTRY(TickFunction, Register)
+	UNREALCLR_TABLE_ENTRY(TickFunction, Unregister)
+	UNREALCLR_TABLE_ENTRY(TickFunction, IsRegistered)
+	UNREALCLR_TABLE_ENTRY(TickFunction, IsEnabled)
+	UNREALCLR_TABLE_ENTRY(TickFunction, GetInterval)
+	UNREALCLR_TABLE_ENTRY(TickFunction, SetEnabled)
+	UNREALCLR_TABLE_ENTRY(TickFunction, SetInterval)
+	UNREALCLR_TABLE_ENTRY(TickFunction, AddPrerequisite)
+	UNREALCLR_TABLE_ENTRY(TickFunction, AddActorPrerequisite)
+	UNREALCLR_TABLE_ENTRY(TickFunction, AddComponentPrerequisite)
+	UNREALCLR_TABLE_ENTRY(TickFunction, RemovePrerequisite)
+	UNREALCLR_TABLE_ENTRY(TickFunction, RemoveActorPrerequisite)
+	UNREALCLR_TABLE_ENTRY(TickFunction, RemoveComponentPrerequisite)
+UNREALCLR_TABLE_END(TickFunction)
+
+UNREALCLR_TABLE_BEGIN(GameThread)
+	UNREALCLR_TABLE_ENTRY(GameThread, SetDispatcher)
+UNREALCLR_TABLE_END(GameThread)
+
+UNREALCLR_TABLE_BEGIN(Statistics)
+	UNREALCLR_TABLE_ENTRY(Statistics, Register)
+UNREALCLR_TABLE_END(Statistics)
\ No newline at end of file